@@ -90,13 +90,21 @@
 #include "llvm/IR/Module.h"
 #include "llvm/IR/ModuleSlotTracker.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
 
 #include "boost/range/irange.hpp"
+#include <fstream>
 #include <queue>
 #include <utility>
 
 #include "bvec.h"
 
+// Version of the cached solution format; to be increased whenever the solver
+//  or the constraint generation change their results.
+#define SOLUTION_CACHE_VERSION 1
+
 namespace std
 {
    template <>
@@ -1434,7 +1442,7 @@ class Worklist
    }
 };
 
-Andersen_AA::Andersen_AA(std::string _TopFunctionName) : BDD_INIT_DONE(false), TopFunctionName(std::move(_TopFunctionName)), last_obj_node(0), gep2pts(nullptr), extinfo(nullptr), WL(nullptr)
+Andersen_AA::Andersen_AA(std::string _TopFunctionName, std::string _SolutionCacheDir) : BDD_INIT_DONE(false), TopFunctionName(std::move(_TopFunctionName)), SolutionCacheDir(std::move(_SolutionCacheDir)), last_obj_node(0), gep2pts(nullptr), extinfo(nullptr), WL(nullptr)
 {
 }
 
@@ -6568,6 +6576,9 @@ void Andersen_AA::solve_init()
 
    // Start the worklist with all nodes that point to something
    //  and have outgoing constraint edges.
+   // They are prioritized in topological order of the copy edges, so that the
+   //  first pass sweeps the graph as a wave.
+   std::vector<u32> rpo = copy_rpo();
    assert(!WL);
    WL = new Worklist(nn);
    if(DEBUG_AA)
@@ -6591,7 +6602,7 @@ void Andersen_AA::solve_init()
          // If N has no outgoing constraints, we can't do anything with it now.
          continue;
       }
-      WL->push(i, 0);
+      WL->push(i, rpo[i]);
       if(DEBUG_AA)
       {
          llvm::errs() << "  ";
@@ -6610,6 +6621,50 @@ void Andersen_AA::solve_init()
    ext_failed.clear();
 }
 
+//------------------------------------------------------------------------------
+// Number the rep nodes in reverse postorder of a DFS along the copy edges:
+//  the rank of every node is lower than the ones of its successors, except
+//  for the back edges, i.e. the nodes are in topological order of the
+//  SCC-condensed constraint graph.
+std::vector<u32> Andersen_AA::copy_rpo()
+{
+   u32 nn = nodes.size();
+   std::vector<u32> rank(nn, 0);
+   std::vector<bool> visited(nn, false);
+   std::vector<std::pair<u32, bitmap::iterator>> dfs_stk;
+   u32 next_rank = nn;
+   for(auto root : boost::irange(0u, nn))
+   {
+      if(visited[root] || !nodes[root]->is_rep())
+      {
+         continue;
+      }
+      visited[root] = true;
+      dfs_stk.emplace_back(root, nodes[root]->copy_to.begin());
+      while(!dfs_stk.empty())
+      {
+         u32 n = dfs_stk.back().first;
+         auto& it = dfs_stk.back().second;
+         if(it != nodes[n]->copy_to.end())
+         {
+            u32 dest = get_node_rep(*it);
+            ++it;
+            if(!visited[dest])
+            {
+               visited[dest] = true;
+               dfs_stk.emplace_back(dest, nodes[dest]->copy_to.begin());
+            }
+         }
+         else
+         {
+            rank[n] = --next_rank;
+            dfs_stk.pop_back();
+         }
+      }
+   }
+   return rank;
+}
+
 //------------------------------------------------------------------------------
 // Returns 0 on completion, 1 on abort.
 bool Andersen_AA::solve()
@@ -7557,8 +7612,21 @@ void Andersen_AA::computePointToSet(llvm::Module& M)
    pre_opt_cleanup();
    cons_opt();
    pts_init();
-   solve_init();
-   solve();
+   const std::string cache_file = solution_cache_file(M);
+   if(cache_file.empty() || !load_solution(cache_file))
+   {
+      solve_init();
+      solve();
+      if(!cache_file.empty())
+      {
+         store_solution(cache_file);
+      }
+   }
+   else
+   {
+      // The constraints are consumed by solve_init, which is skipped.
+      constraints.clear();
+   }
    if(DEBUG_AA)
    {
       print_cons_graph(true);
@@ -7578,6 +7646,160 @@ void Andersen_AA::computePointToSet(llvm::Module& M)
    }
 }
 
+//------------------------------------------------------------------------------
+// Return the file of the solution cache for module (M), or the empty string if
+//  the cache is disabled. The key is the digest of the textual IR, so the
+//  solution is reused only if the module and thus the constraints are the same.
+std::string Andersen_AA::solution_cache_file(const llvm::Module& M) const
+{
+   if(SolutionCacheDir.empty())
+   {
+      return "";
+   }
+   std::string ir;
+   llvm::raw_string_ostream ir_stream(ir);
+   ir_stream << "HLAA" << SOLUTION_CACHE_VERSION << " " << NO_FIELD_SENSITIVE << " " << TopFunctionName << "\n";
+   M.print(ir_stream, nullptr);
+   llvm::MD5 hash;
+   hash.update(ir_stream.str());
+   llvm::MD5::MD5Result result;
+   hash.final(result);
+   llvm::SmallString<32> digest;
+   llvm::MD5::stringifyResult(result, digest);
+   return SolutionCacheDir + "/" + digest.str().str() + ".pts";
+}
+
+//------------------------------------------------------------------------------
+// Restore the node reps and the points-to sets computed by a previous run;
+//  returns false (leaving the nodes untouched) if the file is missing or does
+//  not match the current nodes.
+bool Andersen_AA::load_solution(const std::string& file_name)
+{
+   std::ifstream in(file_name);
+   if(!in)
+   {
+      return false;
+   }
+   std::string magic;
+   u32 version = 0, nn = 0, npts = 0;
+   if(!(in >> magic >> version >> nn >> npts) || magic != "HLAA" || version != SOLUTION_CACHE_VERSION || nn != nodes.size() || npts != last_obj_node + 1)
+   {
+      return false;
+   }
+   // Parse everything before touching the nodes.
+   std::vector<u32> reps(nn, node_rank_min);
+   std::vector<std::vector<u32>> pts(nn);
+   for(auto i : boost::irange(0u, nn))
+   {
+      char kind;
+      u32 value;
+      if(!(in >> kind >> value))
+      {
+         return false;
+      }
+      if(kind == 'm')
+      {
+         if(value >= nn || value == i)
+         {
+            return false;
+         }
+         reps[i] = value;
+      }
+      else if(kind == 'p')
+      {
+         pts[i].resize(value);
+         for(auto& member : pts[i])
+         {
+            if(!(in >> member) || member >= npts)
+            {
+               return false;
+            }
+         }
+      }
+      else
+      {
+         return false;
+      }
+   }
+   for(auto rep : reps)
+   {
+      if(rep < node_rank_min && reps[rep] < node_rank_min)
+      {
+         return false;
+      }
+   }
+   for(auto i : boost::irange(0u, nn))
+   {
+      Node* N = nodes[i];
+      N->rep = reps[i];
+      N->points_to = bddfalse;
+      for(auto member : pts[i])
+      {
+         N->points_to |= get_node_var(member);
+      }
+   }
+   if(DEBUG_AA)
+   {
+      llvm::errs() << "Points-to solution loaded from " << file_name << "\n";
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Save the node reps and the points-to sets of the reps in the solution cache.
+// The file is written under a temporary name and then renamed, so that
+//  concurrent compilations never read a partial solution.
+void Andersen_AA::store_solution(const std::string& file_name) const
+{
+   if(llvm::sys::fs::create_directories(SolutionCacheDir))
+   {
+      return;
+   }
+   int fd;
+   llvm::SmallString<128> tmp_name;
+   if(llvm::sys::fs::createUniqueFile(file_name + ".%%%%%%.tmp", fd, tmp_name))
+   {
+      return;
+   }
+   {
+      llvm::raw_fd_ostream out(fd, true);
+      u32 nn = nodes.size();
+      out << "HLAA " << SOLUTION_CACHE_VERSION << " " << nn << " " << last_obj_node + 1 << "\n";
+      for(auto i : boost::irange(0u, nn))
+      {
+         const Node* N = nodes[i];
+         if(!N->is_rep())
+         {
+            out << "m " << cget_node_rep(i) << "\n";
+            continue;
+         }
+         if(N->points_to == bddfalse)
+         {
+            out << "p 0\n";
+            continue;
+         }
+         const std::vector<u32>* pts = bdd2vec(N->points_to);
+         out << "p " << pts->size();
+         for(auto member : *pts)
+         {
+            out << " " << member;
+         }
+         out << "\n";
+      }
+      out.close();
+      if(out.has_error())
+      {
+         out.clear_error();
+         llvm::sys::fs::remove(tmp_name);
+         return;
+      }
+   }
+   if(llvm::sys::fs::rename(tmp_name, file_name))
+   {
+      llvm::sys::fs::remove(tmp_name);
+   }
+}
+
 // Return the points-to set of node n, with offset off,
 //  as a pointer to a vector in the cache.
 const std::vector<u32>* Andersen_AA::pointsToSet(u32 n, u32 off)
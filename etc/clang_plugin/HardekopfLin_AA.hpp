@@ -230,6 +230,10 @@ class Andersen_AA
    // top function name
    const std::string TopFunctionName;
 
+   // directory of the persistent cache of the points-to solutions; the solution
+   //  of a module is reused by the next compilations producing the same IR
+   const std::string SolutionCacheDir;
+
    //------------------------------------------------------------------------------
    // Analysis results (should remain in memory after the run completes)
    //------------------------------------------------------------------------------
@@ -481,6 +485,7 @@ class Andersen_AA
    void cons_opt();
 
    void pts_init();
+   std::vector<u32> copy_rpo();
    void solve_init();
    bool solve();
    void run_lcd();
@@ -493,6 +498,9 @@ class Andersen_AA
    void solve_prop(u32 n, const bdd& d_points_to);
    void handle_ext(const llvm::Function* F, const llvm::Instruction* I);
    void lcd_dfs(u32 n);
+   std::string solution_cache_file(const llvm::Module& M) const;
+   bool load_solution(const std::string& file_name);
+   void store_solution(const std::string& file_name) const;
 
  protected:
    //------------------------------------------------------------------------------
@@ -594,7 +602,7 @@ class Andersen_AA
    }
 
  public:
-   Andersen_AA(std::string _TopFunctionName);
+   Andersen_AA(std::string _TopFunctionName, std::string _SolutionCacheDir = "");
    virtual ~Andersen_AA();
    virtual void computePointToSet(llvm::Module& M);
    const std::vector<u32>* pointsToSet(const llvm::Value*, u32 = 0);
@@ -248,7 +248,7 @@ namespace llvm
       return declname;
    }
 
-   DumpGimpleRaw::DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool _onlyGlobals, std::map<std::string, std::vector<std::string>>* _fun2params, bool early)
+   DumpGimpleRaw::DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool _onlyGlobals, std::map<std::string, std::vector<std::string>>* _fun2params, bool early, bool _binaryDump, const std::string& _aaCacheDir)
        : earlyAnalysis(early),
          outdir_name(_outdir_name),
          InFile(_InFile),
@@ -264,6 +264,8 @@ namespace llvm
          modulePass(nullptr),
          last_used_index(0),
          column(0),
+         binaryDump(_binaryDump),
+         aaCacheDir(_aaCacheDir),
          PtoSets_AA(nullptr),
          SignedPointerTypeReference(0),
          last_memory_ssa_vers(std::numeric_limits<int>::max()),
@@ -3457,6 +3459,8 @@ namespace llvm
 
    void DumpGimpleRaw::serialize_new_line()
    {
+      if(binaryDump)
+         return;
       snprintf(buffer, LOCAL_BUFFER_LEN, "\n%*s", SOL_COLUMN, "");
       stream << buffer;
       column = SOL_COLUMN;
@@ -3466,6 +3470,9 @@ namespace llvm
    {
       int extra;
 
+      /* The binary format has no layout.  */
+      if(binaryDump)
+         return;
       /* See if we need a new line. */
       if(column > EOL_COLUMN)
          serialize_new_line();
@@ -3478,8 +3485,116 @@ namespace llvm
       }
    }
 
+   void DumpGimpleRaw::binary_varint(std::string& out, uint64_t value)
+   {
+      while(value >= 0x80)
+      {
+         out += static_cast<char>((value & 0x7F) | 0x80);
+         value >>= 7;
+      }
+      out += static_cast<char>(value);
+   }
+
+   unsigned int DumpGimpleRaw::binary_intern(const std::string& str)
+   {
+      auto it = binaryStrings.find(str);
+      if(it != binaryStrings.end())
+         return it->second;
+      /* The definition is written before the record using it.  */
+      std::string definition(1, static_cast<char>(TREE_BINARY_STRING));
+      binary_varint(definition, str.size());
+      definition += str;
+      stream << definition;
+      unsigned int index = binaryStrings.size();
+      binaryStrings[str] = index;
+      return index;
+   }
+
+   void DumpGimpleRaw::binary_keyword(const char* keyword)
+   {
+      unsigned int index = binary_intern(keyword);
+      binaryRecord += static_cast<char>(TREE_BINARY_KEYWORD);
+      binary_varint(binaryRecord, index);
+   }
+
+   void DumpGimpleRaw::binary_number(int64_t value)
+   {
+      binaryRecord += static_cast<char>(TREE_BINARY_NUMBER);
+      binary_varint(binaryRecord, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+   }
+
+   void DumpGimpleRaw::binary_node_id(unsigned int index)
+   {
+      binaryRecord += static_cast<char>(TREE_BINARY_NODE_ID);
+      binary_varint(binaryRecord, index);
+   }
+
+   void DumpGimpleRaw::binary_string(const std::string& str)
+   {
+      unsigned int index = binary_intern(str);
+      binaryRecord += static_cast<char>(TREE_BINARY_STRING_VALUE);
+      binary_varint(binaryRecord, index);
+   }
+
+   void DumpGimpleRaw::binary_escaped_string(const char* str, int length)
+   {
+      std::string escaped;
+      llvm::raw_string_ostream escaped_stream(escaped);
+      serialize_with_escape(str, length, escaped_stream);
+      binary_string(escaped_stream.str());
+   }
+
+   void DumpGimpleRaw::binary_flush_record(unsigned char tag)
+   {
+      std::string record(1, static_cast<char>(tag));
+      binary_varint(record, binaryRecord.size());
+      stream << record << binaryRecord;
+      binaryRecord.clear();
+   }
+
+   void DumpGimpleRaw::serialize_srcp(const char* file, int line, int column_number)
+   {
+      if(binaryDump)
+      {
+         binary_keyword("srcp");
+         binary_string(file);
+         binary_number(line);
+         binary_number(column_number);
+         return;
+      }
+      snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", file, line, column_number);
+      stream << buffer;
+      column += 12 + strlen(file) + 8;
+   }
+
+   void DumpGimpleRaw::serialize_code_name(const char* code_name)
+   {
+      if(binaryDump)
+      {
+         binary_keyword(code_name);
+         return;
+      }
+      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
+      stream << buffer;
+      column = 25;
+   }
+
+   void DumpGimpleRaw::serialize_end_of_node()
+   {
+      if(binaryDump)
+         binary_flush_record(TREE_BINARY_NODE);
+      else
+         stream << "\n";
+   }
+
    void DumpGimpleRaw::serialize_pointer(const char* field, const void* ptr)
    {
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         binary_number(static_cast<int64_t>(reinterpret_cast<uintptr_t>(ptr)));
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: %-8llx ", field, (unsigned long long)ptr);
       stream << buffer;
@@ -3490,12 +3605,30 @@ namespace llvm
    {
       const char* panda_plugin_version = (const char*)PANDA_PLUGIN_VERSION;
       int version = __GNUC__, minor = __GNUC_MINOR__, patchlevel = __GNUC_PATCHLEVEL__;
+      if(binaryDump)
+      {
+         stream.write(TREE_BINARY_MAGIC, TREE_BINARY_MAGIC_LENGTH);
+         for(unsigned int byte = 0; byte < 4; ++byte)
+            stream << static_cast<char>((TREE_BINARY_VERSION >> (8 * byte)) & 0xFF);
+         binary_keyword("GCC_VERSION");
+         binary_string(std::to_string(version) + "." + std::to_string(minor) + "." + std::to_string(patchlevel));
+         binary_keyword("PLUGIN_VERSION");
+         binary_string(panda_plugin_version);
+         binary_flush_record(TREE_BINARY_HEADER);
+         return;
+      }
       stream << "GCC_VERSION: \"" << version << "." << minor << "." << patchlevel << "\"\n";
       stream << "PLUGIN_VERSION: \"" << panda_plugin_version << "\"\n";
    }
 
    void DumpGimpleRaw::serialize_int(const char* field, int i)
    {
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         binary_number(i);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: %-7d ", field, i);
       stream << buffer;
@@ -3505,6 +3638,12 @@ namespace llvm
    /* Serialize wide integer i using FIELD to identify it.  */
    void DumpGimpleRaw::serialize_wide_int(const char* field, int64_t i)
    {
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         binary_number(i);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN,
                "%-4s: "
@@ -3582,9 +3721,47 @@ namespace llvm
       sprintf(current, "p%+d", ExpUnbiased);
    }
 
+   /* Compute the decimal literal (valr) and the hexadecimal representation (valx) of a real; Inf and Nan are returned as names.  */
+   static void real_to_strings(char* buffer, unsigned size_buff, const llvm::APFloat& d, std::string& valr, std::string& valx)
+   {
+      if(d.isInfinity())
+      {
+         valr = "Inf";
+         valx = d.isNegative() ? "-Inf" : "Inf";
+      }
+      else if(d.isNaN())
+      {
+         valr = valx = "Nan";
+      }
+      else
+      {
+         bool isDouble = &d.getSemantics() == &llvm::APFloat::IEEEdouble();
+         snprintf(buffer, size_buff, "%.*g", (isDouble ? __DBL_DECIMAL_DIG__ : __FLT_DECIMAL_DIG__), (isDouble ? d.convertToDouble() : d.convertToFloat()));
+         valr = std::string(buffer);
+         if(valr.find('.') == std::string::npos && valr.find('e') == std::string::npos)
+            valr = valr + ".";
+         if(!isDouble && valr.find('e') == std::string::npos)
+            valr = valr + "f";
+         real_to_hexadecimal(buffer, size_buff, d);
+         valx = std::string(buffer);
+      }
+   }
+
    /* Serialize real r using FIELD to identify it.  */
    void DumpGimpleRaw::serialize_real(const void* t)
    {
+      assert(reinterpret_cast<const llvm::ConstantFP*>(t)->getValueID() == llvm::Value::ConstantFPVal);
+      const llvm::APFloat& d = reinterpret_cast<const llvm::ConstantFP*>(t)->getValueAPF();
+      std::string valr, valx;
+      real_to_strings(buffer, LOCAL_BUFFER_LEN, d, valr, valx);
+      if(binaryDump)
+      {
+         binary_keyword("valr");
+         binary_string(valr);
+         binary_keyword("valx");
+         binary_string(valx);
+         return;
+      }
       serialize_maybe_newline();
       /* Code copied from print_node.  */
       /*if(TREE_OVERFLOW(t))
@@ -3592,40 +3769,17 @@ namespace llvm
          stream << "overflow ";
          column += 8;
       }*/
-      assert(reinterpret_cast<const llvm::ConstantFP*>(t)->getValueID() == llvm::Value::ConstantFPVal);
-      const llvm::APFloat& d = reinterpret_cast<const llvm::ConstantFP*>(t)->getValueAPF();
-      if(d.isInfinity())
-      {
-         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", "\"Inf\"");
-         stream << buffer;
-         if(d.isNegative())
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"-Inf\"");
-         else
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"Inf\"");
-         stream << buffer;
-      }
-      else if(d.isNaN())
+      if(d.isInfinity() || d.isNaN())
       {
-         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", "\"Nan\"");
+         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", ("\"" + valr + "\"").c_str());
          stream << buffer;
-         snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"Nan\"");
+         snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", ("\"" + valx + "\"").c_str());
          stream << buffer;
       }
       else
       {
-         bool isDouble = &d.getSemantics() == &llvm::APFloat::IEEEdouble();
-         snprintf(buffer, LOCAL_BUFFER_LEN, "%.*g", (isDouble ? __DBL_DECIMAL_DIG__ : __FLT_DECIMAL_DIG__), (isDouble ? d.convertToDouble() : d.convertToFloat()));
-         std::string literalReal = std::string(buffer);
-         if(literalReal.find('.') == std::string::npos && literalReal.find('e') == std::string::npos)
-            literalReal = literalReal + ".";
-         if(!isDouble && literalReal.find('e') == std::string::npos)
-            literalReal = literalReal + "f";
-         stream << "valr: \"" << literalReal << "\" ";
-
-         stream << "valx: \"";
-         real_to_hexadecimal(buffer, LOCAL_BUFFER_LEN, d);
-         stream << std::string(buffer);
-         stream << "\"";
+         stream << "valr: \"" << valr << "\" ";
+         stream << "valx: \"" << valx << "\"";
       }
       column += 21;
    }
@@ -3634,14 +3788,14 @@ namespace llvm
    {
       int new_length;
       stream << "\"";
-      new_length = serialize_with_escape(input, length);
+      new_length = serialize_with_escape(input, length, stream);
       stream << "\"";
       return new_length + 2;
    }
 
    /* Add a backslash before an escape sequence to serialize the string
       with the escape sequence */
-   int DumpGimpleRaw::serialize_with_escape(const char* input, int length)
+   int DumpGimpleRaw::serialize_with_escape(const char* input, int length, llvm::raw_ostream& out)
    {
       int i;
       int k = 0;
@@ -3652,94 +3806,94 @@ namespace llvm
             case '\n':
             {
                /* new line*/
-               stream << "\\";
-               stream << "n";
+               out << "\\";
+               out << "n";
                k += 2;
                break;
             }
             case '\t':
             {
                /* horizontal tab */
-               stream << "\\";
-               stream << "t";
+               out << "\\";
+               out << "t";
                k += 2;
                break;
             }
             case '\v':
             {
                /* vertical tab */
-               stream << "\\";
-               stream << "v";
+               out << "\\";
+               out << "v";
                k += 2;
                break;
             }
             case '\b':
             {
                /* backspace */
-               stream << "\\";
-               stream << "b";
+               out << "\\";
+               out << "b";
                k += 2;
                break;
             }
             case '\r':
             {
                /* carriage return */
-               stream << "\\";
-               stream << "r";
+               out << "\\";
+               out << "r";
                k += 2;
                break;
             }
             case '\f':
             {
                /* jump page */
-               stream << "\\";
-               stream << "f";
+               out << "\\";
+               out << "f";
                k += 2;
                break;
             }
             case '\a':
             {
                /* alarm */
-               stream << "\\";
-               stream << "a";
+               out << "\\";
+               out << "a";
                k += 2;
                break;
             }
             case '\\':
             {
                /* backslash */
-               stream << "\\";
-               stream << "\\";
+               out << "\\";
+               out << "\\";
                k += 2;
                break;
             }
             case '\"':
             {
                /* double quote */
-               stream << "\\";
-               stream << "\"";
+               out << "\\";
+               out << "\"";
                k += 2;
                break;
             }
             case '\'':
             {
                /* quote */
-               stream << "\\";
-               stream << "\'";
+               out << "\\";
+               out << "\'";
                k += 2;
                break;
             }
             case '\0':
             {
                /* null */
-               stream << "\\";
-               stream << "0";
+               out << "\\";
+               out << "0";
                k += 2;
                break;
             }
             default:
             {
-               stream << input[i];
+               out << input[i];
                k++;
             }
          }
@@ -3750,6 +3904,11 @@ namespace llvm
    /* Serialize the string S.  */
    void DumpGimpleRaw::serialize_string(const char* string)
    {
+      if(binaryDump)
+      {
+         binary_keyword(string);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-13s ", string);
       stream << buffer;
@@ -3763,6 +3922,12 @@ namespace llvm
    void DumpGimpleRaw::serialize_string_field(const char* field, const char* str)
    {
       int length;
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         binary_escaped_string(str, std::strlen(str));
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: ", field);
       stream << buffer;
@@ -3777,6 +3942,29 @@ namespace llvm
    void DumpGimpleRaw::serialize_string_cst(const char* field, const char* str, int length, unsigned int precision)
    {
       int new_length;
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         if(precision == 8)
+         {
+            binary_escaped_string(str, length - 1);
+            serialize_int("lngt", length);
+         }
+         else
+         {
+            const unsigned int* string = (const unsigned int*)str;
+            unsigned int i, lngt = length / 4 - 1;
+            std::string value;
+            for(i = 0; i < lngt; i++)
+            {
+               snprintf(buffer, LOCAL_BUFFER_LEN, "\\x%x", string[i]);
+               value += buffer;
+            }
+            binary_string(value);
+            serialize_int("lngt", lngt + 1);
+         }
+         return;
+      }
       serialize_maybe_newline();
       if(precision == 8)
       {
@@ -3824,6 +4012,12 @@ namespace llvm
          /* If we haven't, add it to the queue.  */
          index = queue(t);
       }
+      if(binaryDump)
+      {
+         binary_keyword(field);
+         binary_node_id(index);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: ", field);
       stream << buffer;
@@ -3833,6 +4027,11 @@ namespace llvm
 
    void DumpGimpleRaw::serialize_index(unsigned int index)
    {
+      if(binaryDump)
+      {
+         binary_node_id(index);
+         return;
+      }
       snprintf(buffer, LOCAL_BUFFER_LEN, "@%-6u ", index);
       stream << buffer;
       column += 8;
@@ -3899,9 +4098,7 @@ namespace llvm
       /* Print the node index.  */
       serialize_index(index);
 
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
-      column = 25;
+      serialize_code_name(code_name);
       serialize_child("scpe", getGimpleScpe(g));
       serialize_int("bb_index", getGimple_bb_index(g));
 
@@ -3911,12 +4108,10 @@ namespace llvm
       if(gimple_has_location(g))
       {
          expanded_location xloc = expand_location(gimple_location(g));
-         serialize_maybe_newline();
-         snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", xloc.file, xloc.line, xloc.column);
          if(xloc.file && xloc.file[0])
          {
-            stream << buffer;
-            column += 12 + strlen(xloc.file) + 8;
+            serialize_maybe_newline();
+            serialize_srcp(xloc.file, xloc.line, xloc.column);
          }
       }
       serialize_int("time_weight", code == GT(GIMPLE_NOP) ? 0 : 1);
@@ -4168,7 +4363,7 @@ namespace llvm
       }
 
       /* Terminate the line.  */
-      stream << "\n";
+      serialize_end_of_node();
    }
 
    void DumpGimpleRaw::dequeue_and_serialize_statement(const void* t)
@@ -4181,9 +4376,7 @@ namespace llvm
       /* Print the node index.  */
       serialize_index(index);
 
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
-      column = 25;
+      serialize_code_name(code_name);
 
       /* In case of basic blocks the function print:
                      + first a list of all statements
@@ -4241,11 +4434,19 @@ namespace llvm
             serialize_int("loop_id", loopLabes.find(LI.getLoopFor(&BB))->second);
          if(llvm::pred_begin(&BB) == llvm::pred_end(&BB))
          {
-            serialize_maybe_newline();
-            field = "pred: ENTRY";
-            snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
-            stream << buffer;
-            column += 14;
+            if(binaryDump)
+            {
+               binary_keyword("pred");
+               binary_keyword("ENTRY");
+            }
+            else
+            {
+               serialize_maybe_newline();
+               field = "pred: ENTRY";
+               snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
+               stream << buffer;
+               column += 14;
+            }
          }
          else
          {
@@ -4262,11 +4463,19 @@ namespace llvm
          }
          if(llvm::succ_begin(&BB) == llvm::succ_end(&BB) || isa<llvm::UnreachableInst>(BB.getTerminator()))
          {
-            serialize_maybe_newline();
-            field = "succ: EXIT";
-            snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
-            stream << buffer;
-            column += 14;
+            if(binaryDump)
+            {
+               binary_keyword("succ");
+               binary_keyword("EXIT");
+            }
+            else
+            {
+               serialize_maybe_newline();
+               field = "succ: EXIT";
+               snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
+               stream << buffer;
+               column += 14;
+            }
          }
          else
          {
@@ -4317,7 +4526,7 @@ namespace llvm
             serialize_gimple_child("stmt", createGimpleLabelStmt(&BB));
       }
       /* Terminate the line.  */
-      stream << "\n";
+      serialize_end_of_node();
    }
 
    std::string DumpGimpleRaw::getHeaderForBuiltin(const void* t)
@@ -4395,9 +4604,7 @@ namespace llvm
 #if PRINT_DBG_MSG
       llvm::errs() << "|" << code_name << "\n";
 #endif
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
-      column = 25;
+      serialize_code_name(code_name);
 
       tree_codes code = TREE_CODE(t);
       tree_codes_class code_class = TREE_CODE_CLASS(code);
@@ -4452,21 +4659,16 @@ namespace llvm
          {
             serialize_maybe_newline();
             /// with clang/llvm there is no type definition
-            snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"");
-            stream << buffer;
+            std::string srcFile = InFile;
             if(code == GT(FUNCTION_DECL) && is_builtin_fn(t) && reinterpret_cast<const llvm::Function*>(t)->getBasicBlockList().empty())
             {
                auto headerFile = getHeaderForBuiltin(t);
                if(headerFile != "")
-                  stream << headerFile;
+                  srcFile = headerFile;
                else
-                  stream << "<built-in>";
+                  srcFile = "<built-in>";
             }
-            else
-               stream << InFile;
-            snprintf(buffer, LOCAL_BUFFER_LEN, "\":0:0 ");
-            stream << buffer;
-            column += 12 + InFile.size() + 8;
+            serialize_srcp(srcFile.c_str(), 0, 0);
          }
          else
          {
@@ -4475,9 +4677,7 @@ namespace llvm
             if(xloc.file)
             {
                serialize_maybe_newline();
-               snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", xloc.file, xloc.line, xloc.column);
-               stream << buffer;
-               column += 12 + strlen(xloc.file) + 8;
+               serialize_srcp(xloc.file, xloc.line, xloc.column);
             }
          }
 
@@ -4798,13 +4998,16 @@ namespace llvm
             /* There are no additional fields to print.  */
             break;
       }
-      stream << "\n";
+      serialize_end_of_node();
    }
 
    void DumpGimpleRaw::SerializeGimpleFunctionHeader(const void* obj)
    {
       assert(TREE_CODE(obj) == GT(FUNCTION_DECL));
       const llvm::Function* fd = reinterpret_cast<const llvm::Function*>(obj);
+      /* Comments are not part of the binary format.  */
+      if(binaryDump)
+         return;
       stream << "\n;; Function " << fd->getName() << "(" << fd->getName() << ")\n\n";
       stream << ";; " << fd->getName() << "(";
       stream << ")\n";
@@ -6323,7 +6526,7 @@ namespace llvm
          {
 #define ANDERSEN 1
 #if ANDERSEN
-            PtoSets_AA = new Andersen_AA(starting_function);
+            PtoSets_AA = new Andersen_AA(starting_function, aaCacheDir);
 #else
             PtoSets_AA = new Staged_Flow_Sensitive_AA(starting_function);
 #endif
@@ -84,6 +84,8 @@ namespace llvm
    cl::opt<std::string> TopFunctionName("panda-topfname", cl::desc("Specify the name of the top function"), cl::value_desc("name of the top function"));
    cl::opt<std::string> outdir_name("panda-outputdir", cl::desc("Specify the directory where the gimple raw file will be written"), cl::value_desc("directory path"));
    cl::opt<std::string> InFile("panda-infile", cl::desc("Specify the name of the compiled source file"), cl::value_desc("filename path"));
+   cl::opt<bool> BinaryDump("panda-binary-dump", cl::desc("Write the gimple raw file in the binary interchange format"), cl::init(false));
+   cl::opt<std::string> AACacheDir("panda-aa-cache", cl::desc("Directory where the Andersen points-to solutions are cached across compilations"), cl::value_desc("directory path"), cl::init(""));
 
    template <bool earlyAnalysis>
    struct CLANG_VERSION_SYMBOL(_plugin_dumpGimpleSSA) : public ModulePass
@@ -163,7 +165,7 @@ namespace llvm
                }
             }
          }
-         DumpGimpleRaw gimpleRawWriter(outdir_name, *(FileTokenizer.begin()), false, &Fun2Params, earlyAnalysis);
+         DumpGimpleRaw gimpleRawWriter(outdir_name, *(FileTokenizer.begin()), false, &Fun2Params, earlyAnalysis, BinaryDump, AACacheDir);
 
 #if PRINT_DBG_MSG
          if(!TopFunctionName.empty())
@@ -63,6 +63,18 @@
 #define GT(code) tree_codes::code
 #define LOCAL_BUFFER_LEN 512
 
+/// binary interchange format of the raw file; it must be kept aligned with src/parser/treegcc/tree_binary_reader.hpp
+#define TREE_BINARY_MAGIC "\x89PANDAGB"
+#define TREE_BINARY_MAGIC_LENGTH 8
+#define TREE_BINARY_VERSION 1
+#define TREE_BINARY_STRING 1
+#define TREE_BINARY_HEADER 2
+#define TREE_BINARY_NODE 3
+#define TREE_BINARY_KEYWORD 1
+#define TREE_BINARY_NUMBER 2
+#define TREE_BINARY_NODE_ID 3
+#define TREE_BINARY_STRING_VALUE 4
+
 #if __clang_major__ == 8
 #define CLANG_VERSION_SYMBOL(SYMBOL) clang7##SYMBOL
 #define CLANG_VERSION_STRING(SYMBOL) "clang7" #SYMBOL
@@ -229,6 +241,15 @@ namespace llvm
       /// serialization data
       int column;
 
+      /// when true the raw file is written in the binary interchange format instead of the textual one
+      bool binaryDump;
+      /// directory where the points-to solutions are cached across compilations (empty if the cache is disabled)
+      const std::string aaCacheDir;
+      /// payload of the binary record under construction
+      std::string binaryRecord;
+      /// interned strings of the binary raw file
+      std::map<std::string, unsigned int> binaryStrings;
+
       /// internal identifier table
       std::set<std::string> identifierTable;
       /// unsigned integer constant table
@@ -658,6 +679,28 @@ namespace llvm
 
       void DumpVersion(llvm::raw_fd_ostream& stream);
 
+      void binary_varint(std::string& out, uint64_t value);
+
+      unsigned int binary_intern(const std::string& str);
+
+      void binary_keyword(const char* keyword);
+
+      void binary_number(int64_t value);
+
+      void binary_node_id(unsigned int index);
+
+      void binary_string(const std::string& str);
+
+      void binary_escaped_string(const char* str, int length);
+
+      void binary_flush_record(unsigned char tag);
+
+      void serialize_srcp(const char* file, int line, int column_number);
+
+      void serialize_code_name(const char* code_name);
+
+      void serialize_end_of_node();
+
       void serialize_new_line();
 
       void serialize_maybe_newline();
@@ -672,7 +715,7 @@ namespace llvm
 
       int serialize_with_double_quote(const char* input, int length);
 
-      int serialize_with_escape(const char* input, int length);
+      int serialize_with_escape(const char* input, int length, llvm::raw_ostream& out);
 
       void serialize_string(const char* string);
 
@@ -726,7 +769,7 @@ namespace llvm
       void computeMAEntryDefs(const llvm::Function* F, std::map<const llvm::Function*, std::map<const void*, std::set<const llvm::Instruction*>>>& CurrentListofMAEntryDef, llvm::ModulePass* modulePass);
 
     public:
-      DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool onlyGlobals, std::map<std::string, std::vector<std::string>>* fun2params, bool early);
+      DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool onlyGlobals, std::map<std::string, std::vector<std::string>>* fun2params, bool early, bool binaryDump = false, const std::string& aaCacheDir = "");
 
       bool runOnModule(llvm::Module& M, llvm::ModulePass* modulePass, const std::string& TopFunctionName);
    };
@@ -0,0 +1,275 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                 URL: http://trac.ws.dei.polimi.it/panda
+ *                      Microarchitectures Laboratory
+ *                       Politecnico di Milano - DEI
+ *             ***********************************************
+ *              Copyright (c) 2018-2020 Politecnico di Milano
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the
+ *   Free Software Foundation, Inc.,
+ *   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+*/
+/**
+ * @file ReadWrite_m_axi.cpp
+ * @brief Snippet for the ReadWrite_m_axi dynamic generator.
+ *
+ * The adapter translates the read/write operations of a m_axi parameter into AXI4 transactions.
+ * Reads are served by a line buffer of alignment(araddr) words filled by a single INCR burst; the R channel is drained in
+ * background so that the first beats can be consumed while the rest of the burst is still in flight.
+ * Writes are posted into a write-combining buffer of the same size and sent as a single burst when a non-contiguous
+ * write, a read miss or a flush operation (size equal to zero) is performed; a completed flush also invalidates the read buffer.
+ *
+*/
+
+const std::string& sel = _ports_in[3].name;
+const std::string& size = _ports_in[4].name;
+const std::string& din = _ports_in[5].name;
+const std::string& addr = _ports_in[6].name;
+const std::string& awready = _ports_in[7].name;
+const std::string& wready = _ports_in[8].name;
+const std::string& bvalid = _ports_in[9].name;
+const std::string& arready = _ports_in[11].name;
+const std::string& rvalid = _ports_in[12].name;
+const std::string& rdata = _ports_in[13].name;
+const std::string& rlast = _ports_in[15].name;
+const std::string& done = _ports_out[0].name;
+const std::string& dout = _ports_out[1].name;
+
+unsigned int dataWidth = _ports_in[13].type_size;
+unsigned int nBytes = dataWidth / 8;
+unsigned int offBits = 32u - static_cast<unsigned>(__builtin_clz(nBytes - 1));
+unsigned int addrWidth = _ports_out[3].type_size;
+unsigned int burst = _ports_out[13].alignment > 1 ? _ports_out[13].alignment : 1;
+unsigned int idxBits = burst == 1 ? 1 : (32u - static_cast<unsigned>(__builtin_clz(burst - 1)));
+unsigned int wordWidth = addrWidth - offBits;
+/// number of bus words in a 4KB page: AXI4 bursts cannot cross it
+unsigned int pageBits = 12 > offBits ? 12 - offBits : 0;
+bool checkPage = addrWidth > 12 && pageBits > idxBits;
+
+std::cout << "localparam S_IDLE=3'd0, S_AW=3'd1, S_W=3'd2, S_B=3'd3, S_AR=3'd4;\n";
+std::cout << "integer ii=0;\n";
+std::cout << "reg [2:0] state 1INIT_ZERO_VALUE;\n";
+std::cout << "reg started 1INIT_ZERO_VALUE;\n";
+std::cout << "wire active;\n";
+std::cout << "reg done0;\n";
+std::cout << "wire [" << wordWidth << "-1:0] waddr;\n";
+std::cout << "wire [" << offBits << "-1:0] boff;\n";
+std::cout << "wire [" << dataWidth << "-1:0] wdata_in;\n";
+std::cout << "wire [" << dataWidth << "-1:0] wdata_sh;\n";
+std::cout << "wire [" << nBytes << "-1:0] wmask;\n";
+/// read line buffer
+std::cout << "reg [" << dataWidth << "-1:0] rbuf [0:" << burst << "-1];\n";
+std::cout << "reg [" << burst << "-1:0] rvld 1INIT_ZERO_VALUE;\n";
+std::cout << "reg [" << wordWidth << "-1:0] rbase 1INIT_ZERO_VALUE;\n";
+std::cout << "reg [" << idxBits << ":0] rcnt 1INIT_ZERO_VALUE;\n";
+std::cout << "reg [" << idxBits << ":0] rfill 1INIT_ZERO_VALUE;\n";
+std::cout << "reg rline 1INIT_ZERO_VALUE;\n";
+std::cout << "reg rinflight 1INIT_ZERO_VALUE;\n";
+std::cout << "wire [" << wordWidth << "-1:0] rdelta;\n";
+std::cout << "wire [" << idxBits << "-1:0] ridx;\n";
+std::cout << "wire rhit_line;\n";
+std::cout << "wire rhit;\n";
+std::cout << "wire [" << idxBits << ":0] rlen;\n";
+/// write combining buffer
+std::cout << "reg [" << dataWidth << "-1:0] wbuf [0:" << burst << "-1];\n";
+std::cout << "reg [" << nBytes << "-1:0] wstb [0:" << burst << "-1];\n";
+std::cout << "reg [" << wordWidth << "-1:0] wbase 1INIT_ZERO_VALUE;\n";
+std::cout << "reg [" << idxBits << ":0] wcnt 1INIT_ZERO_VALUE;\n";
+std::cout << "reg [" << idxBits << ":0] wsent 1INIT_ZERO_VALUE;\n";
+std::cout << "wire [" << wordWidth << "-1:0] wdelta;\n";
+std::cout << "wire whit;\n";
+std::cout << "wire wappend;\n";
+std::cout << "wire is_read;\n";
+std::cout << "wire is_write;\n";
+std::cout << "wire is_flush;\n";
+
+std::cout << "assign active = " << _ports_in[2].name << "[0] | started;\n";
+std::cout << "assign waddr = " << addr << "[" << addrWidth << "-1:" << offBits << "];\n";
+std::cout << "assign boff = " << addr << "[" << offBits << "-1:0];\n";
+std::cout << "assign wdata_in = " << din << ";\n";
+std::cout << "assign wdata_sh = wdata_in << {boff, 3'b0};\n";
+std::cout << "assign wmask = ({" << nBytes << "{1'b1}} >> (" << nBytes << " - ((" << size << " + 7) >> 3))) << boff;\n";
+std::cout << "assign is_read = active & !" << sel << "[0];\n";
+std::cout << "assign is_write = active & " << sel << "[0] & (|" << size << ");\n";
+std::cout << "assign is_flush = active & " << sel << "[0] & !(|" << size << ");\n";
+
+std::cout << "assign rdelta = waddr - rbase;\n";
+std::cout << "assign ridx = rdelta[" << idxBits << "-1:0];\n";
+std::cout << "assign rhit_line = rline && rdelta < rcnt;\n";
+std::cout << "assign rhit = rhit_line && rvld[ridx];\n";
+if(checkPage)
+   std::cout << "assign rlen = ({1'b1, " << pageBits << "'d0} - waddr[" << pageBits << "-1:0]) > " << burst << " ? " << burst << " : ({1'b1, " << pageBits << "'d0} - waddr[" << pageBits << "-1:0]);\n";
+else
+   std::cout << "assign rlen = " << burst << ";\n";
+
+std::cout << "assign wdelta = waddr - wbase;\n";
+std::cout << "assign whit = wcnt != 0 && wdelta < wcnt;\n";
+if(checkPage)
+   std::cout << "assign wappend = wcnt == 0 || (wdelta == wcnt && wcnt < " << burst << " && waddr[" << wordWidth << "-1:" << pageBits << "] == wbase[" << wordWidth << "-1:" << pageBits << "]);\n";
+else
+   std::cout << "assign wappend = wcnt == 0 || (wdelta == wcnt && wcnt < " << burst << ");\n";
+
+/// an operation is completed in the same cycle when it hits the buffers
+std::cout << "always @(*)\n";
+std::cout << "begin\n";
+std::cout << "  done0 = 1'b0;\n";
+std::cout << "  if(state == S_IDLE)\n";
+std::cout << "    done0 = (is_read & rhit) | (is_write & (whit | wappend)) | (is_flush & wcnt == 0);\n";
+std::cout << "end\n";
+std::cout << "assign " << done << " = done0;\n";
+std::cout << "assign " << dout << " = rbuf[ridx] >> {boff, 3'b0};\n";
+
+std::cout << "always @(posedge clock 1RESET_EDGE)\n";
+std::cout << "  if (1RESET_VALUE)\n";
+std::cout << "    started <= 1'b0;\n";
+std::cout << "  else\n";
+std::cout << "    started <= active & !done0;\n";
+
+/// AXI4 channels
+std::cout << "assign " << _ports_out[2].name << " = state == S_AW;\n";
+std::cout << "assign " << _ports_out[3].name << " = {wbase, " << offBits << "'d0};\n";
+std::cout << "assign " << _ports_out[4].name << " = wcnt - 1;\n";
+std::cout << "assign " << _ports_out[5].name << " = " << offBits << ";\n";
+std::cout << "assign " << _ports_out[6].name << " = 2'b01;\n";
+std::cout << "assign " << _ports_out[7].name << " = state == S_W;\n";
+std::cout << "assign " << _ports_out[8].name << " = wbuf[wsent[" << idxBits << "-1:0]];\n";
+std::cout << "assign " << _ports_out[9].name << " = wstb[wsent[" << idxBits << "-1:0]];\n";
+std::cout << "assign " << _ports_out[10].name << " = wsent == wcnt - 1;\n";
+std::cout << "assign " << _ports_out[11].name << " = state == S_B;\n";
+std::cout << "assign " << _ports_out[12].name << " = state == S_AR;\n";
+std::cout << "assign " << _ports_out[13].name << " = {rbase, " << offBits << "'d0};\n";
+std::cout << "assign " << _ports_out[14].name << " = rcnt - 1;\n";
+std::cout << "assign " << _ports_out[15].name << " = " << offBits << ";\n";
+std::cout << "assign " << _ports_out[16].name << " = 2'b01;\n";
+std::cout << "assign " << _ports_out[17].name << " = rinflight;\n";
+
+std::cout << "always @(posedge clock 1RESET_EDGE)\n";
+std::cout << "  if (1RESET_VALUE)\n";
+std::cout << "  begin\n";
+std::cout << "    state <= S_IDLE;\n";
+std::cout << "    rvld <= 0;\n";
+std::cout << "    rbase <= 0;\n";
+std::cout << "    rcnt <= 0;\n";
+std::cout << "    rfill <= 0;\n";
+std::cout << "    rline <= 1'b0;\n";
+std::cout << "    rinflight <= 1'b0;\n";
+std::cout << "    wbase <= 0;\n";
+std::cout << "    wcnt <= 0;\n";
+std::cout << "    wsent <= 0;\n";
+std::cout << "  end\n";
+std::cout << "  else\n";
+std::cout << "  begin\n";
+/// background fill of the read line buffer
+std::cout << "    if(rinflight && " << rvalid << ")\n";
+std::cout << "    begin\n";
+std::cout << "      rbuf[rfill[" << idxBits << "-1:0]] <= " << rdata << ";\n";
+std::cout << "      rvld[rfill[" << idxBits << "-1:0]] <= 1'b1;\n";
+std::cout << "      rfill <= rfill + 1;\n";
+std::cout << "      if(" << rlast << ")\n";
+std::cout << "        rinflight <= 1'b0;\n";
+std::cout << "    end\n";
+std::cout << "    case(state)\n";
+std::cout << "      S_IDLE:\n";
+std::cout << "        if(is_write)\n";
+std::cout << "        begin\n";
+std::cout << "          if(whit)\n";
+std::cout << "          begin\n";
+std::cout << "            for(ii=0; ii<" << nBytes << "; ii=ii+1)\n";
+std::cout << "              if(wmask[ii])\n";
+std::cout << "                wbuf[wdelta[" << idxBits << "-1:0]][ii*8+:8] <= wdata_sh[ii*8+:8];\n";
+std::cout << "            wstb[wdelta[" << idxBits << "-1:0]] <= wstb[wdelta[" << idxBits << "-1:0]] | wmask;\n";
+std::cout << "          end\n";
+std::cout << "          else if(wappend)\n";
+std::cout << "          begin\n";
+std::cout << "            if(wcnt == 0)\n";
+std::cout << "              wbase <= waddr;\n";
+std::cout << "            wbuf[wcnt[" << idxBits << "-1:0]] <= wdata_sh;\n";
+std::cout << "            wstb[wcnt[" << idxBits << "-1:0]] <= wmask;\n";
+std::cout << "            wcnt <= wcnt + 1;\n";
+std::cout << "          end\n";
+std::cout << "          else\n";
+std::cout << "            state <= S_AW;\n";
+/// keep the read line buffer coherent with the posted writes
+std::cout << "          if((whit | wappend) && rhit_line)\n";
+std::cout << "          begin\n";
+std::cout << "            if(rvld[ridx])\n";
+std::cout << "            begin\n";
+std::cout << "              for(ii=0; ii<" << nBytes << "; ii=ii+1)\n";
+std::cout << "                if(wmask[ii])\n";
+std::cout << "                  rbuf[ridx][ii*8+:8] <= wdata_sh[ii*8+:8];\n";
+std::cout << "            end\n";
+std::cout << "            else\n";
+std::cout << "              rline <= 1'b0;\n";
+std::cout << "          end\n";
+std::cout << "        end\n";
+std::cout << "        else if(is_flush)\n";
+std::cout << "        begin\n";
+std::cout << "          if(wcnt != 0)\n";
+std::cout << "            state <= S_AW;\n";
+std::cout << "          else\n";
+std::cout << "            rline <= 1'b0;\n";
+std::cout << "        end\n";
+std::cout << "        else if(is_read && !rhit_line)\n";
+std::cout << "        begin\n";
+std::cout << "          if(wcnt != 0)\n";
+std::cout << "            state <= S_AW;\n";
+std::cout << "          else if(!rinflight)\n";
+std::cout << "          begin\n";
+std::cout << "            rbase <= waddr;\n";
+std::cout << "            rcnt <= rlen;\n";
+std::cout << "            rfill <= 0;\n";
+std::cout << "            rvld <= 0;\n";
+std::cout << "            rline <= 1'b1;\n";
+std::cout << "            state <= S_AR;\n";
+std::cout << "          end\n";
+std::cout << "        end\n";
+std::cout << "      S_AW:\n";
+std::cout << "        if(" << awready << ")\n";
+std::cout << "        begin\n";
+std::cout << "          wsent <= 0;\n";
+std::cout << "          state <= S_W;\n";
+std::cout << "        end\n";
+std::cout << "      S_W:\n";
+std::cout << "        if(" << wready << ")\n";
+std::cout << "        begin\n";
+std::cout << "          wsent <= wsent + 1;\n";
+std::cout << "          if(wsent == wcnt - 1)\n";
+std::cout << "            state <= S_B;\n";
+std::cout << "        end\n";
+std::cout << "      S_B:\n";
+std::cout << "        if(" << bvalid << ")\n";
+std::cout << "        begin\n";
+std::cout << "          wcnt <= 0;\n";
+std::cout << "          state <= S_IDLE;\n";
+std::cout << "        end\n";
+std::cout << "      S_AR:\n";
+std::cout << "        if(" << arready << ")\n";
+std::cout << "        begin\n";
+std::cout << "          rinflight <= 1'b1;\n";
+std::cout << "          state <= S_IDLE;\n";
+std::cout << "        end\n";
+std::cout << "      default:\n";
+std::cout << "        state <= S_IDLE;\n";
+std::cout << "    endcase\n";
+std::cout << "  end\n";
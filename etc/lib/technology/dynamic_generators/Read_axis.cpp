@@ -0,0 +1,60 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                 URL: http://trac.ws.dei.polimi.it/panda
+ *                      Microarchitectures Laboratory
+ *                       Politecnico di Milano - DEI
+ *             ***********************************************
+ *              Copyright (c) 2018-2020 Politecnico di Milano
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the
+ *   Free Software Foundation, Inc.,
+ *   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+*/
+/**
+ * @file Read_axis.cpp
+ * @brief Snippet for the Read_axis dynamic generator.
+ *
+ * Each read operation pops one beat from the AXI4-Stream consumed by the design: TREADY is asserted while the operation is
+ * pending and the operation completes in the cycle where TVALID and TREADY are both high.
+ * Buffering on the input side is left to the producer.
+ *
+*/
+
+const std::string& start = _ports_in[2].name;
+const std::string& tdata = _ports_in[4].name;
+const std::string& tvalid = _ports_in[5].name;
+const std::string& done = _ports_out[0].name;
+const std::string& dout = _ports_out[1].name;
+const std::string& tready = _ports_out[2].name;
+
+std::cout << "reg started 1INIT_ZERO_VALUE;\n";
+std::cout << "wire pending;\n";
+std::cout << "assign pending = " << start << " | started;\n";
+std::cout << "always @(posedge clock 1RESET_EDGE)\n";
+std::cout << "  if (1RESET_VALUE)\n";
+std::cout << "    started <= 1'b0;\n";
+std::cout << "  else\n";
+std::cout << "    started <= pending & !" << tvalid << ";\n";
+std::cout << "assign " << tready << " = pending;\n";
+std::cout << "assign " << done << " = pending & " << tvalid << ";\n";
+std::cout << "assign " << dout << " = " << tdata << ";\n";
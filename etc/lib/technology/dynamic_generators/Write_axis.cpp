@@ -0,0 +1,136 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                 URL: http://trac.ws.dei.polimi.it/panda
+ *                      Microarchitectures Laboratory
+ *                       Politecnico di Milano - DEI
+ *             ***********************************************
+ *              Copyright (c) 2018-2020 Politecnico di Milano
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the
+ *   Free Software Foundation, Inc.,
+ *   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+*/
+/**
+ * @file Write_axis.cpp
+ * @brief Snippet for the Write_axis dynamic generator.
+ *
+ * Each write operation pushes one beat into a FIFO of alignment(TDATA) entries draining on the AXI4-Stream produced by the
+ * design, so that the datapath is stalled only when the FIFO is full.
+ * The newest beat is held back until it is known whether it closes the packet: it is released by the next write, or tagged
+ * with TLAST by a flush operation (size equal to zero), which completes once the FIFO is empty.
+ * In simulation the adapter reports the maximum occupancy of the FIFO and the number of cycles a write waited on a full
+ * FIFO at the end of each packet; the simulation tool turns this report into the FIFO depths of the next synthesis.
+ *
+*/
+
+const std::string& start = _ports_in[2].name;
+const std::string& size = _ports_in[3].name;
+const std::string& din = _ports_in[4].name;
+const std::string& tready = _ports_in[6].name;
+const std::string& done = _ports_out[0].name;
+const std::string& tdata = _ports_out[1].name;
+const std::string& tvalid = _ports_out[2].name;
+const std::string& tlast = _ports_out[3].name;
+
+unsigned int depth = _ports_out[1].alignment > 1 ? _ports_out[1].alignment : 1;
+unsigned int ptrBits = depth == 1 ? 0 : (32u - static_cast<unsigned>(__builtin_clz(depth - 1)));
+unsigned int countBits = 32u - static_cast<unsigned>(__builtin_clz(depth));
+/// with a single entry the pointers never move
+std::string head = depth == 1 ? "0" : "head";
+std::string tail = depth == 1 ? "0" : "tail";
+std::string last_pushed = depth == 1 ? "0" : "tail - 1'b1";
+/// name of the parameter as printed in the occupancy report
+std::string parameter = tdata.substr(tdata[0] == '_' ? 1 : 0, tdata.size() - (tdata[0] == '_' ? 1 : 0) - std::string("_TDATA").size());
+
+std::cout << "reg [BITSIZE_" << tdata << "-1:0] fifo_data [0:" << depth << "-1];\n";
+std::cout << "reg [" << depth << "-1:0] fifo_last 1INIT_ZERO_VALUE;\n";
+if(depth > 1)
+{
+   std::cout << "reg [" << ptrBits << "-1:0] head 1INIT_ZERO_VALUE;\n";
+   std::cout << "reg [" << ptrBits << "-1:0] tail 1INIT_ZERO_VALUE;\n";
+}
+std::cout << "reg [" << countBits << "-1:0] count 1INIT_ZERO_VALUE;\n";
+std::cout << "reg started 1INIT_ZERO_VALUE;\n";
+std::cout << "wire pending;\n";
+std::cout << "wire is_end;\n";
+std::cout << "wire push;\n";
+std::cout << "wire pop;\n";
+std::cout << "wire head_valid;\n";
+std::cout << "assign pending = " << start << " | started;\n";
+std::cout << "assign is_end = " << size << " == 0;\n";
+std::cout << "assign push = pending & !is_end & count != " << depth << ";\n";
+std::cout << "assign head_valid = count != 0 && (count != 1 || fifo_last[" << head << "] || (pending && !is_end));\n";
+std::cout << "assign pop = head_valid & " << tready << ";\n";
+std::cout << "assign " << tvalid << " = head_valid;\n";
+std::cout << "assign " << tdata << " = fifo_data[" << head << "];\n";
+std::cout << "assign " << tlast << " = fifo_last[" << head << "];\n";
+std::cout << "assign " << done << " = pending & (is_end ? count == 0 : count != " << depth << ");\n";
+
+std::cout << "always @(posedge clock)\n";
+std::cout << "  if (push)\n";
+std::cout << "    fifo_data[" << tail << "] <= " << din << ";\n";
+
+std::cout << "always @(posedge clock 1RESET_EDGE)\n";
+std::cout << "  if (1RESET_VALUE)\n";
+std::cout << "  begin\n";
+std::cout << "    started <= 1'b0;\n";
+std::cout << "    fifo_last <= 0;\n";
+if(depth > 1)
+{
+   std::cout << "    head <= 0;\n";
+   std::cout << "    tail <= 0;\n";
+}
+std::cout << "    count <= 0;\n";
+std::cout << "  end\n";
+std::cout << "  else\n";
+std::cout << "  begin\n";
+std::cout << "    started <= pending & !" << done << ";\n";
+std::cout << "    if (push)\n";
+std::cout << "    begin\n";
+std::cout << "      fifo_last[" << tail << "] <= 1'b0;\n";
+if(depth > 1)
+   std::cout << "      tail <= tail + 1'b1;\n";
+std::cout << "    end\n";
+std::cout << "    else if (pending & is_end & count != 0)\n";
+std::cout << "      fifo_last[" << last_pushed << "] <= 1'b1;\n";
+if(depth > 1)
+{
+   std::cout << "    if (pop)\n";
+   std::cout << "      head <= head + 1'b1;\n";
+}
+std::cout << "    count <= count + push - pop;\n";
+std::cout << "  end\n";
+
+std::cout << "// synthesis translate_off\n";
+std::cout << "integer max_occupancy = 0;\n";
+std::cout << "integer stall_cycles = 0;\n";
+std::cout << "always @(posedge clock)\n";
+std::cout << "begin\n";
+std::cout << "  if (count > max_occupancy)\n";
+std::cout << "    max_occupancy = count;\n";
+std::cout << "  if (pending && !is_end && count == " << depth << ")\n";
+std::cout << "    stall_cycles = stall_cycles + 1;\n";
+std::cout << "  if (pending && is_end && count == 0)\n";
+std::cout << "    $display(\"AXIS_FIFO_OCCUPANCY " << parameter << " %0d %0d " << depth << "\", max_occupancy, stall_cycles);\n";
+std::cout << "end\n";
+std::cout << "// synthesis translate_on\n";
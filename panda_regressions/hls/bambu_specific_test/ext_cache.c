@@ -0,0 +1,20 @@
+struct __attribute__((packed)) record
+{
+  unsigned char tag;
+  unsigned int value;
+};
+
+void cache_walk(unsigned char buf[64], unsigned int table[64])
+{
+  struct record* r = (struct record*)buf;
+  unsigned int i;
+  /* with a 5-byte stride some of the 4-byte fields cross a cache line */
+  for(i = 0; i < 12; ++i)
+  {
+    r[i].value = r[i].value * 3u + r[i].tag;
+    r[i].tag ^= 0x5a;
+  }
+  /* strided updates evict dirty lines of a small cache */
+  for(i = 0; i < 64; ++i)
+    table[(i * 17u) & 63u] += i + r[i % 12u].tag;
+}
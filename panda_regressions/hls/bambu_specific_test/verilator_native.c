@@ -0,0 +1,10 @@
+int accumulate(int a[8], int n)
+{
+  int i, s = 0;
+  for(i = 0; i < 8; ++i)
+  {
+    s += a[i] * n;
+    a[i] = s;
+  }
+  return s;
+}
@@ -0,0 +1,14 @@
+static int select_store(int* p, int* q, int c)
+{
+  int* r = c ? p : q;
+  *r += 3;
+  return *p - *q;
+}
+
+int alias(int a[4], int b[4], int c)
+{
+  int i, s = 0;
+  for(i = 0; i < 4; ++i)
+    s += select_store(&a[i], c > i ? &b[i] : &a[i], c & 1);
+  return s;
+}
@@ -0,0 +1,22 @@
+#define N 16
+#define TAPS 4
+
+int fir(int in[N], int out[N])
+{
+  int shift[TAPS + N];
+  static const int coeff[TAPS] = {3, -1, 4, 2};
+  int i, j, acc = 0;
+  for(i = 0; i < TAPS; ++i)
+    shift[i] = 0;
+  for(i = 0; i < N; ++i)
+    shift[TAPS + i] = in[i];
+  for(i = 0; i < N; ++i)
+  {
+    int sum = 0;
+    for(j = 0; j < TAPS; ++j)
+      sum += coeff[j] * shift[i + j + 1];
+    out[i] = sum;
+    acc += sum;
+  }
+  return acc;
+}
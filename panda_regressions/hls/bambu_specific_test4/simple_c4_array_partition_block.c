@@ -0,0 +1,14 @@
+int pick(int in[8], int k)
+{
+  int buf[8];
+  buf[0] = in[0] * 3;
+  buf[1] = in[1] - 1;
+  buf[2] = in[2] * 4;
+  buf[3] = in[3] + 2;
+  buf[4] = in[4] * 5;
+  buf[5] = in[5] - 9;
+  buf[6] = in[6] * 2;
+  buf[7] = in[7] + 6;
+  k = k & 3;
+  return buf[k] * buf[k + 4];
+}
@@ -0,0 +1,10 @@
+#pragma HLS_interface a axis
+#pragma HLS_interface b axis
+#pragma HLS_interface c axis
+#pragma HLS_interface d axis
+void sum3numbers(short a[8], short b[8], short c[8], short d[8])
+{
+  unsigned i;
+  for(i=0;i<8;++i)
+    d[i] = a[i] + b[i] + c[i];
+}
@@ -0,0 +1,16 @@
+static const float coeffs[4] = {0.5f, -1.25f, 3.0f, 1e-3f};
+
+double blend(float a[4], double b)
+{
+  int i;
+  float s = 0.0f;
+  for(i = 0; i < 4; ++i)
+    s += a[i] * coeffs[i];
+  if(b > 1e300)
+    return __builtin_inf();
+  if(b != b)
+    return -__builtin_inf();
+  if(b < -1e300)
+    return __builtin_nan("");
+  return s * 0.1 - b * 2.5e-7;
+}
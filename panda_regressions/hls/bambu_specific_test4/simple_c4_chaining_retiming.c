@@ -0,0 +1,11 @@
+int mix(int a[8], int b[8])
+{
+  int i, acc = 0;
+  for(i = 0; i < 8; ++i)
+  {
+    int x = a[i] ^ (b[i] + acc);
+    int y = (x + a[i]) ^ (b[i] - i);
+    acc = (acc + y) ^ (x - b[i]);
+  }
+  return acc;
+}
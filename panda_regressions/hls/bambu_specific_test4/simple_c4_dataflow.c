@@ -0,0 +1,25 @@
+#define N 8
+
+__attribute__((noinline)) void scale(int in[N], int tmp[N])
+{
+  int i;
+  for(i = 0; i < N; ++i)
+    tmp[i] = in[i] * 3 + 1;
+}
+
+__attribute__((noinline)) void accumulate(int tmp[N], int out[N])
+{
+  int i, acc = 0;
+  for(i = 0; i < N; ++i)
+  {
+    acc += tmp[i];
+    out[i] = acc;
+  }
+}
+
+void pipeline(int in[N], int out[N])
+{
+  int tmp[N];
+  scale(in, tmp);
+  accumulate(tmp, out);
+}
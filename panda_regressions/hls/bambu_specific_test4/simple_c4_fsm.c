@@ -0,0 +1,26 @@
+/* straight-line controller: the accesses to the same array are serialized in at least three states without condition inputs */
+void sequence(int a[8], int out[8])
+{
+  out[0] = a[7];
+  out[1] = a[6] + a[0];
+  out[2] = a[5] - a[1];
+  out[3] = a[4] ^ a[2];
+  out[4] = a[3];
+}
+
+/* the two branches end with the same accesses, so their last states are candidates for merging */
+void branches(int sel, int a[8], int out[8])
+{
+  if(sel > 0)
+  {
+    out[5] = a[0] * sel;
+    out[6] = a[1];
+    out[7] = a[2];
+  }
+  else
+  {
+    out[5] = a[3] - sel;
+    out[6] = a[1];
+    out[7] = a[2];
+  }
+}
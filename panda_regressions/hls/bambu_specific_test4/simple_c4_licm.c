@@ -0,0 +1,11 @@
+int licm(int a[8], int k, int d, int n)
+{
+  int i, sum = 0;
+  /* a[k] is invariant only until the store to a[i] overwrites it */
+  for(i = 0; i < n; ++i)
+    a[i] = a[k] + i;
+  /* 100 / d must not be hoisted above the loop guard when n <= 0 */
+  for(i = 0; i < n; ++i)
+    sum += a[i] * (100 / d);
+  return sum;
+}
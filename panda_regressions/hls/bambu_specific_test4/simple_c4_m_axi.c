@@ -0,0 +1,10 @@
+#pragma HLS_interface a m_axi
+#pragma HLS_interface b m_axi
+#pragma HLS_interface c m_axi
+#pragma HLS_interface d m_axi
+void sum3numbers(short a[8], short b[8], short c[8], short d[8])
+{
+  unsigned i;
+  for(i=0;i<8;++i)
+    d[i] = a[i] + b[i] + c[i];
+}
@@ -0,0 +1,13 @@
+void mcm(int x, short y, unsigned int z, int out[10])
+{
+  out[0] = x * 7;
+  out[1] = x * 9;
+  out[2] = x * -15;
+  out[3] = x * 63;
+  out[4] = x * 65;
+  out[5] = x * -31;
+  out[6] = y * -255;
+  out[7] = y * 257;
+  out[8] = (int)(z * 1023u);
+  out[9] = (int)(z * 1025u);
+}
@@ -0,0 +1,12 @@
+int image(int in[40], unsigned char bytes[19])
+{
+  int i, s = 0;
+  for(i = 0; i < 40; ++i)
+    s += in[i] * (i + 1);
+  for(i = 0; i < 19; ++i)
+  {
+    s ^= bytes[i] << (i & 7);
+    bytes[i] = bytes[i] + 1;
+  }
+  return s;
+}
@@ -0,0 +1,6 @@
+void gather(int a[16], int b[16], int out[8])
+{
+  int i;
+  for(i = 0; i < 8; ++i)
+    out[i] = a[2 * i] + b[15 - 2 * i] - a[2 * i + 1] * b[i];
+}
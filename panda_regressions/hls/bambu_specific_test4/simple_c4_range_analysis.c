@@ -0,0 +1,20 @@
+int ranges(int n, signed char s)
+{
+  int i, j, acc = 0;
+  unsigned char u = 250;
+  signed char neg;
+  unsigned int t;
+  /* counted loop whose 8-bit accumulator wraps around */
+  for(i = 0; i < 10; ++i)
+  {
+    u += 3;
+    acc += u;
+  }
+  /* negative ranges */
+  neg = s < -10 ? s : -10;
+  for(j = -8; j < n; j += 2)
+    acc -= j * neg;
+  /* copy of a negative value into an unsigned variable */
+  t = (unsigned int)(int)neg;
+  return acc + (int)(t >> 28);
+}
@@ -0,0 +1,9 @@
+int share(signed char a, int b, signed char c)
+{
+  signed char narrow = a - c;
+  int wide = narrow * 3;
+  wide = wide - b;
+  signed char narrow2 = (signed char)(wide >> 2) - c;
+  long long wider = (long long)wide * b;
+  return (int)(wider >> 8) + narrow2;
+}
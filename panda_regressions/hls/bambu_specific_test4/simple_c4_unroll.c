@@ -0,0 +1,10 @@
+#define N 32
+
+int dot(int a[N], int b[N])
+{
+  int i, sum = 0;
+#pragma unroll 4
+  for(i = 0; i < N; ++i)
+    sum += a[i] * b[i];
+  return sum;
+}
@@ -396,6 +396,8 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "        Possible values for <type> and related interfaces:\n"
       << "            MINIMAL  -  (minimal interface - default)\n"
       << "            INFER    -  (top function is built with an hardware interface inferred from the pragmas or from the top function signature)\n"
+      << "                        The length of the bursts issued by the m_axi parameters is set with\n"
+      << "                        --panda-parameter=m-axi-burst-length=<n> (default 16, at most 256).\n"
       << "            WB4      -  (WishBone 4 interface)\n"
 #if HAVE_EXPERIMENTAL
       << "            AXI4LITE -  (AXI4-Lite interface)\n"
@@ -590,7 +592,11 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            D00 - no extra delay (default)\n"
       << "            D10 - 1 clock cycle extra-delay for LOAD, 0 for STORE\n"
       << "            D11 - 1 clock cycle extra-delay for LOAD, 1 for STORE\n"
-      << "            D21 - 2 clock cycle extra-delay for LOAD, 1 for STORE\n\n"
+      << "            D21 - 2 clock cycle extra-delay for LOAD, 1 for STORE\n"
+      << "        With MEM_ACC_NN, D00 and --panda-parameter=nonblocking-memory=1 the independent\n"
+      << "        accesses to the external memory issued in the same control step are overlapped\n"
+      << "        and complete out of order. Each access still completes before its control step\n"
+      << "        is left: only the bounded operations of the same step run during the access.\n\n"
       << "    --memory-banks-number=<n>\n"
       << "        Define the number of memory banks.\n\n"
       << "    --sparse-memory[=on/off]\n"
@@ -726,16 +732,30 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            PERIOD          - Actual clock period\n"
       << "            REGISTERS       - number of registers\n"
       << "\n"
-#if HAVE_EXPERIMENTAL
       << "    --evaluation-mode[=type]\n"
       << "        Perform evaluation of the results:\n"
-      << "            EXACT:  based on actual synthesis and simulation (default)\n"
-      << "            LINEAR: based on linear regression. Unlike EXACT it supports\n"
-      << "                    only the evaluation of the following objectives:\n"
-      << "                    - AREA\n"
-      << "                    - CLOCK_SLACK\n"
-      << "                    - TIME\n"
+      << "            EXACT:      based on actual synthesis and simulation (default)\n"
+      << "            ANALYTICAL: based on an analytical model of the generated\n"
+      << "                        architecture, calibrated on the results stored in\n"
+      << "                        the synthesis cache (--panda-parameter=synthesis-cache=<dir>)\n"
+      << "                        and weighted on the host profiling (--host-profiling)\n"
+      << "                        when available. Unlike EXACT it supports only the\n"
+      << "                        evaluation of the following objectives:\n"
+      << "                        - AREA\n"
+      << "                        - BRAMS\n"
+      << "                        - CYCLES\n"
+      << "                        - DSPS\n"
+      << "                        - REGISTERS\n"
+      << "                        - TOTAL_CYCLES\n"
+#if HAVE_EXPERIMENTAL
+      << "            LINEAR:     based on linear regression. Unlike EXACT it supports\n"
+      << "                        only the evaluation of the following objectives:\n"
+      << "                        - AREA\n"
+      << "                        - CLOCK_SLACK\n"
+      << "                        - TIME\n"
+#endif
       << "\n"
+#if HAVE_EXPERIMENTAL
       << "    --timing-simulation\n"
       << "        Perform a simulation considering the timing delays.\n\n"
       << "    --timing-violation\n"
@@ -847,9 +867,12 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "             yes   - all inputs are registered\n"
       << "             no    - none of the inputs is registered\n\n"
       << "    --fsm-encoding=value\n"
-      << "             auto    - it depends on the target technology. VVD prefers one encoding while the other are fine with the standard binary encoding. (default)\n"
+      << "             auto    - it depends on the target technology and on the controller: one-hot encoding for small VVD\n"
+      << "                       controllers and for small controllers with few transitions per state, Gray encoding for\n"
+      << "                       large controllers mostly moving between consecutive states, binary encoding otherwise (default)\n"
       << "             one-hot - one hot encoding\n"
-      << "             binary  - binary encoding\n\n"
+      << "             binary  - binary encoding\n"
+      << "             gray    - Gray encoding\n\n"
       << "    --cprf=value\n"
       << "        Clock Period Resource Fraction (default = 1.0).\n\n"
       << "    --DSP-allocation-coefficient=value\n"
@@ -1162,8 +1185,8 @@ int BambuParameter::Exec()
 #endif
       /// evaluation options
       {"evaluation", optional_argument, nullptr, OPT_EVALUATION},
-#if HAVE_EXPERIMENTAL
       {"evaluation-mode", required_argument, nullptr, OPT_EVALUATION_MODE},
+#if HAVE_EXPERIMENTAL
       {"timing-simulation", no_argument, nullptr, 0},
       {"timing-violation", no_argument, nullptr, OPT_TIMING_VIOLATION},
 #endif
@@ -1725,6 +1748,15 @@ int BambuParameter::Exec()
                       ;
                   add_evaluation_objective_string(objective_string, to_add);
                }
+               else if(isOption(OPT_evaluation_mode) and getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ANALYTICAL)
+               {
+                  add_evaluation_objective_string(objective_string, "AREA,"
+                                                                    "REGISTERS,"
+                                                                    "DSPS,"
+                                                                    "BRAMS,"
+                                                                    "CYCLES,"
+                                                                    "TOTAL_CYCLES");
+               }
 #if HAVE_EXPERIMENTAL
                else if(isOption(OPT_evaluation_mode) and getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ESTIMATION)
                {
@@ -1745,7 +1777,6 @@ int BambuParameter::Exec()
             setOption(OPT_evaluation_objectives, objective_string);
             break;
          }
-#if HAVE_EXPERIMENTAL
          case OPT_EVALUATION_MODE:
          {
             // set OPT_evaluation, because the evaluation has to be performed
@@ -1758,23 +1789,28 @@ int BambuParameter::Exec()
              */
             if(optarg == nullptr)
             {
-               throw "BadParameters: evaluation mode must be specified, use EXACT or LINEAR";
+               throw "BadParameters: evaluation mode must be specified, use EXACT or ANALYTICAL";
             }
             else if(std::string(optarg) == "EXACT")
             {
                setOption(OPT_evaluation_mode, Evaluation_Mode::EXACT);
             }
+            else if(std::string(optarg) == "ANALYTICAL")
+            {
+               setOption(OPT_evaluation_mode, Evaluation_Mode::ANALYTICAL);
+            }
+#if HAVE_EXPERIMENTAL
             else if(std::string(optarg) == "LINEAR")
             {
                setOption(OPT_evaluation_mode, Evaluation_Mode::ESTIMATION);
             }
+#endif
             else
             {
-               throw "BadParameters: evaluation mode not correctly specified, use EXACT or LINEAR";
+               throw "BadParameters: evaluation mode not correctly specified, use EXACT or ANALYTICAL";
             }
             break;
          }
-#endif
          case OPT_SIMULATE:
          {
             /*
@@ -2039,6 +2075,10 @@ int BambuParameter::Exec()
          }
          case OPT_FSM_ENCODING:
          {
+            if(std::string(optarg) != "auto" and std::string(optarg) != "one-hot" and std::string(optarg) != "binary" and std::string(optarg) != "gray")
+            {
+               THROW_ERROR("BadParameters: --fsm-encoding value not recognized: " + std::string(optarg));
+            }
             setOption(OPT_fsm_encoding, optarg);
             break;
          }
@@ -2885,6 +2925,14 @@ void BambuParameter::CheckParameters()
             THROW_ERROR("BadParameters: evaluation mode EXACT don't support the evaluation objectives");
          }
       }
+      else if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ANALYTICAL)
+      {
+         const auto is_valid_evaluation_mode = [](const std::string& s) -> bool { return s == "AREA" or s == "REGISTERS" or s == "DSPS" or s == "BRAMS" or s == "CYCLES" or s == "TOTAL_CYCLES"; };
+         if(not all_of(objective_vector.begin(), objective_vector.end(), is_valid_evaluation_mode))
+         {
+            THROW_ERROR("BadParameters: evaluation mode ANALYTICAL don't support the evaluation objectives");
+         }
+      }
 #if HAVE_EXPERIMENTAL
       else if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ESTIMATION)
       {
@@ -3324,6 +3372,10 @@ void BambuParameter::CheckParameters()
    {
       THROW_ERROR("--discrepancy-hw Hardware Discrepancy Analysis only works with function proxies");
    }
+   if(((isOption(OPT_discrepancy) and getOption<bool>(OPT_discrepancy)) or (isOption(OPT_discrepancy_hw) and getOption<bool>(OPT_discrepancy_hw))) and getOption<std::string>(OPT_fsm_encoding) == "gray")
+   {
+      THROW_ERROR("--discrepancy and --discrepancy-hw are not compatible with --fsm-encoding=gray");
+   }
    if(isOption(OPT_discrepancy) and getOption<bool>(OPT_discrepancy))
    {
       if(false
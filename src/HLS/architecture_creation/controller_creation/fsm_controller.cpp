@@ -89,8 +89,10 @@
 /// STL includes
 #include "custom_map.hpp"
 #include "custom_set.hpp"
+#include <algorithm>
 #include <deque>
 #include <list>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -139,6 +141,16 @@ DesignFlowStep_Status fsm_controller::InternalExec()
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Creating state machine representations...");
    std::string state_representation;
    this->create_state_machine(state_representation);
+   /// the state identifiers are observed by the discrepancy analysis
+   if(not(parameters->isOption(OPT_discrepancy) and parameters->getOption<bool>(OPT_discrepancy)) and not(parameters->isOption(OPT_discrepancy_hw) and parameters->getOption<bool>(OPT_discrepancy_hw)) and
+      (not parameters->IsParameter("fsm-minimization") or parameters->GetParameter<int>("fsm-minimization") != 0))
+   {
+      const auto removed_states = minimize_states(state_representation);
+      if(removed_states)
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Merged " + STR(removed_states) + " equivalent states of the controller of " + function_name);
+      }
+   }
    add_correct_transition_memory(state_representation); // if CS is activated some register are memory
 
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Machine encoding");
@@ -545,6 +557,108 @@ void fsm_controller::create_state_machine(std::string& parse)
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Created state machine");
 }
 
+size_t fsm_controller::minimize_states(std::string& parse) const
+{
+   /// a state of the representation: name, outputs and transitions (condition, next state, outputs)
+   struct fsm_state
+   {
+      std::string name;
+      std::string outputs;
+      std::vector<std::vector<std::string>> transitions;
+   };
+   std::vector<std::string> entries = SplitString(parse, ";");
+   THROW_ASSERT(entries.size() > 1, "Wrong fsm description");
+   std::vector<fsm_state> states;
+   std::map<std::string, size_t> state_index;
+   for(size_t i = 1; i < entries.size(); i++)
+   {
+      std::vector<std::string> segments = SplitString(entries[i], ":");
+      std::vector<std::string> state_tokens = SplitString(segments.front(), " \n");
+      state_tokens.erase(std::remove(state_tokens.begin(), state_tokens.end(), ""), state_tokens.end());
+      if(state_tokens.empty())
+         continue;
+      THROW_ASSERT(state_tokens.size() == 2, "Wrong fsm description: " + entries[i]);
+      fsm_state state;
+      state.name = state_tokens.at(0);
+      state.outputs = state_tokens.at(1);
+      for(size_t j = 1; j < segments.size(); j++)
+      {
+         std::vector<std::string> transition = SplitString(segments[j], " \n");
+         transition.erase(std::remove(transition.begin(), transition.end(), ""), transition.end());
+         THROW_ASSERT(transition.size() >= 2, "Wrong fsm description: " + segments[j]);
+         state.transitions.push_back(transition);
+      }
+      state_index[state.name] = states.size();
+      states.push_back(state);
+   }
+   if(states.size() < 2)
+      return 0;
+
+   /// partition refinement starting from the states with the same outputs and transition labels
+   std::vector<size_t> block(states.size());
+   size_t n_blocks = 0;
+   {
+      std::map<std::string, size_t> blocks;
+      for(size_t i = 0; i < states.size(); i++)
+      {
+         std::string key = states[i].outputs;
+         for(const auto& transition : states[i].transitions)
+         {
+            key += ";";
+            for(size_t t = 0; t < transition.size(); t++)
+               key += (t == transition.size() - 2 ? std::string("*") : transition[t]) + " ";
+         }
+         block[i] = blocks.insert(std::make_pair(key, blocks.size())).first->second;
+      }
+      n_blocks = blocks.size();
+   }
+   while(true)
+   {
+      std::map<std::vector<size_t>, size_t> blocks;
+      std::vector<size_t> new_block(states.size());
+      for(size_t i = 0; i < states.size(); i++)
+      {
+         std::vector<size_t> key(1, block[i]);
+         for(const auto& transition : states[i].transitions)
+         {
+            THROW_ASSERT(state_index.count(transition[transition.size() - 2]), "Unknown state " + transition[transition.size() - 2]);
+            key.push_back(block[state_index.at(transition[transition.size() - 2])]);
+         }
+         new_block[i] = blocks.insert(std::make_pair(key, blocks.size())).first->second;
+      }
+      block = new_block;
+      if(blocks.size() == n_blocks)
+         break;
+      n_blocks = blocks.size();
+   }
+   if(n_blocks == states.size())
+      return 0;
+
+   /// the first state of each block represents it; the reset state is the first one
+   std::map<size_t, std::string> representative;
+   for(size_t i = 0; i < states.size(); i++)
+      representative.insert(std::make_pair(block[i], states[i].name));
+   THROW_ASSERT(representative.at(block[0]) == states[0].name, "Reset state has been merged");
+   std::string minimized = entries.front() + "; \n";
+   for(size_t i = 0; i < states.size(); i++)
+   {
+      if(representative.at(block[i]) != states[i].name)
+         continue;
+      minimized += states[i].name + " " + states[i].outputs;
+      for(auto transition : states[i].transitions)
+      {
+         auto& next_state = transition[transition.size() - 2];
+         next_state = representative.at(block[state_index.at(next_state)]);
+         minimized += " :";
+         for(const auto& token : transition)
+            minimized += " " + token;
+      }
+      minimized += "; \n";
+   }
+   parse = minimized;
+   return states.size() - n_blocks;
+}
+
 std::string fsm_controller::get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op, const OpGraphConstRef data)
 {
    if((GET_TYPE(data, op) & TYPE_MULTIIF) != 0)
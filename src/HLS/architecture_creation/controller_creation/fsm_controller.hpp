@@ -62,6 +62,14 @@ class fsm_controller : public ControllerCreatorBaseStep
     */
    std::string get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op, const OpGraphConstRef data);
 
+   /**
+    * Merges the equivalent states of the string representation of the FSM: two states are equivalent when they have the same outputs
+    * and the same transitions (conditions and outputs) towards equivalent states
+    * @param parse is the string representation of the FSM
+    * @return the number of removed states
+    */
+   size_t minimize_states(std::string& parse) const;
+
    /**
     * Execute the step
     * @return the exit status of this step
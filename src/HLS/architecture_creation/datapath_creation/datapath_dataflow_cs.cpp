@@ -0,0 +1,337 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file datapath_dataflow_cs.cpp
+ * @brief Datapath of a function whose calls are executed as concurrent dataflow stages
+ *
+ */
+
+/// Header include
+#include "datapath_dataflow_cs.hpp"
+
+/// behavior includes
+#include "behavioral_helper.hpp"
+#include "function_behavior.hpp"
+
+/// circuit includes
+#include "structural_manager.hpp"
+#include "structural_objects.hpp"
+
+/// constants include
+#include "copyrights_strings.hpp"
+
+/// HLS includes
+#include "hls.hpp"
+#include "hls_manager.hpp"
+#include "hls_target.hpp"
+
+/// HLS/function_allocation include
+#include "omp_functions.hpp"
+
+/// HLS/memory includes
+#include "memory.hpp"
+#include "memory_allocation.hpp"
+#include "memory_cs.hpp"
+
+/// parameter include
+#include "Parameter.hpp"
+
+/// STD includes
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/// technology includes
+#include "technology_manager.hpp"
+#include "technology_node.hpp"
+
+/// tree includes
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
+#include "tree_node.hpp"
+#include "tree_reindex.hpp"
+
+/// utility includes
+#include "dbgPrintHelper.hpp"
+#include "math_function.hpp"
+#include "utility.hpp"
+
+datapath_dataflow_cs::datapath_dataflow_cs(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager, const HLSFlowStep_Type _hls_flow_step_type)
+    : datapath_parallel_cs(_parameters, _HLSMgr, _funId, _design_flow_manager, _hls_flow_step_type)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+datapath_dataflow_cs::~datapath_dataflow_cs() = default;
+
+const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> datapath_dataflow_cs::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+         ret.insert(std::make_tuple(HLSFlowStep_Type::HLS_SYNTHESIS_FLOW, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::CALLED_FUNCTIONS));
+         ret.insert(std::make_tuple(HLSFlowStep_Type::INITIALIZE_HLS, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
+         ret.insert(
+             std::make_tuple(parameters->getOption<HLSFlowStep_Type>(OPT_memory_allocation_algorithm),
+                             HLSFlowStepSpecializationConstRef(new MemoryAllocationSpecialization(parameters->getOption<MemoryAllocation_Policy>(OPT_memory_allocation_policy), parameters->getOption<MemoryAllocation_ChannelsType>(OPT_channels_type))),
+                             HLSFlowStep_Relationship::WHOLE_APPLICATION));
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+DesignFlowStep_Status datapath_dataflow_cs::InternalExec()
+{
+   const auto omp_functions = GetPointer<const OmpFunctions>(HLSMgr->Rfuns);
+   THROW_ASSERT(omp_functions->dataflow_stages.find(funId) != omp_functions->dataflow_stages.end(), "Stages of dataflow function not computed");
+   const auto& stages = omp_functions->dataflow_stages.find(funId)->second;
+   const auto num_stages = static_cast<unsigned int>(stages.size());
+   const auto BH = HLSMgr->CGetFunctionBehavior(funId)->CGetBehavioralHelper();
+   if(num_stages > parameters->getOption<unsigned int>(OPT_num_accelerators))
+   {
+      THROW_ERROR("Dataflow function " + BH->get_function_name() + " has " + STR(num_stages) + " stages but only " + STR(parameters->getOption<unsigned int>(OPT_num_accelerators)) + " accelerators are available: increase --num-accelerators");
+   }
+
+   /// main circuit type
+   structural_type_descriptorRef module_type = structural_type_descriptorRef(new structural_type_descriptor("datapath_" + BH->get_function_name()));
+   /// top circuit creation
+   HLS->datapath = structural_managerRef(new structural_manager(HLS->Param));
+   HLS->datapath->set_top_info("Datapath_i", module_type);
+   const structural_objectRef datapath_cir = HLS->datapath->get_circ();
+   datapath_cir->set_black_box(false);
+
+   /// Set some descriptions and legal stuff
+   GetPointer<module>(datapath_cir)->set_description("Dataflow datapath RTL description for " + BH->get_function_name());
+   GetPointer<module>(datapath_cir)->set_copyright(GENERATED_COPYRIGHT);
+   GetPointer<module>(datapath_cir)->set_authors("Component automatically generated by bambu");
+   GetPointer<module>(datapath_cir)->set_license(GENERATED_LICENSE);
+
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Adding clock and reset ports");
+   structural_objectRef clock, reset;
+   add_clock_reset(clock, reset);
+
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Adding ports for primary inputs and outputs");
+   add_ports();
+
+   instantiate_component_parallel(clock, reset);
+
+   const structural_managerRef& SM = HLS->datapath;
+   const auto TM = HLSMgr->get_tree_manager();
+   const auto TechM = HLS->HLS_T->get_technology_manager();
+   CustomOrderedSet<structural_objectRef> memory_modules;
+   std::vector<structural_objectRef> stage_modules;
+   for(unsigned int stage = 0; stage < num_stages; stage++)
+   {
+      const auto gc = GetPointer<const gimple_call>(TM->get_tree_node_const(stages[stage]));
+      const auto called_id = GET_INDEX_NODE(GetPointer<const addr_expr>(GET_NODE(gc->fn))->op);
+      const auto called_name = HLSMgr->CGetFunctionBehavior(called_id)->CGetBehavioralHelper()->get_function_name();
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Instantiating stage " + STR(stage) + ": " + called_name);
+      structural_objectRef stage_mod = SM->add_module_from_technology_library(called_name + "_stage_" + STR(stage), called_name, TechM->get_library(called_name), datapath_cir, TechM);
+      memory_modules.insert(stage_mod);
+      stage_modules.push_back(stage_mod);
+      connect_stage_parameters(stage_mod, stage);
+      connect_kernel_control_ports(stage_mod, stage);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Instantiated stage " + STR(stage));
+   }
+   manage_extern_global_port_parallel(SM, memory_modules, datapath_cir);
+
+   /// the slots of memory_ctrl_parallel are assigned in the same order used by manage_extern_global_port_parallel
+   int addr_kernel = ceil_log2(parameters->getOption<unsigned long long>(OPT_num_accelerators));
+   if(!addr_kernel)
+      addr_kernel = 1;
+   unsigned int num_kernel = 0;
+   for(const auto& memory_module : memory_modules)
+   {
+      GetPointer<module>(memory_module)->SetParameter("KERN_NUM", STR(addr_kernel) + "'d" + STR(num_kernel));
+      ++num_kernel;
+   }
+   tie_unused_memory_slots(num_stages);
+   for(auto& stage_mod : stage_modules)
+   {
+      memory::propagate_memory_parameters(stage_mod, SM);
+   }
+   return DesignFlowStep_Status::SUCCESS;
+}
+
+void datapath_dataflow_cs::add_ports()
+{
+   classic_datapath::add_ports();
+   const structural_managerRef& SM = HLS->datapath;
+   const structural_objectRef circuit = SM->get_circ();
+   const auto num_stages = static_cast<unsigned int>(GetPointer<const OmpFunctions>(HLSMgr->Rfuns)->dataflow_stages.find(funId)->second.size());
+   structural_type_descriptorRef bool_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 0));
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Start adding dataflow ports");
+   SM->add_port_vector(STR(DONE_PORT_NAME) + "_accelerator", port_o::OUT, num_stages, circuit, bool_type);
+   SM->add_port_vector(STR(DONE_REQUEST) + "_accelerator", port_o::OUT, num_stages, circuit, bool_type);
+   SM->add_port_vector(STR(START_PORT_NAME) + "_accelerator", port_o::IN, num_stages, circuit, bool_type);
+   SM->add_port_vector("write_bank_accelerator", port_o::IN, num_stages, circuit, bool_type);
+   SM->add_port_vector("read_bank_accelerator", port_o::IN, num_stages, circuit, bool_type);
+   SM->add_port(STR(TASKS_POOL_END), port_o::IN, circuit, bool_type);
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Dataflow ports added");
+}
+
+void datapath_dataflow_cs::connect_stage_parameters(structural_objectRef stage_mod, unsigned int stage)
+{
+   const structural_managerRef& SM = HLS->datapath;
+   const structural_objectRef circuit = SM->get_circ();
+   const auto TM = HLSMgr->get_tree_manager();
+   const auto omp_functions = GetPointer<const OmpFunctions>(HLSMgr->Rfuns);
+   const auto& channels = omp_functions->dataflow_channels.find(funId)->second;
+   const auto Rmem = GetPointer<const memory_cs>(HLSMgr->Rmem);
+   const auto BH = HLSMgr->CGetFunctionBehavior(funId)->CGetBehavioralHelper();
+   const auto gc = GetPointer<const gimple_call>(TM->get_tree_node_const(omp_functions->dataflow_stages.find(funId)->second[stage]));
+   const auto called_id = GET_INDEX_NODE(GetPointer<const addr_expr>(GET_NODE(gc->fn))->op);
+   const auto called_BH = HLSMgr->CGetFunctionBehavior(called_id)->CGetBehavioralHelper();
+   const auto& called_parameters = called_BH->get_parameters();
+   THROW_ASSERT(called_parameters.size() == gc->args.size(), "Wrong number of arguments in " + gc->ToString());
+
+   auto arg = gc->args.begin();
+   for(const auto called_parameter : called_parameters)
+   {
+      const auto parameter_name = called_BH->PrintVariable(called_parameter);
+      structural_objectRef stage_port = stage_mod->find_member(parameter_name, port_o_K, stage_mod);
+      THROW_ASSERT(stage_port, "Port " + parameter_name + " not found in " + stage_mod->get_path());
+      auto actual_arg = GET_NODE(*arg);
+      ++arg;
+      if(actual_arg->get_kind() == ssa_name_K)
+      {
+         const auto sn = GetPointer<const ssa_name>(actual_arg);
+         const auto def = GetPointer<const gimple_assign>(GET_NODE(sn->CGetDefStmt()));
+         if(def and GET_NODE(def->op1)->get_kind() == addr_expr_K)
+         {
+            actual_arg = GET_NODE(def->op1);
+         }
+         else if(sn->var and GET_NODE(sn->var)->get_kind() == parm_decl_K)
+         {
+            /// parameter of the dataflow function forwarded to the stage
+            structural_objectRef datapath_port = circuit->find_member("in_port_" + BH->PrintVariable(GET_INDEX_NODE(sn->var)), port_o_K, circuit);
+            THROW_ASSERT(datapath_port, "Port for parameter " + BH->PrintVariable(GET_INDEX_NODE(sn->var)) + " not found");
+            SM->add_connection(datapath_port, stage_port);
+            continue;
+         }
+      }
+      if(actual_arg->get_kind() == integer_cst_K)
+      {
+         const auto value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(actual_arg));
+         structural_objectRef constant = SM->add_constant("const_" + stage_mod->get_id() + "_" + parameter_name, circuit, stage_port->get_typeRef(), STR(value));
+         SM->add_connection(constant, stage_port);
+      }
+      else if(actual_arg->get_kind() == addr_expr_K)
+      {
+         /// the channel written by this stage or read from the previous one
+         auto array = GetPointer<const addr_expr>(actual_arg)->op;
+         const auto ar = GetPointer<const array_ref>(GET_NODE(array));
+         if(ar)
+         {
+            array = ar->op0;
+         }
+         const auto var = GET_INDEX_NODE(array);
+         std::string bank_selector;
+         if(stage < channels.size() and channels[stage] == var)
+         {
+            bank_selector = "write_bank_accelerator";
+         }
+         else
+         {
+            THROW_ASSERT(stage > 0 and channels[stage - 1] == var, "Array " + BH->PrintVariable(var) + " is not a channel of stage " + STR(stage));
+            bank_selector = "read_bank_accelerator";
+         }
+         const auto bank_mux = SM->add_module_from_technology_library("bank_mux_" + stage_mod->get_id() + "_" + parameter_name, MUX_GATE_STD, HLS->HLS_T->get_technology_manager()->get_library(MUX_GATE_STD), circuit, HLS->HLS_T->get_technology_manager());
+         for(const auto& mux_input : {std::make_pair(std::string("in1"), 1u), std::make_pair(std::string("in2"), 0u)})
+         {
+            structural_objectRef mux_in = bank_mux->find_member(mux_input.first, port_o_K, bank_mux);
+            GetPointer<port_o>(mux_in)->type_resize(STD_GET_SIZE(stage_port->get_typeRef()));
+            structural_objectRef bank_address = SM->add_constant("bank_" + STR(mux_input.second) + "_" + stage_mod->get_id() + "_" + parameter_name, circuit, stage_port->get_typeRef(), STR(Rmem->get_dataflow_channel_bank(var, mux_input.second)));
+            SM->add_connection(bank_address, mux_in);
+         }
+         structural_objectRef mux_out = bank_mux->find_member("out1", port_o_K, bank_mux);
+         GetPointer<port_o>(mux_out)->type_resize(STD_GET_SIZE(stage_port->get_typeRef()));
+         structural_objectRef address_sign = SM->add_sign("bank_address_" + stage_mod->get_id() + "_" + parameter_name, circuit, stage_port->get_typeRef());
+         SM->add_connection(mux_out, address_sign);
+         SM->add_connection(address_sign, stage_port);
+         structural_objectRef selector = circuit->find_member(bank_selector, port_vector_o_K, circuit);
+         SM->add_connection(GetPointer<port_o>(selector)->get_port(stage), bank_mux->find_member("sel", port_o_K, bank_mux));
+      }
+      else
+      {
+         THROW_ERROR("Argument " + actual_arg->ToString() + " of stage " + STR(stage) + " of " + BH->get_function_name() + " is not supported in dataflow mode");
+      }
+   }
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected parameters of stage " + STR(stage));
+}
+
+void datapath_dataflow_cs::tie_unused_memory_slots(unsigned int num_stages)
+{
+   const structural_managerRef& SM = HLS->datapath;
+   const structural_objectRef circuit = SM->get_circ();
+   const auto num_kernel = parameters->getOption<unsigned int>(OPT_num_accelerators);
+   if(num_stages == num_kernel)
+   {
+      return;
+   }
+   structural_objectRef memory_parallel = circuit->find_member("memory_parallel", component_o_K, circuit);
+   std::map<unsigned long long, structural_objectRef> null_values;
+   for(unsigned int j = 0; j < GetPointer<module>(memory_parallel)->get_in_port_size(); j++)
+   {
+      structural_objectRef port_i = GetPointer<module>(memory_parallel)->get_in_port(j);
+      if(!GetPointer<port_o>(port_i)->get_is_memory() || port_i->get_kind() != port_vector_o_K || GetPointer<port_o>(port_i)->get_id().substr(0, 3) == "IN_")
+      {
+         continue;
+      }
+      for(unsigned int slot = num_stages; slot < num_kernel; slot++)
+      {
+         structural_objectRef port_d = GetPointer<port_o>(port_i)->get_port(slot);
+         const auto bw = GET_TYPE_SIZE(port_d);
+         if(null_values.find(bw) == null_values.end())
+         {
+            structural_type_descriptorRef null_type = structural_type_descriptorRef(new structural_type_descriptor("bool", bw));
+            null_values[bw] = SM->add_constant("null_value_" + STR(bw), circuit, null_type, STR(0));
+         }
+         if(!GetPointer<port_o>(port_d)->find_bounded_object())
+         {
+            SM->add_connection(port_d, null_values[bw]);
+         }
+      }
+   }
+}
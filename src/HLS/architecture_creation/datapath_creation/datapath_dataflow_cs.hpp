@@ -0,0 +1,101 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file datapath_dataflow_cs.hpp
+ * @brief Datapath of a function whose calls are executed as concurrent dataflow stages
+ *
+ */
+#ifndef DATAPATH_DATAFLOW_CS_H
+#define DATAPATH_DATAFLOW_CS_H
+
+/// Superclass include
+#include "datapath_parallel_cs.hpp"
+
+REF_FORWARD_DECL(structural_object);
+
+/**
+ * Instantiate one kernel for each call of a dataflow function; consecutive stages communicate through an array
+ * allocated twice (ping-pong) in the external memory, so that a stage can produce the next block while the following
+ * one is consuming the previous. The bank passed to each stage is selected by the write_bank/read_bank signals
+ * driven by __controller_dataflow.
+ */
+class datapath_dataflow_cs : public datapath_parallel_cs
+{
+ protected:
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+   /**
+    * Adds the input/output ports of the module
+    */
+   void add_ports() override;
+
+   /**
+    * Connect the parameters of a stage to the actual arguments of its call
+    * @param stage_mod is the kernel implementing the stage
+    * @param stage is the index of the stage
+    */
+   void connect_stage_parameters(structural_objectRef stage_mod, unsigned int stage);
+
+   /**
+    * Tie to zero the memory ports of memory_ctrl_parallel not used by any stage
+    * @param num_stages is the number of stages
+    */
+   void tie_unused_memory_slots(unsigned int num_stages);
+
+ public:
+   /**
+    * Constructor
+    * @param Param is the set of the parameters
+    * @param HLSMgr is the HLS manager
+    * @param funId is the identifier of the function
+    * @param design_flow_manager is the design flow manager
+    * @param hls_flow_step_type is the type of this step
+    */
+   datapath_dataflow_cs(const ParameterConstRef Param, const HLS_managerRef HLSMgr, unsigned int funId, const DesignFlowManagerConstRef design_flow_manager, const HLSFlowStep_Type hls_flow_step_type);
+
+   /**
+    * Destructor
+    */
+   ~datapath_dataflow_cs() override;
+
+   /**
+    * Execute the step
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+};
+#endif
@@ -204,16 +204,6 @@ void datapath_parallel_cs::connect_module_kernel(structural_objectRef kernel_mod
    const BehavioralHelperConstRef BH = FB->CGetBehavioralHelper();
    std::string prefix = "in_port_";
 
-   structural_objectRef clock_kernel = kernel_mod->find_member(CLOCK_PORT_NAME, port_o_K, kernel_mod);
-   structural_objectRef clock_datapath = circuit->find_member(CLOCK_PORT_NAME, port_o_K, circuit);
-   SM->add_connection(clock_datapath, clock_kernel);
-   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected clock port");
-
-   structural_objectRef reset_kernel = kernel_mod->find_member(RESET_PORT_NAME, port_o_K, kernel_mod);
-   structural_objectRef reset_datapath = circuit->find_member(RESET_PORT_NAME, port_o_K, circuit);
-   SM->add_connection(reset_datapath, reset_kernel);
-   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected reset port");
-
    const std::list<unsigned int>& function_parameters = BH->get_parameters();
    for(auto const function_parameter : function_parameters)
    {
@@ -231,6 +221,24 @@ void datapath_parallel_cs::connect_module_kernel(structural_objectRef kernel_mod
    }
    PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected parameter port");
 
+   connect_kernel_control_ports(kernel_mod, num_kernel);
+}
+
+void datapath_parallel_cs::connect_kernel_control_ports(structural_objectRef kernel_mod, unsigned int num_kernel)
+{
+   const structural_managerRef SM = this->HLS->datapath;
+   const structural_objectRef circuit = SM->get_circ();
+
+   structural_objectRef clock_kernel = kernel_mod->find_member(CLOCK_PORT_NAME, port_o_K, kernel_mod);
+   structural_objectRef clock_datapath = circuit->find_member(CLOCK_PORT_NAME, port_o_K, circuit);
+   SM->add_connection(clock_datapath, clock_kernel);
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected clock port");
+
+   structural_objectRef reset_kernel = kernel_mod->find_member(RESET_PORT_NAME, port_o_K, kernel_mod);
+   structural_objectRef reset_datapath = circuit->find_member(RESET_PORT_NAME, port_o_K, circuit);
+   SM->add_connection(reset_datapath, reset_kernel);
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, " - Connected reset port");
+
    structural_objectRef task_pool_kernel = kernel_mod->find_member(TASKS_POOL_END, port_o_K, kernel_mod);
    structural_objectRef task_pool_datapath = circuit->find_member(TASKS_POOL_END, port_o_K, circuit);
    SM->add_connection(task_pool_datapath, task_pool_kernel);
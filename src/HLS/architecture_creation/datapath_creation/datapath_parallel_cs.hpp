@@ -72,6 +72,13 @@ class datapath_parallel_cs : public classic_datapath
     */
    void connect_module_kernel(structural_objectRef kernel, unsigned int num_kernel);
 
+   /**
+    * @brief connect clock, reset, start, done and task pool ports of a kernel
+    * @param kernel
+    * @param num_kernel is the index of the kernel in the vector ports of the datapath
+    */
+   void connect_kernel_control_ports(structural_objectRef kernel, unsigned int num_kernel);
+
    /**
     * @brief connect datapath with each kernel
     * @param kernel
@@ -0,0 +1,146 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file top_entity_dataflow_cs.cpp
+ * @brief Top entity of a function whose calls are executed as concurrent dataflow stages
+ *
+ */
+
+/// Header include
+#include "top_entity_dataflow_cs.hpp"
+
+/// circuit includes
+#include "structural_manager.hpp"
+#include "structural_objects.hpp"
+
+/// HLS includes
+#include "hls.hpp"
+#include "hls_manager.hpp"
+#include "hls_target.hpp"
+
+/// parameter include
+#include "Parameter.hpp"
+
+/// HLS/function_allocation include
+#include "omp_functions.hpp"
+
+/// STD includes
+#include <string>
+#include <tuple>
+
+/// technology include
+#include "technology_manager.hpp"
+
+/// utility includes
+#include "dbgPrintHelper.hpp"
+#include "utility.hpp"
+
+top_entity_dataflow_cs::top_entity_dataflow_cs(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager, const HLSFlowStep_Type _hls_flow_step_type)
+    : top_entity_parallel_cs(_parameters, _HLSMgr, _funId, _design_flow_manager, _hls_flow_step_type)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+top_entity_dataflow_cs::~top_entity_dataflow_cs() = default;
+
+const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> top_entity_dataflow_cs::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+         ret.insert(std::make_tuple(HLSFlowStep_Type::DATAPATH_CS_DATAFLOW_CREATOR, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+structural_objectRef top_entity_dataflow_cs::add_controller_parallel(const structural_objectRef circuit)
+{
+   const auto num_stages = static_cast<unsigned int>(GetPointer<const OmpFunctions>(HLSMgr->Rfuns)->dataflow_stages.find(funId)->second.size());
+   const std::string controller_model = "__controller_dataflow";
+   const auto TechM = HLS->HLS_T->get_technology_manager();
+   structural_objectRef controller_circuit = SM->add_module_from_technology_library("__controller_dataflow", controller_model, TechM->get_library(controller_model), circuit, TechM);
+   controller_circuit->set_owner(circuit);
+   for(const auto& port_name : {STR(DONE_PORT_NAME) + "_accelerator", STR(DONE_REQUEST) + "_accelerator", STR(START_PORT_NAME) + "_accelerator", std::string("write_bank_accelerator"), std::string("read_bank_accelerator")})
+   {
+      structural_objectRef controller_port = controller_circuit->find_member(port_name, port_vector_o_K, controller_circuit);
+      THROW_ASSERT(controller_port, "Port " + port_name + " not found in " + controller_model);
+      GetPointer<port_o>(controller_port)->add_n_ports(num_stages, controller_port);
+   }
+   return controller_circuit;
+}
+
+void top_entity_dataflow_cs::connect_controller_parallel(const structural_objectRef circuit)
+{
+   const auto num_stages = static_cast<unsigned int>(GetPointer<const OmpFunctions>(HLSMgr->Rfuns)->dataflow_stages.find(funId)->second.size());
+   const structural_objectRef datapath_circuit = HLS->datapath->get_circ();
+   const structural_objectRef controller_circuit = circuit->find_member("__controller_dataflow", component_o_K, circuit);
+   structural_type_descriptorRef bool_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 0));
+
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Connecting dataflow controller");
+   structural_objectRef controller_task_pool_end = controller_circuit->find_member(STR(TASKS_POOL_END), port_o_K, controller_circuit);
+   structural_objectRef datapath_task_pool_end = datapath_circuit->find_member(STR(TASKS_POOL_END), port_o_K, datapath_circuit);
+   structural_objectRef task_pool_end_sign = SM->add_sign(STR(TASKS_POOL_END) + "_signal", circuit, bool_type);
+   SM->add_connection(controller_task_pool_end, task_pool_end_sign);
+   SM->add_connection(task_pool_end_sign, datapath_task_pool_end);
+
+   /// the signals produced by the stages
+   for(const auto& port_name : {STR(DONE_REQUEST) + "_accelerator", STR(DONE_PORT_NAME) + "_accelerator"})
+   {
+      structural_objectRef datapath_port = datapath_circuit->find_member(port_name, port_vector_o_K, datapath_circuit);
+      structural_objectRef controller_port = controller_circuit->find_member(port_name, port_vector_o_K, controller_circuit);
+      structural_objectRef sign = SM->add_sign_vector(port_name + "_signal", num_stages, circuit, bool_type);
+      SM->add_connection(datapath_port, sign);
+      SM->add_connection(sign, controller_port);
+   }
+   /// the signals driving the stages
+   for(const auto& port_name : {STR(START_PORT_NAME) + "_accelerator", std::string("write_bank_accelerator"), std::string("read_bank_accelerator")})
+   {
+      structural_objectRef datapath_port = datapath_circuit->find_member(port_name, port_vector_o_K, datapath_circuit);
+      structural_objectRef controller_port = controller_circuit->find_member(port_name, port_vector_o_K, controller_circuit);
+      structural_objectRef sign = SM->add_sign_vector(port_name + "_signal", num_stages, circuit, bool_type);
+      SM->add_connection(controller_port, sign);
+      SM->add_connection(sign, datapath_port);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Connected dataflow controller");
+}
@@ -0,0 +1,88 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file top_entity_dataflow_cs.hpp
+ * @brief Top entity of a function whose calls are executed as concurrent dataflow stages
+ *
+ */
+#ifndef TOP_ENTITY_DATAFLOW_CS_HPP
+#define TOP_ENTITY_DATAFLOW_CS_HPP
+
+/// Superclass include
+#include "top_entity_parallel_cs.hpp"
+
+REF_FORWARD_DECL(structural_object);
+
+/**
+ * Build the top of a dataflow function: the datapath containing the stages is driven by __controller_dataflow,
+ * which starts each stage as soon as its input bank has been filled by the previous stage and its output bank is free.
+ */
+class top_entity_dataflow_cs : public top_entity_parallel_cs
+{
+ protected:
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+   /**
+    * Instantiate the dataflow controller
+    * @param circuit is the top circuit
+    * @return the controller
+    */
+   structural_objectRef add_controller_parallel(const structural_objectRef circuit) override;
+
+   /**
+    * Connect the handshake and the bank selection signals between the controller and the datapath
+    * @param circuit is the top circuit
+    */
+   void connect_controller_parallel(const structural_objectRef circuit) override;
+
+ public:
+   /**
+    * Constructor
+    * @param Param is the set of the parameters
+    * @param HLSMgr is the HLS manager
+    * @param funId is the identifier of the function
+    * @param design_flow_manager is the design flow manager
+    * @param hls_flow_step_type is the type of this step
+    */
+   top_entity_dataflow_cs(const ParameterConstRef Param, const HLS_managerRef HLSMgr, unsigned int funId, const DesignFlowManagerConstRef design_flow_manager, const HLSFlowStep_Type hls_flow_step_type);
+
+   /**
+    * Destructor
+    */
+   ~top_entity_dataflow_cs() override;
+};
+#endif
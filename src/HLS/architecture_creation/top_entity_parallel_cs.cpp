@@ -150,13 +150,7 @@ DesignFlowStep_Status top_entity_parallel_cs::InternalExec()
    THROW_ASSERT(datapath_circuit, "Missing datapath circuit");
 
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Creating datapath object");
-   std::string parallel_controller_model = "__controller_parallel";
-   std::string parallel_controller_name = "__controller_parallel";
-   std::string par_ctrl_library = HLS->HLS_T->get_technology_manager()->get_library(parallel_controller_model);
-   structural_objectRef controller_circuit = SM->add_module_from_technology_library(parallel_controller_name, parallel_controller_model, par_ctrl_library, circuit, HLS->HLS_T->get_technology_manager());
-   controller_circuit->set_owner(circuit);
-   auto loopBW = BW_loop_iter(circuit);
-   resize_controller_parallel(controller_circuit, loopBW);
+   structural_objectRef controller_circuit = add_controller_parallel(circuit);
    THROW_ASSERT(controller_circuit, "Missing controller circuit");
 
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Creating datapath object");
@@ -239,7 +233,7 @@ DesignFlowStep_Status top_entity_parallel_cs::InternalExec()
    this->add_ports(circuit, clock_obj, reset_obj);
    PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "\tInput/output ports added!");
 
-   connect_port_parallel(circuit, loopBW);
+   connect_controller_parallel(circuit);
 
    memory::propagate_memory_parameters(HLS->datapath->get_circ(), HLS->top);
 
@@ -248,6 +242,22 @@ DesignFlowStep_Status top_entity_parallel_cs::InternalExec()
    return DesignFlowStep_Status::SUCCESS;
 }
 
+structural_objectRef top_entity_parallel_cs::add_controller_parallel(const structural_objectRef circuit)
+{
+   std::string parallel_controller_model = "__controller_parallel";
+   std::string parallel_controller_name = "__controller_parallel";
+   std::string par_ctrl_library = HLS->HLS_T->get_technology_manager()->get_library(parallel_controller_model);
+   structural_objectRef controller_circuit = SM->add_module_from_technology_library(parallel_controller_name, parallel_controller_model, par_ctrl_library, circuit, HLS->HLS_T->get_technology_manager());
+   controller_circuit->set_owner(circuit);
+   resize_controller_parallel(controller_circuit, BW_loop_iter(circuit));
+   return controller_circuit;
+}
+
+void top_entity_parallel_cs::connect_controller_parallel(const structural_objectRef circuit)
+{
+   connect_port_parallel(circuit, BW_loop_iter(circuit));
+}
+
 unsigned top_entity_parallel_cs::BW_loop_iter(const structural_objectRef circuit)
 {
    const FunctionBehaviorConstRef FB = HLSMgr->CGetFunctionBehavior(funId);
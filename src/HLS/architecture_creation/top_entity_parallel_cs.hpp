@@ -46,6 +46,19 @@ REF_FORWARD_DECL(structural_object);
 class top_entity_parallel_cs : public top_entity
 {
  protected:
+   /**
+    * Instantiate the controller which starts the kernels
+    * @param circuit is the top circuit
+    * @return the controller
+    */
+   virtual structural_objectRef add_controller_parallel(const structural_objectRef circuit);
+
+   /**
+    * Connect the controller to the datapath
+    * @param circuit is the top circuit
+    */
+   virtual void connect_controller_parallel(const structural_objectRef circuit);
+
    /**
     * @brief connect_port_parallel connect datapath and controller
     * @param circuit
@@ -1884,6 +1884,12 @@ void fu_binding::specialise_fu(const HLS_managerRef HLSMgr, const hlsRef HLS, st
             port_o::resize_std_port(produced_variables, n_out_elements, debug_level, port);
       }
    }
+   /// the memory controller keeps track of the channels completed early only when the scheduler overlaps the external memory accesses
+   if(fu_module->ExistsParameter("NONBLOCKING"))
+   {
+      const bool nonblocking_memory = parameters->IsParameter("nonblocking-memory") and parameters->GetParameter<int>("nonblocking-memory") == 1;
+      fu_module->SetParameter("NONBLOCKING", nonblocking_memory ? "1" : "0");
+   }
 
    auto* fun_unit = GetPointer<functional_unit>(fu_tech_obj);
    if(fun_unit)
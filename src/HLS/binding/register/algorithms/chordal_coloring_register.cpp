@@ -166,6 +166,7 @@ DesignFlowStep_Status chordal_coloring_register::InternalExec()
 
    /// sequential vertex coloring based on left edge sorting
    cg_vertices_size_type num_colors = boost::sequential_vertex_coloring(cg, boost::make_iterator_property_map(vertex_order.begin(), boost::identity_property_map(), boost::graph_traits<conflict_graph>::null_vertex()), color);
+   num_colors = refine_coloring(num_colors);
 
    /// finalize
    HLS->Rreg = reg_bindingRef(new reg_binding(HLS, HLSMgr));
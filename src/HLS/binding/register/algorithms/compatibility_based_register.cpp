@@ -49,15 +49,15 @@
 #include "Parameter.hpp"
 #include "dbgPrintHelper.hpp"
 
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
-#if BOOST_VERSION >= 106400
-#include <boost/serialization/array_wrapper.hpp>
-#endif
-#include <boost/numeric/ublas/matrix.hpp>
 
 /// HLS/binding/storage_value_insertion includes
 #include "storage_value_information.hpp"
 
+/// Scaling of the compatibility weights applied when they are weighted by the ratio between the bitwidths of the storage values
+#define BITWIDTH_WEIGHT_SCALE 16
+
 compatibility_based_register::compatibility_based_register(const ParameterConstRef _Param, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager, const HLSFlowStep_Type _hls_flow_step_type,
                                                            const HLSFlowStepSpecializationConstRef _hls_flow_step_specialization)
     : reg_binding_creator(_Param, _HLSMgr, _funId, _design_flow_manager, _hls_flow_step_type, _hls_flow_step_specialization)
@@ -72,7 +72,7 @@ void compatibility_based_register::create_compatibility_graph()
    CG.clear();
    THROW_ASSERT(HLS->Rliv, "Liveness analysis not yet computed");
    unsigned int CG_num_vertices = HLS->storage_value_information->get_number_of_storage_values();
-   boost::numeric::ublas::matrix<bool> conflict_map(CG_num_vertices, CG_num_vertices);
+   conflict_map.resize(CG_num_vertices, CG_num_vertices, false);
 
    boost::numeric::ublas::noalias(conflict_map) = boost::numeric::ublas::zero_matrix<bool>(CG_num_vertices, CG_num_vertices);
    for(unsigned int vi = 0; vi < CG_num_vertices; ++vi)
@@ -114,6 +114,13 @@ void compatibility_based_register::create_compatibility_graph()
             /// we consider only valuable sharing between registers
             if(edge_weight > 1)
             {
+               /// when values of different bitwidth may share a register, the sharing between values of similar bitwidth is preferred since it wastes fewer flip-flops
+               if(HLS->storage_value_information->is_bitwidth_aware())
+               {
+                  const auto size_i = static_cast<int>(HLS->storage_value_information->get_storage_value_bitsize(vi));
+                  const auto size_j = static_cast<int>(HLS->storage_value_information->get_storage_value_bitsize(vj));
+                  edge_weight = std::max(1, edge_weight * BITWIDTH_WEIGHT_SCALE * std::min(size_i, size_j) / std::max(size_i, size_j));
+               }
                bool in1;
                boost::tie(e1, in1) = boost::add_edge(verts[vi], verts[vj], edge_compatibility_property(edge_weight), CG);
                THROW_ASSERT(in1, "unable to add edge");
@@ -127,3 +134,10 @@ bool compatibility_based_register::is_compatible(unsigned int sv1, unsigned int
    std::pair<boost::graph_traits<compatibility_graph>::edge_descriptor, bool> edge = boost::edge(verts[sv1], verts[sv2], CG);
    return edge.second;
 }
+
+bool compatibility_based_register::are_in_conflict(unsigned int sv1, unsigned int sv2) const
+{
+   if(sv1 == sv2)
+      return false;
+   return conflict_map(std::min(sv1, sv2), std::max(sv1, sv2)) || !HLS->storage_value_information->are_value_bitsize_compatible(sv1, sv2);
+}
@@ -46,6 +46,11 @@
 #include "reg_binding_creator.hpp"
 
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 106400
+#include <boost/serialization/array_wrapper.hpp>
+#endif
+#include <boost/numeric/ublas/matrix.hpp>
 #include <vector>
 
 class compatibility_based_register : public reg_binding_creator
@@ -76,6 +81,9 @@ class compatibility_based_register : public reg_binding_creator
    /// ordered vector containing the vertices of the compatibility graph
    std::vector<CG_vertex_descriptor> verts;
 
+   /// pairs (i, j) with i < j of storage values which are live at the same time
+   boost::numeric::ublas::matrix<bool> conflict_map;
+
  public:
    /**
     * Constructor
@@ -98,6 +106,11 @@ class compatibility_based_register : public reg_binding_creator
     * Checks if two storage values are compatible
     */
    bool is_compatible(unsigned int sv1, unsigned int sv2) const;
+
+   /**
+    * Checks if two storage values cannot share the same register, either because of their lifetimes or because of their bitwidths
+    */
+   bool are_in_conflict(unsigned int sv1, unsigned int sv2) const;
 };
 /// refcount definition of the class
 typedef refcount<compatibility_based_register> compatibility_based_registerRef;
@@ -113,3 +113,17 @@ void conflict_based_register::create_conflict_graph()
          }
       }
 }
+
+conflict_based_register::cg_vertices_size_type conflict_based_register::refine_coloring(cg_vertices_size_type num_colors)
+{
+   if(!HLS->storage_value_information->is_bitwidth_aware())
+      return num_colors;
+   const auto cg_num_vertices = static_cast<unsigned int>(boost::num_vertices(cg));
+   std::vector<unsigned int> sv2reg(cg_num_vertices);
+   for(unsigned int vi = 0; vi < cg_num_vertices; ++vi)
+      sv2reg[vi] = static_cast<unsigned int>(color[boost::vertex(vi, cg)]);
+   const auto used_regs = minimize_flip_flops(sv2reg, static_cast<unsigned int>(num_colors), [&](unsigned int vi, unsigned int vj) -> bool { return boost::edge(boost::vertex(vi, cg), boost::vertex(vj, cg), cg).second; });
+   for(unsigned int vi = 0; vi < cg_num_vertices; ++vi)
+      color[boost::vertex(vi, cg)] = sv2reg[vi];
+   return used_regs;
+}
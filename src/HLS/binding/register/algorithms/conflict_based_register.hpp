@@ -80,6 +80,13 @@ class conflict_based_register : public reg_binding_creator
     * Create the conflict graph
     */
    void create_conflict_graph();
+
+   /**
+    * Refine the coloring of the conflict graph to reduce the flip-flops when storage values of different bitwidth can share a register
+    * @param num_colors is the number of colors of the current coloring
+    * @return the number of colors after the refinement
+    */
+   cg_vertices_size_type refine_coloring(cg_vertices_size_type num_colors);
 };
 
 #endif
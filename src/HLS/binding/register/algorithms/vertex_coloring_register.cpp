@@ -79,6 +79,7 @@ DesignFlowStep_Status vertex_coloring_register::InternalExec()
    create_conflict_graph();
    /// coloring based on DSATUR 2 heuristic
    cg_vertices_size_type num_colors = dsatur2_coloring(cg, color);
+   num_colors = refine_coloring(num_colors);
 
    /// finalize
    HLS->Rreg = reg_bindingRef(new reg_binding(HLS, HLSMgr));
@@ -146,6 +146,16 @@ DesignFlowStep_Status weighted_clique_register::InternalExec()
             v2c[*v] = i;
          }
       }
+      /// storage values of different bitwidth may share a register: reduce the flip-flops of the clique covering
+      if(HLS->storage_value_information->is_bitwidth_aware())
+      {
+         std::vector<unsigned int> sv2reg(verts.size());
+         for(unsigned int sv = 0; sv < verts.size(); ++sv)
+            sv2reg[sv] = v2c[verts[sv]];
+         num_registers = minimize_flip_flops(sv2reg, num_registers, [&](unsigned int sv1, unsigned int sv2) -> bool { return are_in_conflict(sv1, sv2); });
+         for(unsigned int sv = 0; sv < verts.size(); ++sv)
+            v2c[verts[sv]] = sv2reg[sv];
+      }
       /// finalize
       HLS->Rreg = reg_binding::create_reg_binding(HLS, HLSMgr);
       const std::list<vertex>& support = HLS->Rliv->get_support();
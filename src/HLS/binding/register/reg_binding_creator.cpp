@@ -60,14 +60,19 @@
 #include "Parameter.hpp"
 #include "hls.hpp"
 #include "liveness.hpp"
+#include "storage_value_information.hpp"
 #include "storage_value_insertion.hpp"
 
 #include "polixml.hpp"
 #include "xml_helper.hpp"
 
+#include <algorithm>
 #include <boost/version.hpp>
 #include <iosfwd>
 
+/// Relative cost of a bit of a register input multiplexer with respect to a flip-flop
+#define MUX_BIT_COST 0.5
+
 reg_binding_creator::reg_binding_creator(const ParameterConstRef _Param, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager, const HLSFlowStep_Type _hls_flow_step_type,
                                          const HLSFlowStepSpecializationConstRef _hls_flow_step_specialization)
     : HLSFunctionStep(_Param, _HLSMgr, _funId, _design_flow_manager, _hls_flow_step_type, _hls_flow_step_specialization), register_lower_bound(0)
@@ -119,3 +124,81 @@ const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationC
    }
    return ret;
 }
+
+unsigned int reg_binding_creator::minimize_flip_flops(std::vector<unsigned int>& sv2reg, unsigned int num_regs, const std::function<bool(unsigned int, unsigned int)>& are_in_conflict) const
+{
+   const auto number_of_storage_values = static_cast<unsigned int>(sv2reg.size());
+   std::vector<unsigned int> bitsizes(number_of_storage_values);
+   std::vector<CustomOrderedSet<unsigned int>> reg2svs(num_regs);
+   for(unsigned int sv = 0; sv < number_of_storage_values; ++sv)
+   {
+      THROW_ASSERT(sv2reg[sv] < num_regs, "wrong register index");
+      bitsizes[sv] = HLS->storage_value_information->get_storage_value_bitsize(sv);
+      reg2svs[sv2reg[sv]].insert(sv);
+   }
+   /// cost of a register holding svs, without removed and with added (if they are valid storage values)
+   const auto register_cost = [&](const CustomOrderedSet<unsigned int>& svs, unsigned int removed, unsigned int added) -> double {
+      unsigned int width = added < number_of_storage_values ? bitsizes[added] : 0;
+      size_t n_values = added < number_of_storage_values ? 1 : 0;
+      for(const auto sv : svs)
+      {
+         if(sv == removed)
+            continue;
+         width = std::max(width, bitsizes[sv]);
+         ++n_values;
+      }
+      return n_values == 0 ? 0.0 : width * (1.0 + MUX_BIT_COST * static_cast<double>(n_values - 1));
+   };
+   /// narrow storage values are the ones worth moving
+   std::vector<unsigned int> order(number_of_storage_values);
+   for(unsigned int sv = 0; sv < number_of_storage_values; ++sv)
+      order[sv] = sv;
+   std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) { return bitsizes[a] < bitsizes[b]; });
+
+   size_t moved = 0;
+   bool changed = true;
+   while(changed)
+   {
+      changed = false;
+      for(const auto sv : order)
+      {
+         const auto source = sv2reg[sv];
+         const auto source_gain = register_cost(reg2svs[source], number_of_storage_values, number_of_storage_values) - register_cost(reg2svs[source], sv, number_of_storage_values);
+         auto best_target = num_regs;
+         double best_gain = 0.0;
+         for(unsigned int target = 0; target < num_regs; ++target)
+         {
+            if(target == source || reg2svs[target].empty())
+               continue;
+            const auto gain = source_gain + register_cost(reg2svs[target], number_of_storage_values, number_of_storage_values) - register_cost(reg2svs[target], number_of_storage_values, sv);
+            /// a minimum gain avoids moving storage values back and forth among equivalent registers
+            if(gain <= best_gain + 0.5)
+               continue;
+            if(std::any_of(reg2svs[target].begin(), reg2svs[target].end(), [&](unsigned int other) { return are_in_conflict(sv, other); }))
+               continue;
+            best_gain = gain;
+            best_target = target;
+         }
+         if(best_target != num_regs)
+         {
+            PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Storage value " + STR(sv) + " (" + STR(bitsizes[sv]) + " bits) moved from register " + STR(source) + " to register " + STR(best_target));
+            reg2svs[source].erase(sv);
+            reg2svs[best_target].insert(sv);
+            sv2reg[sv] = best_target;
+            changed = true;
+            ++moved;
+         }
+      }
+   }
+
+   /// renumber the registers which are still used
+   std::vector<unsigned int> renumbering(num_regs, num_regs);
+   unsigned int used_regs = 0;
+   for(unsigned int reg = 0; reg < num_regs; ++reg)
+      if(!reg2svs[reg].empty())
+         renumbering[reg] = used_regs++;
+   for(auto& reg : sv2reg)
+      reg = renumbering[reg];
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level, "---Bitwidth aware refinement moved " + STR(moved) + " storage values: " + STR(num_regs) + " -> " + STR(used_regs) + " registers");
+   return used_regs;
+}
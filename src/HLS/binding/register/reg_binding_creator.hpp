@@ -46,6 +46,11 @@
 
 /// superclass include
 #include "hls_function_step.hpp"
+
+/// STD includes
+#include <functional>
+#include <vector>
+
 REF_FORWARD_DECL(reg_binding_creator);
 
 /**
@@ -64,6 +69,18 @@ class reg_binding_creator : public HLSFunctionStep
     */
    const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   /**
+    * Refine a register assignment to reduce the flip-flops and the width of the register input multiplexers.
+    * A register costs as many flip-flops as its widest storage value, while each further storage value adds an input to its multiplexer;
+    * storage values are moved towards the registers which reduce this cost, so that narrow values do not waste the bits of wide registers
+    * and registers holding a single narrow value are not kept only because of it.
+    * @param sv2reg is the register assigned to each storage value; it is updated and the registers are renumbered
+    * @param num_regs is the number of registers of the assignment
+    * @param are_in_conflict returns true if two storage values cannot share the same register
+    * @return the number of registers after the refinement
+    */
+   unsigned int minimize_flip_flops(std::vector<unsigned int>& sv2reg, unsigned int num_regs, const std::function<bool(unsigned int, unsigned int)>& are_in_conflict) const;
+
  public:
    /**
     * Constructor
@@ -54,13 +54,16 @@
 /// HLS/binding/module_binding includes
 #include "fu_binding.hpp"
 
+/// utility include
+#include "Parameter.hpp"
+
 /// tree includes
 #include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_
 #include "math_function.hpp"
 #include "tree_helper.hpp"
 #include "tree_manager.hpp"
 
-StorageValueInformation::StorageValueInformation(const HLS_managerConstRef _HLS_mgr, const unsigned int _function_id) : number_of_storage_values(0), HLS_mgr(_HLS_mgr), function_id(_function_id)
+StorageValueInformation::StorageValueInformation(const HLS_managerConstRef _HLS_mgr, const unsigned int _function_id) : number_of_storage_values(0), HLS_mgr(_HLS_mgr), function_id(_function_id), bitwidth_aware(false), max_bitwidth_waste(0)
 {
 }
 
@@ -73,6 +76,13 @@ void StorageValueInformation::Initialize()
    data = FB->CGetOpGraph(FunctionBehavior::DFG);
    fu = HLS->Rfu;
    const tree_managerRef TreeM = HLS_mgr->get_tree_manager();
+   const ParameterConstRef parameters = HLS_mgr->get_parameter();
+   bitwidth_aware = parameters->IsParameter("register-bitwidth-waste");
+   max_bitwidth_waste = bitwidth_aware ? parameters->GetParameter<unsigned int>("register-bitwidth-waste") : 0;
+   if(max_bitwidth_waste > 100)
+   {
+      THROW_ERROR("register-bitwidth-waste is a percentage: " + STR(max_bitwidth_waste));
+   }
 
    /// initialize the vw2vertex relation
    VertexIterator ki, ki_end;
@@ -323,5 +333,27 @@ bool StorageValueInformation::are_value_bitsize_compatible(unsigned int storage_
    auto isInt2 = tree_helper::is_int(TM, var2);
    auto size1 = tree_helper::size(TM, var1);
    auto size2 = tree_helper::size(TM, var2);
-   return isInt1 == isInt2 && (isInt1 && isInt2 ? size1 == size2 : resize_to_1_8_16_32_64_128_256_512(size1) == resize_to_1_8_16_32_64_128_256_512(size2));
+   if(isInt1 != isInt2)
+      return false;
+   if(isInt1 ? size1 == size2 : resize_to_1_8_16_32_64_128_256_512(size1) == resize_to_1_8_16_32_64_128_256_512(size2))
+      return true;
+   if(!bitwidth_aware)
+      return false;
+   /// only integer values are extended when written into a wider register: reals and vectors keep their own registers
+   const auto is_integer = [&](unsigned int var) -> bool { return !tree_helper::is_real(TM, var) && !tree_helper::is_a_vector(TM, var) && (tree_helper::is_int(TM, var) || tree_helper::is_unsigned(TM, var) || tree_helper::is_bool(TM, var)); };
+   if(!is_integer(var1) || !is_integer(var2))
+      return false;
+   const auto max_size = std::max(size1, size2);
+   const auto min_size = std::min(size1, size2);
+   return 100 * (max_size - min_size) <= max_bitwidth_waste * max_size;
+}
+
+unsigned int StorageValueInformation::get_storage_value_bitsize(unsigned int storage_value_index) const
+{
+   return tree_helper::size(HLS_mgr->get_tree_manager(), get_variable_index(storage_value_index));
+}
+
+bool StorageValueInformation::is_bitwidth_aware() const
+{
+   return bitwidth_aware;
 }
@@ -82,6 +82,12 @@ class StorageValueInformation
    /// functional unit assignments
    Wrefcount<const fu_binding> fu;
 
+   /// true if storage values of different bitwidth can share the same register
+   bool bitwidth_aware;
+
+   /// maximum percentage of the flip-flops of a register that can be wasted by a narrower storage value
+   unsigned int max_bitwidth_waste;
+
  public:
    /**
     * Constructor
@@ -134,6 +140,17 @@ class StorageValueInformation
     * @param storage_value_index2 is the second storage value
     */
    bool are_value_bitsize_compatible(unsigned int storage_value_index1, unsigned int storage_value_index2) const;
+
+   /**
+    * Returns the number of bits needed to store a storage value; the size of ssa variables is the one computed by the bit value analysis
+    * @param storage_value_index is the storage value
+    */
+   unsigned int get_storage_value_bitsize(unsigned int storage_value_index) const;
+
+   /**
+    * Returns true if integer storage values of different bitwidth can share the same register (i.e., --panda-parameter=register-bitwidth-waste=<percent>)
+    */
+   bool is_bitwidth_aware() const;
 };
 typedef refcount<StorageValueInformation> StorageValueInformationRef;
 #endif
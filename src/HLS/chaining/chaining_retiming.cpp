@@ -0,0 +1,489 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file chaining_retiming.cpp
+ * @brief Post-binding retiming of the chained paths which do not fit in the clock period
+ *
+ */
+
+/// Header include
+#include "chaining_retiming.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// behavior includes
+#include "behavioral_helper.hpp"
+#include "function_behavior.hpp"
+#include "op_graph.hpp"
+
+/// design_flows includes
+#include "design_flow_graph.hpp"
+#include "design_flow_manager.hpp"
+
+/// HLS includes
+#include "hls.hpp"
+#include "hls_constraints.hpp"
+#include "hls_manager.hpp"
+
+/// HLS/binding/interconnection include
+#include "conn_binding.hpp"
+
+/// HLS/binding/module includes
+#include "fu_binding.hpp"
+#include "parallel_memory_fu_binding.hpp"
+
+/// HLS/module_allocation include
+#include "allocation_information.hpp"
+
+/// HLS/scheduling include
+#include "schedule.hpp"
+
+/// HLS/stg includes
+#include "StateTransitionGraph_constructor.hpp"
+#include "state_transition_graph.hpp"
+#include "state_transition_graph_manager.hpp"
+
+/// HLS/virtual_components include
+#include "generic_obj.hpp"
+
+/// STD includes
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+/// utility includes
+#include "custom_set.hpp"
+#include "dbgPrintHelper.hpp"
+#include "string_manipulation.hpp" // for GET_CLASS
+
+ChainingRetiming::ChainingRetiming(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager)
+    : HLSFunctionStep(_parameters, _HLSMgr, _funId, _design_flow_manager, HLSFlowStep_Type::CHAINING_RETIMING), iterations(0), invalidate_binding(false)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+ChainingRetiming::~ChainingRetiming() = default;
+
+const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ChainingRetiming::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+         ret.insert(std::make_tuple(parameters->getOption<HLSFlowStep_Type>(OPT_datapath_interconnection_algorithm), HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+void ChainingRetiming::ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type)
+{
+   if(relationship_type == INVALIDATION_RELATIONSHIP and invalidate_binding)
+   {
+      /// liveness, module, register and interconnection binding are repeated on the split states
+      invalidate_binding = false;
+      const auto design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
+      const HLSFlowStep_Type liveness_algorithm = HLSMgr->get_HLS(funId)->liveness_algorithm;
+      for(const auto step_type : {liveness_algorithm, HLSFlowStep_Type::EASY_MODULE_BINDING})
+      {
+         const vertex step = design_flow_manager.lock()->GetDesignFlowStep(HLSFunctionStep::ComputeSignature(step_type, HLSFlowStepSpecializationConstRef(), funId));
+         if(step != NULL_VERTEX)
+         {
+            relationship.insert(design_flow_graph->CGetDesignFlowStepInfo(step)->design_flow_step);
+         }
+      }
+   }
+   HLSFunctionStep::ComputeRelationships(relationship, relationship_type);
+}
+
+void ChainingRetiming::ComputeMuxDelays()
+{
+   input_mux_delays.clear();
+   output_mux_delays.clear();
+   for(const auto& connection : HLS->Rconn->get_data_transfers())
+   {
+      const generic_objRef target = std::get<0>(connection.first);
+      const auto& sources = connection.second;
+      unsigned int precision = 0;
+      for(const auto& source : sources)
+      {
+         for(const auto& transfer : source.second)
+         {
+            precision = std::max(precision, std::get<1>(transfer));
+         }
+      }
+      const double mux_delay = HLS->allocation_information->estimate_muxNto1_delay(precision, static_cast<unsigned int>(sources.size()));
+      if(mux_delay <= 0.0)
+      {
+         continue;
+      }
+      if(target->get_type() == generic_obj::FUNCTIONAL_UNIT)
+      {
+         input_mux_delays[target.get()] = std::max(input_mux_delays[target.get()], mux_delay);
+      }
+      else if(target->get_type() == generic_obj::REGISTER)
+      {
+         for(const auto& source : sources)
+         {
+            if(source.first->get_type() == generic_obj::FUNCTIONAL_UNIT)
+            {
+               output_mux_delays[source.first.get()] = std::max(output_mux_delays[source.first.get()], mux_delay);
+            }
+         }
+      }
+   }
+}
+
+bool ChainingRetiming::CanBeSplit(const vertex state) const
+{
+   const StateTransitionGraphConstRef stg = HLS->STG->CGetStg();
+   if(state == HLS->STG->get_entry_state() or state == HLS->STG->get_exit_state())
+   {
+      return false;
+   }
+   const StateInfoConstRef state_info = stg->CGetStateInfo(state);
+   if(state_info->is_dummy or state_info->is_duplicated or state_info->clonedState != NULL_VERTEX or state_info->all_paths or not state_info->moved_exec_op.empty() or not state_info->moved_ending_op.empty())
+   {
+      return false;
+   }
+   /// multi-cycle and unbounded operations would span both the states
+   CustomUnorderedSet<vertex> ending;
+   for(const auto op : state_info->ending_operations)
+   {
+      ending.insert(op);
+   }
+   for(const auto op : state_info->executing_operations)
+   {
+      if(not ending.count(op))
+      {
+         return false;
+      }
+   }
+   for(const auto op : state_info->onfly_operations)
+   {
+      if(not ending.count(op))
+      {
+         return false;
+      }
+   }
+   OutEdgeIterator oe, oe_end;
+   for(boost::tie(oe, oe_end) = boost::out_edges(state, *stg); oe != oe_end; oe++)
+   {
+      const auto transition = stg->CGetTransitionInfo(*oe)->get_type();
+      if(transition == ALL_FINISHED or transition == NOT_ALL_FINISHED)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+std::list<vertex> ChainingRetiming::ComputeOperationsToBeMoved(const vertex state, double& slack) const
+{
+   const OpGraphConstRef op_graph = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::FLSAODG);
+   const StateInfoConstRef state_info = HLS->STG->CGetStg()->CGetStateInfo(state);
+   const double clock_cycle = HLS->HLS_C->get_clock_period_resource_fraction() * HLS->HLS_C->get_clock_period();
+   const double setup_hold_time = HLS->allocation_information->get_setup_hold_time();
+   const double controller_delay = HLS->allocation_information->EstimateControllerDelay();
+   CustomUnorderedSet<vertex> ending;
+   for(const auto op : state_info->ending_operations)
+   {
+      ending.insert(op);
+   }
+   CustomUnorderedSet<vertex> starting;
+   for(const auto op : state_info->starting_operations)
+   {
+      starting.insert(op);
+   }
+
+   const auto mux_delay = [&](const CustomMap<const generic_obj*, double>& delays, const vertex op) -> double {
+      if(not HLS->Rfu->is_assigned(op))
+      {
+         return 0.0;
+      }
+      const auto delay = delays.find(HLS->Rfu->get(op).get());
+      return delay != delays.end() ? delay->second : 0.0;
+   };
+
+   /// time at which the result of each operation ending in the state is available, relative to the beginning of the cycle
+   CustomUnorderedMap<vertex, double> output_times;
+   std::function<double(const vertex)> compute_output_time = [&](const vertex op) -> double {
+      const auto output_time = output_times.find(op);
+      if(output_time != output_times.end())
+      {
+         return output_time->second;
+      }
+      double ret;
+      if(not starting.count(op) or (GET_TYPE(op_graph, op) & (TYPE_PHI | TYPE_VPHI)))
+      {
+         /// operations started in a previous state: the ending time computed by the scheduler is used
+         const unsigned int index = op_graph->CGetOpNodeInfo(op)->GetNodeId();
+         const double cycle_start = from_strongtype_cast<double>(HLS->Rsch->get_cstep_end(op).second) * clock_cycle;
+         ret = std::min(clock_cycle, std::max(0.0, HLS->Rsch->GetEndingTime(index) - cycle_start));
+      }
+      else
+      {
+         double input_time = controller_delay;
+         InEdgeIterator ie, ie_end;
+         for(boost::tie(ie, ie_end) = boost::in_edges(op, *op_graph); ie != ie_end; ie++)
+         {
+            const vertex source = boost::source(*ie, *op_graph);
+            if(ending.count(source))
+            {
+               input_time = std::max(input_time, compute_output_time(source));
+            }
+         }
+         ret = input_time + mux_delay(input_mux_delays, op) + HLS->allocation_information->GetTimeLatency(op, fu_binding::UNKNOWN).first;
+      }
+      output_times[op] = ret;
+      return ret;
+   };
+
+   slack = clock_cycle;
+   CustomOrderedSet<vertex> to_be_moved;
+   for(const auto op : state_info->starting_operations)
+   {
+      if(GET_TYPE(op_graph, op) & (TYPE_PHI | TYPE_VPHI))
+      {
+         continue;
+      }
+      const double op_slack = clock_cycle - compute_output_time(op) - mux_delay(output_mux_delays, op) - setup_hold_time;
+      slack = std::min(slack, op_slack);
+      if(op_slack < 0.0)
+      {
+         PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---" + GET_NAME(op_graph, op) + " violates the clock period by " + STR(-op_slack) + "ns");
+         to_be_moved.insert(op);
+      }
+   }
+   if(to_be_moved.empty())
+   {
+      return std::list<vertex>();
+   }
+   /// the operations depending on the moved ones and the ones controlling the transitions are moved too
+   std::list<vertex> worklist(to_be_moved.begin(), to_be_moved.end());
+   for(const auto op : state_info->starting_operations)
+   {
+      if((GET_TYPE(op_graph, op) & (TYPE_IF | TYPE_SWITCH | TYPE_MULTIIF | TYPE_RET)) and to_be_moved.insert(op).second)
+      {
+         worklist.push_back(op);
+      }
+   }
+   while(not worklist.empty())
+   {
+      const vertex op = worklist.front();
+      worklist.pop_front();
+      OutEdgeIterator oe, oe_end;
+      for(boost::tie(oe, oe_end) = boost::out_edges(op, *op_graph); oe != oe_end; oe++)
+      {
+         const vertex target = boost::target(*oe, *op_graph);
+         if(starting.count(target) and not(GET_TYPE(op_graph, target) & (TYPE_PHI | TYPE_VPHI)) and to_be_moved.insert(target).second)
+         {
+            worklist.push_back(target);
+         }
+      }
+   }
+   std::list<vertex> ret;
+   for(const auto op : state_info->starting_operations)
+   {
+      if(to_be_moved.count(op))
+      {
+         ret.push_back(op);
+      }
+   }
+   return ret;
+}
+
+vertex ChainingRetiming::SplitState(const vertex state, const std::list<vertex>& moved_operations)
+{
+   const StateTransitionGraphRef stg = HLS->STG->GetStg();
+   const StateTransitionGraph_constructorRef builder = HLS->STG->STG_builder;
+   const StateInfoRef state_info = stg->GetStateInfo(state);
+   const OpGraphConstRef op_graph = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::FLSAODG);
+   CustomUnorderedSet<vertex> moved;
+   CustomUnorderedSet<unsigned int> moved_indices;
+   for(const auto op : moved_operations)
+   {
+      moved.insert(op);
+      moved_indices.insert(op_graph->CGetOpNodeInfo(op)->GetNodeId());
+   }
+   /// the control steps of the moved operations and of the following ones are postponed, so that the schedule matches the new state
+   HLS->Rsch->PostponeOperations(moved_indices, HLS->Rsch->get_cstep(moved_operations.front()).second);
+   const auto remove_moved = [&](std::list<vertex>& operations) { operations.remove_if([&](const vertex op) { return moved.count(op) != 0; }); };
+   remove_moved(state_info->executing_operations);
+   remove_moved(state_info->starting_operations);
+   remove_moved(state_info->ending_operations);
+   const vertex new_state = builder->create_state(moved_operations, moved_operations, moved_operations, state_info->BB_ids);
+
+   /// the new state inherits the outgoing transitions; a self loop becomes a transition back to the original state
+   std::list<EdgeDescriptor> out_transitions;
+   OutEdgeIterator oe, oe_end;
+   for(boost::tie(oe, oe_end) = boost::out_edges(state, *stg); oe != oe_end; oe++)
+   {
+      out_transitions.push_back(*oe);
+   }
+   for(const auto& transition : out_transitions)
+   {
+      const vertex target = boost::target(transition, *stg);
+      const EdgeDescriptor new_transition = builder->connect_state(new_state, target, static_cast<int>(stg->GetSelector(transition)));
+      builder->copy_condition(new_transition, transition);
+   }
+   for(const auto& transition : out_transitions)
+   {
+      builder->delete_edge(state, boost::target(transition, *stg));
+   }
+   builder->connect_state(state, new_state, TransitionInfo::StateTransitionType::ST_EDGE_NORMAL);
+   return new_state;
+}
+
+void ChainingRetiming::ResetModuleBinding()
+{
+   const OpGraphConstRef op_graph = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::FLSAODG);
+   const fu_bindingRef old_binding = HLS->Rfu;
+   if(parameters->getOption<int>(OPT_memory_banks_number) > 1 && !parameters->isOption(OPT_context_switch))
+   {
+      HLS->Rfu = fu_bindingRef(new ParallelMemoryFuBinding(HLSMgr, funId, parameters));
+   }
+   else
+   {
+      HLS->Rfu = fu_bindingRef(fu_binding::create_fu_binding(HLSMgr, funId, parameters));
+   }
+   VertexIterator op, op_end;
+   for(boost::tie(op, op_end) = boost::vertices(*op_graph); op != op_end; op++)
+   {
+      if(HLS->Rsch->is_scheduled(*op) and old_binding->is_assigned(*op))
+      {
+         /// same binding done by the scheduling
+         if(HLS->HLS_C->has_binding_to_fu(GET_NAME(op_graph, *op)))
+         {
+            HLS->Rfu->bind(*op, old_binding->get_assign(*op), 0);
+         }
+         else
+         {
+            HLS->Rfu->bind(*op, old_binding->get_assign(*op));
+         }
+      }
+   }
+}
+
+DesignFlowStep_Status ChainingRetiming::InternalExec()
+{
+   if(parameters->isOption(OPT_discrepancy_hw) and parameters->getOption<bool>(OPT_discrepancy_hw))
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Chaining retiming is not supported with hardware discrepancy analysis");
+      return DesignFlowStep_Status::UNCHANGED;
+   }
+   if(retimed_stg != HLS->STG)
+   {
+      retimed_stg = HLS->STG;
+      iterations = 0;
+   }
+   ComputeMuxDelays();
+   const StateTransitionGraphConstRef stg = HLS->STG->CGetStg();
+   std::list<vertex> worklist;
+   VertexIterator state, state_end;
+   for(boost::tie(state, state_end) = boost::vertices(*stg); state != state_end; state++)
+   {
+      worklist.push_back(*state);
+   }
+   const auto max_iterations = parameters->GetParameter<unsigned int>("chaining-retiming");
+   unsigned int split_states = 0;
+   while(not worklist.empty())
+   {
+      const vertex current = worklist.front();
+      worklist.pop_front();
+      if(not CanBeSplit(current))
+      {
+         continue;
+      }
+      double slack;
+      const std::list<vertex> moved_operations = ComputeOperationsToBeMoved(current, slack);
+      if(moved_operations.empty())
+      {
+         continue;
+      }
+      const std::string state_name = HLS->STG->get_state_name(current);
+      const auto& starting_operations = stg->CGetStateInfo(current)->starting_operations;
+      const auto op_graph = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::FLSAODG);
+      if(moved_operations.size() == static_cast<size_t>(std::count_if(starting_operations.begin(), starting_operations.end(), [&](const vertex op) { return not(GET_TYPE(op_graph, op) & (TYPE_PHI | TYPE_VPHI)); })))
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Warning: " + state_name + " violates the clock period by " + STR(-slack) + "ns but cannot be split");
+         continue;
+      }
+      if(iterations >= max_iterations)
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Warning: " + state_name + " violates the clock period by " + STR(-slack) + "ns after " + STR(iterations) + " retiming iterations");
+         continue;
+      }
+      const vertex new_state = SplitState(current, moved_operations);
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Moved " + STR(moved_operations.size()) + " operations of " + state_name + " (slack " + STR(slack) + "ns) into " + HLS->STG->get_state_name(new_state));
+      worklist.push_back(new_state);
+      split_states++;
+   }
+   if(not split_states)
+   {
+      return DesignFlowStep_Status::UNCHANGED;
+   }
+   HLS->STG->compute_min_max();
+   if(HLS->STG->CGetStg()->CGetStateTransitionGraphInfo()->min_cycles != 1)
+   {
+      HLS->registered_done_port = true;
+      InEdgeIterator ie, ie_end;
+      for(boost::tie(ie, ie_end) = boost::in_edges(HLS->STG->get_exit_state(), *stg); ie != ie_end; ie++)
+      {
+         if(stg->CGetStateInfo(boost::source(*ie, *stg))->is_dummy)
+         {
+            HLS->registered_done_port = false;
+            break;
+         }
+      }
+   }
+   else
+   {
+      HLS->registered_done_port = false;
+   }
+   ResetModuleBinding();
+   iterations++;
+   invalidate_binding = true;
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Chaining retiming: split " + STR(split_states) + " states of " + HLSMgr->CGetFunctionBehavior(funId)->CGetBehavioralHelper()->get_function_name() + ", repeating the binding");
+   return DesignFlowStep_Status::SUCCESS;
+}
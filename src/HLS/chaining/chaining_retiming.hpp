@@ -0,0 +1,153 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file chaining_retiming.hpp
+ * @brief Post-binding retiming of the chained paths which do not fit in the clock period
+ *
+ */
+#ifndef CHAINING_RETIMING_HPP
+#define CHAINING_RETIMING_HPP
+
+/// Superclass include
+#include "hls_function_step.hpp"
+
+/// graph include
+#include "graph.hpp"
+
+/// utility includes
+#include "custom_map.hpp"
+#include "refcount.hpp"
+
+/// STD include
+#include <list>
+
+class generic_obj;
+REF_FORWARD_DECL(StateTransitionGraphManager);
+
+/**
+ * Once the datapath has been bound, the actual multiplexers in front of the functional units and of the registers are known,
+ * while scheduling and chaining only estimated them. This step recomputes the combinational delay of the chained paths of each state
+ * with the multiplexer model of the allocation (estimate_muxNto1_delay) and splits the states whose paths exceed the clock period:
+ * the violating operations, together with the operations of the same state depending on them and with the control operations,
+ * are moved into a new state inserted after the original one. The results crossing the new state boundary are then stored in registers
+ * by repeating liveness analysis, module, register and interconnection binding of the function; the control steps of the moved operations
+ * and of the following ones are postponed by one, while the rest of the schedule is kept.
+ * The number of rebinding iterations is bounded by --panda-parameter=chaining-retiming=<n>.
+ */
+class ChainingRetiming : public HLSFunctionStep
+{
+ private:
+   /// The state transition graph manager on which the iterations have been counted
+   StateTransitionGraphManagerRef retimed_stg;
+
+   /// The number of rebinding iterations already performed on the current state transition graph
+   unsigned int iterations;
+
+   /// True if the binding steps have to be invalidated because some states have been split
+   bool invalidate_binding;
+
+   /// The delay of the multiplexers in front of each functional unit
+   CustomMap<const generic_obj*, double> input_mux_delays;
+
+   /// The delay of the multiplexers in front of the registers written by each functional unit
+   CustomMap<const generic_obj*, double> output_mux_delays;
+
+   /**
+    * Compute the delay of the multiplexers introduced by the interconnection binding
+    */
+   void ComputeMuxDelays();
+
+   /**
+    * Check if a state can be split: all the operations executed in the state have to complete in the state
+    * and the state must not be involved in the cycle optimizations of the state transition graph construction
+    * @param state is the state to be checked
+    */
+   bool CanBeSplit(const vertex state) const;
+
+   /**
+    * Compute the operations of a state which have to be moved in a new state to meet the clock period
+    * @param state is the state to be analyzed
+    * @param slack is where the worst slack of the state is stored
+    * @return the operations to be moved (empty if the state meets the clock period)
+    */
+   std::list<vertex> ComputeOperationsToBeMoved(const vertex state, double& slack) const;
+
+   /**
+    * Move a set of operations from a state to a new state executed right after it; the new state inherits the outgoing transitions
+    * @param state is the state to be split
+    * @param moved_operations are the operations to be moved
+    * @return the new state
+    */
+   vertex SplitState(const vertex state, const std::list<vertex>& moved_operations);
+
+   /**
+    * Restore the module binding computed by the scheduling, so that it can be performed again on the new states
+    */
+   void ResetModuleBinding();
+
+   /**
+    * Compute the relationship of this step
+    * @param relationship_type is the type of relationship to be considered
+    * @return the steps in relationship with this
+    */
+   const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor
+    * @param parameters is the set of input parameters
+    * @param HLSMgr is the HLS manager
+    * @param funId is the identifier of the function
+    * @param design_flow_manager is the design flow manager
+    */
+   ChainingRetiming(const ParameterConstRef parameters, const HLS_managerRef HLSMgr, unsigned int funId, const DesignFlowManagerConstRef design_flow_manager);
+
+   /**
+    * Destructor
+    */
+   ~ChainingRetiming() override;
+
+   /**
+    * Compute the relationships of a step with other steps
+    * @param dependencies is where relationships will be stored
+    * @param relationship_type is the type of relationship to be computed
+    */
+   void ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type) override;
+
+   /**
+    * Execute the step
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+};
+#endif
@@ -0,0 +1,371 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file analytical_evaluation.cpp
+ * @brief Implementation of the analytical estimation of the resources and of the cycles of the synthesized design
+ *
+ */
+
+/// Header include
+#include "analytical_evaluation.hpp"
+
+/// Autoheader include
+#include "config_HAVE_HOST_PROFILING_BUILT.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// behavior includes
+#include "basic_block.hpp"
+#include "call_graph_manager.hpp"
+#include "function_behavior.hpp"
+#if HAVE_HOST_PROFILING_BUILT
+#include "profiling_information.hpp"
+#endif
+
+/// HLS includes
+#include "hls.hpp"
+#include "hls_manager.hpp"
+
+/// HLS/binding includes
+#include "conn_binding.hpp"
+#include "fu_binding.hpp"
+#include "reg_binding.hpp"
+
+/// HLS/module_allocation include
+#include "allocation_information.hpp"
+
+/// HLS/stg includes
+#include "state_transition_graph.hpp"
+#include "state_transition_graph_manager.hpp"
+
+/// technology/physical_library include
+#include "technology_node.hpp"
+
+/// tree include
+#include "tree_helper.hpp"
+
+/// utility includes
+#include "dbgPrintHelper.hpp"
+#include "string_manipulation.hpp"
+
+/// Boost include
+#include <boost/foreach.hpp>
+
+/// STD includes
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+/// Bits of a block RAM primitive (18Kb); the BRAMs are counted as 36Kb tiles, as done by the synthesis reports
+#define BRAM18_BITS 18432
+
+/// Bits stored by a LUT used as distributed RAM
+#define LUTRAM_BITS 64
+
+/// LUTs of a bit of a 2-to-1 multiplexer: a LUT6 implements a 4-to-1 multiplexer, but the selectors are not always shared
+#define MUX_BIT_LUTS 0.5
+
+/// Minimum number of samples required to calibrate the estimates
+#define MIN_CALIBRATION_SAMPLES 3
+
+AnalyticalEvaluation::Resources::Resources(double _luts, double _ffs, double _dsps, double _brams) : luts(_luts), ffs(_ffs), dsps(_dsps), brams(_brams)
+{
+}
+
+AnalyticalEvaluation::AnalyticalEvaluation(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, const DesignFlowManagerConstRef _design_flow_manager)
+    : EvaluationBaseStep(_parameters, _HLSMgr, 0, _design_flow_manager, HLSFlowStep_Type::ANALYTICAL_EVALUATION)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+AnalyticalEvaluation::~AnalyticalEvaluation() = default;
+
+const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> AnalyticalEvaluation::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+         /// the sizes of the registers and the multiplexer trees are known once the datapaths have been created
+         ret.insert(std::make_tuple(HLSFlowStep_Type::GENERATE_HDL, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::TOP_FUNCTION));
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+bool AnalyticalEvaluation::HasToBeExecuted() const
+{
+   return true;
+}
+
+AnalyticalEvaluation::Resources AnalyticalEvaluation::EstimateResources(const HLS_managerRef HLSMgr, const ParameterConstRef parameters)
+{
+   Resources resources(0.0, 0.0, 0.0, 0.0);
+   const auto TM = HLSMgr->get_tree_manager();
+   const auto distram_threshold = parameters->getOption<unsigned int>(OPT_distram_threshold);
+   /// a memory is instantiated once even if it is allocated in more functions
+   CustomOrderedSet<unsigned int> memory_vars;
+   for(const auto function_id : HLSMgr->get_functions_with_body())
+   {
+      const auto HLS = HLSMgr->get_HLS(function_id);
+      if(!HLS || !HLS->allocation_information || !HLS->Rfu)
+      {
+         continue;
+      }
+      const auto& allocation_information = HLS->allocation_information;
+      for(unsigned int fu_type = 0; fu_type < allocation_information->get_number_fu_types(); ++fu_type)
+      {
+         const auto instances = HLS->Rfu->get_number(fu_type);
+         if(instances == 0)
+         {
+            continue;
+         }
+         if(allocation_information->is_memory_unit(fu_type))
+         {
+            const auto var = allocation_information->get_memory_var(fu_type);
+            if(!memory_vars.insert(var).second)
+            {
+               continue;
+            }
+            const auto bits = static_cast<double>(tree_helper::size(TM, var));
+            if(bits <= distram_threshold || allocation_information->get_fu(fu_type)->get_name().find("DISTRAM") != std::string::npos)
+            {
+               resources.luts += std::ceil(bits / LUTRAM_BITS);
+            }
+            else
+            {
+               resources.brams += std::ceil(bits / BRAM18_BITS) / 2;
+            }
+            continue;
+         }
+         resources.luts += allocation_information->get_area(fu_type) * instances;
+         resources.dsps += allocation_information->get_DSPs(fu_type) * instances;
+      }
+      if(HLS->Rconn)
+      {
+         resources.luts += MUX_BIT_LUTS * HLS->Rconn->determine_bit_level_mux();
+      }
+      if(HLS->Rreg)
+      {
+         for(unsigned int r = 0; r < HLS->Rreg->get_used_regs(); ++r)
+         {
+            resources.ffs += HLS->Rreg->get_bitsize(r);
+         }
+      }
+   }
+   return resources;
+}
+
+void AnalyticalEvaluation::EstimateCycles(const HLS_managerRef HLSMgr, const ParameterConstRef parameters, double& total_cycles, double& executions)
+{
+   total_cycles = 0.0;
+   executions = 0.0;
+   const auto top_function_ids = HLSMgr->CGetCallGraphManager()->GetRootFunctions();
+   THROW_ASSERT(top_function_ids.size() == 1, "Multiple top functions");
+   const auto top_function_id = *(top_function_ids.begin());
+
+#if HAVE_HOST_PROFILING_BUILT
+   /// with the profiling, each state is counted once for each execution of its basic block
+   for(const auto function_id : HLSMgr->get_functions_with_body())
+   {
+      const auto HLS = HLSMgr->get_HLS(function_id);
+      if(!HLS || !HLS->STG)
+      {
+         continue;
+      }
+      const auto FB = HLSMgr->CGetFunctionBehavior(function_id);
+      const auto profiling_information = FB->CGetProfilingInformation();
+      const auto fbb = FB->CGetBBGraph(FunctionBehavior::FBB);
+      const auto& bb_index_map = fbb->CGetBBGraphInfo()->bb_index_map;
+      if(function_id == top_function_id)
+      {
+         OutEdgeIterator oe, oe_end;
+         for(boost::tie(oe, oe_end) = boost::out_edges(fbb->CGetBBGraphInfo()->entry_vertex, *fbb); oe != oe_end; oe++)
+         {
+            executions += static_cast<double>(profiling_information->GetBBExecutions(boost::target(*oe, *fbb)));
+         }
+      }
+      const auto stg = HLS->STG->CGetStg();
+      const auto stg_info = stg->CGetStateTransitionGraphInfo();
+      BOOST_FOREACH(const vertex state, boost::vertices(*stg))
+      {
+         if(state == stg_info->entry_node || state == stg_info->exit_node)
+         {
+            continue;
+         }
+         const auto state_info = stg->CGetStateInfo(state);
+         if(state_info->is_dummy)
+         {
+            continue;
+         }
+         unsigned long long int state_executions = 0;
+         for(const auto bb_id : state_info->BB_ids)
+         {
+            if(bb_index_map.find(bb_id) != bb_index_map.end())
+            {
+               state_executions = std::max(state_executions, profiling_information->GetBBExecutions(bb_index_map.at(bb_id)));
+            }
+         }
+         total_cycles += static_cast<double>(state_executions);
+      }
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, parameters->get_class_debug_level("AnalyticalEvaluation"), "---Profiled cycles: " + STR(total_cycles) + " - Executions: " + STR(executions));
+#endif
+
+   /// without profiling a single execution of the longest path of the top function is considered
+   if(total_cycles == 0.0 || executions == 0.0)
+   {
+      const auto top_HLS = HLSMgr->get_HLS(top_function_id);
+      THROW_ASSERT(top_HLS && top_HLS->STG, "Top function not synthesized");
+      const auto stg_info = top_HLS->STG->CGetStg()->CGetStateTransitionGraphInfo();
+      total_cycles = stg_info->is_a_dag ? stg_info->max_cycles : top_HLS->STG->get_number_of_states();
+      executions = 1.0;
+   }
+}
+
+AnalyticalEvaluation::Resources AnalyticalEvaluation::ComputeCalibration(const ParameterConstRef parameters)
+{
+   Resources calibration(1.0, 1.0, 1.0, 1.0);
+   if(!parameters->IsParameter("synthesis-cache"))
+   {
+      return calibration;
+   }
+   std::ifstream calibration_file(parameters->GetParameter<std::string>("synthesis-cache") + "/estimation_calibration.txt");
+   if(!calibration_file)
+   {
+      return calibration;
+   }
+   /// the samples are indexed by the key of the design, so that a design synthesized more times is counted once
+   std::map<std::string, std::pair<Resources, Resources>> samples;
+   std::string line;
+   while(std::getline(calibration_file, line))
+   {
+      std::istringstream sample(line);
+      std::string key;
+      Resources estimated(0.0, 0.0, 0.0, 0.0), actual(0.0, 0.0, 0.0, 0.0);
+      if(sample >> key >> estimated.luts >> estimated.ffs >> estimated.dsps >> estimated.brams >> actual.luts >> actual.ffs >> actual.dsps >> actual.brams)
+      {
+         samples.erase(key);
+         samples.insert(std::make_pair(key, std::make_pair(estimated, actual)));
+      }
+   }
+   if(samples.size() < MIN_CALIBRATION_SAMPLES)
+   {
+      return calibration;
+   }
+   /// least squares fit of actual = factor * estimated for each resource
+   const auto fit = [&](double Resources::*resource) -> double {
+      double numerator = 0.0, denominator = 0.0;
+      for(const auto& sample : samples)
+      {
+         numerator += sample.second.first.*resource * sample.second.second.*resource;
+         denominator += sample.second.first.*resource * sample.second.first.*resource;
+      }
+      return denominator > 0.0 ? numerator / denominator : 1.0;
+   };
+   calibration.luts = fit(&Resources::luts);
+   calibration.ffs = fit(&Resources::ffs);
+   calibration.dsps = fit(&Resources::dsps);
+   calibration.brams = fit(&Resources::brams);
+   return calibration;
+}
+
+void AnalyticalEvaluation::StoreCalibrationSample(const ParameterConstRef parameters, const std::string& key, const Resources& estimated, const Resources& actual)
+{
+   if(key == "" || !parameters->IsParameter("synthesis-cache"))
+   {
+      return;
+   }
+   std::ostringstream sample;
+   sample << key << " " << estimated.luts << " " << estimated.ffs << " " << estimated.dsps << " " << estimated.brams << " " << actual.luts << " " << actual.ffs << " " << actual.dsps << " " << actual.brams << "\n";
+   /// a single write of the whole line, so that concurrent synthesis do not interleave their samples
+   std::ofstream calibration_file(parameters->GetParameter<std::string>("synthesis-cache") + "/estimation_calibration.txt", std::ios::app);
+   calibration_file << sample.str() << std::flush;
+}
+
+DesignFlowStep_Status AnalyticalEvaluation::InternalExec()
+{
+   const auto estimated = EstimateResources(HLSMgr, parameters);
+   const auto calibration = ComputeCalibration(parameters);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
+                  "---Raw estimates: LUTs " + STR(estimated.luts) + " - FFs " + STR(estimated.ffs) + " - DSPs " + STR(estimated.dsps) + " - BRAMs " + STR(estimated.brams));
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
+                  "---Calibration: LUTs " + STR(calibration.luts) + " - FFs " + STR(calibration.ffs) + " - DSPs " + STR(calibration.dsps) + " - BRAMs " + STR(calibration.brams));
+   const std::string objective_string = parameters->getOption<std::string>(OPT_evaluation_objectives);
+   const std::vector<std::string> objective_vector = convert_string_to_vector<std::string>(objective_string, ",");
+   for(const auto& objective : objective_vector)
+   {
+      if(objective == "AREA")
+      {
+         const auto luts = std::round(estimated.luts * calibration.luts);
+         HLSMgr->evaluations["AREA"] = std::vector<double>(1, luts);
+         HLSMgr->evaluations["SLICE_LUTS"] = std::vector<double>(1, luts);
+      }
+      else if(objective == "REGISTERS")
+      {
+         HLSMgr->evaluations["REGISTERS"] = std::vector<double>(1, std::round(estimated.ffs * calibration.ffs));
+      }
+      else if(objective == "DSPS")
+      {
+         HLSMgr->evaluations["DSPS"] = std::vector<double>(1, std::round(estimated.dsps * calibration.dsps));
+      }
+      else if(objective == "BRAMS")
+      {
+         HLSMgr->evaluations["BRAMS"] = std::vector<double>(1, std::ceil(2 * estimated.brams * calibration.brams) / 2);
+      }
+      else if(objective == "CYCLES" || objective == "TOTAL_CYCLES")
+      {
+         double total_cycles, executions;
+         EstimateCycles(HLSMgr, parameters, total_cycles, executions);
+         HLSMgr->evaluations["TOTAL_CYCLES"] = std::vector<double>(1, total_cycles);
+         HLSMgr->evaluations["NUM_EXECUTIONS"] = std::vector<double>(1, executions);
+         HLSMgr->evaluations["CYCLES"] = std::vector<double>(1, std::round(total_cycles / executions));
+      }
+      else
+      {
+         THROW_ERROR("Objective not supported by the analytical evaluation: " + objective);
+      }
+   }
+   return DesignFlowStep_Status::SUCCESS;
+}
@@ -0,0 +1,141 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file analytical_evaluation.hpp
+ * @brief Step estimating the resources and the cycles of the synthesized design with an analytical model
+ *
+ */
+#ifndef ANALYTICAL_EVALUATION_HPP
+#define ANALYTICAL_EVALUATION_HPP
+
+/// Superclass include
+#include "evaluation_base_step.hpp"
+
+/// STD include
+#include <string>
+
+/**
+ * Estimates LUTs, flip-flops, DSPs and BRAMs of the design from the bound functional units, the multiplexers of the interconnection,
+ * the registers and the internal memories; the cycles are estimated from the state transition graphs, weighted by the executions
+ * of the basic blocks when the profiling is available (--host-profiling).
+ * When the synthesis result cache is enabled (--panda-parameter=synthesis-cache=<dir>), each exact synthesis stores its results together with
+ * the raw estimates in <dir>/estimation_calibration.txt; the estimates are then scaled by the factors which fit these samples at best.
+ */
+class AnalyticalEvaluation : public EvaluationBaseStep
+{
+ public:
+   /// The resources used by a design
+   struct Resources
+   {
+      /// the LUTs
+      double luts;
+
+      /// the flip-flops
+      double ffs;
+
+      /// the DSPs
+      double dsps;
+
+      /// the BRAMs
+      double brams;
+
+      /// Constructor
+      Resources(double luts, double ffs, double dsps, double brams);
+   };
+
+ private:
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor
+    * @param parameters is the set of input parameters
+    * @param HLSMgr is the HLS manager
+    * @param design_flow_manager is the design flow manager
+    */
+   AnalyticalEvaluation(const ParameterConstRef parameters, const HLS_managerRef HLSMgr, const DesignFlowManagerConstRef design_flow_manager);
+
+   /**
+    * Destructor
+    */
+   ~AnalyticalEvaluation() override;
+
+   /**
+    * Check if this step has actually to be executed
+    * @return true if the step has to be executed
+    */
+   bool HasToBeExecuted() const override;
+
+   /**
+    * Execute the step
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+
+   /**
+    * Estimates the resources of the design without calibration; the datapaths must have been created
+    * @param HLSMgr is the HLS manager
+    * @param parameters is the set of input parameters
+    */
+   static Resources EstimateResources(const HLS_managerRef HLSMgr, const ParameterConstRef parameters);
+
+   /**
+    * Estimates the cycles of the top function; the state transition graphs must have been created
+    * @param HLSMgr is the HLS manager
+    * @param parameters is the set of input parameters
+    * @param total_cycles is where the cycles of all the executions are stored
+    * @param executions is where the number of executions of the top function is stored
+    */
+   static void EstimateCycles(const HLS_managerRef HLSMgr, const ParameterConstRef parameters, double& total_cycles, double& executions);
+
+   /**
+    * Computes the calibration factors of the estimates from the samples stored in the synthesis result cache
+    * @param parameters is the set of input parameters
+    * @return the factor of each resource (1 if there are not enough samples)
+    */
+   static Resources ComputeCalibration(const ParameterConstRef parameters);
+
+   /**
+    * Stores the results of an exact synthesis as a calibration sample of the estimates
+    * @param parameters is the set of input parameters
+    * @param key is the key of the design in the synthesis result cache
+    * @param estimated are the raw estimates of the design
+    * @param actual are the resources reported by the synthesis
+    */
+   static void StoreCalibrationSample(const ParameterConstRef parameters, const std::string& key, const Resources& estimated, const Resources& actual);
+};
+#endif
@@ -0,0 +1,711 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_space_exploration.cpp
+ * @brief Implementation of the design space exploration of the synthesis options
+ *
+ */
+
+/// Header include
+#include "design_space_exploration.hpp"
+
+/// Autoheader include
+#include "config_HAVE_ILP_BUILT.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// algorithms/clique_covering include
+#include "clique_covering.hpp"
+
+/// behavior include
+#include "call_graph_manager.hpp"
+
+/// constants include
+#include "constants.hpp"
+
+/// design_flows includes
+#include "design_flow_manager.hpp"
+
+/// frontend_analysis includes
+#include "frontend_flow_step.hpp"
+#include "frontend_flow_step_factory.hpp"
+
+/// HLS includes
+#include "analytical_evaluation.hpp"
+#include "hls.hpp"
+#include "hls_constraints.hpp"
+#include "hls_flow_step_factory.hpp"
+#include "hls_manager.hpp"
+#include "hls_step.hpp"
+
+/// HLS/memory include
+#include "memory_allocation.hpp"
+
+/// polixml include
+#include "xml_document.hpp"
+
+/// technology/physical_library include
+#include "technology_node.hpp"
+
+/// utility includes
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+#include "xml_helper.hpp"
+
+/// Boost includes
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/lexical_cast.hpp>
+
+/// STD includes
+#include <cerrno>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <list>
+
+/// System includes
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// Period (in microseconds) of the polling of the processes synthesizing the design points
+#define DSE_POLLING_PERIOD 50000
+
+/// The register allocation algorithms which can be explored, with the clique covering used by the weighted clique register binding
+static const std::map<std::string, std::pair<HLSFlowStep_Type, CliqueCovering_Algorithm>> register_allocations = {
+    {"COLORING", {HLSFlowStep_Type::COLORING_REGISTER_BINDING, CliqueCovering_Algorithm::WEIGHTED_COLORING}},
+    {"CHORDAL_COLORING", {HLSFlowStep_Type::CHORDAL_COLORING_REGISTER_BINDING, CliqueCovering_Algorithm::WEIGHTED_COLORING}},
+    {"WEIGHTED_COLORING", {HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, CliqueCovering_Algorithm::WEIGHTED_COLORING}},
+    {"BIPARTITE_MATCHING", {HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, CliqueCovering_Algorithm::BIPARTITE_MATCHING}},
+    {"TTT_CLIQUE_COVERING", {HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, CliqueCovering_Algorithm::TTT_CLIQUE_COVERING}},
+    {"WEIGHTED_TS", {HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, CliqueCovering_Algorithm::TS_WEIGHTED_CLIQUE_COVERING}},
+    {"UNIQUE_BINDING", {HLSFlowStep_Type::UNIQUE_REGISTER_BINDING, CliqueCovering_Algorithm::WEIGHTED_COLORING}}};
+
+/// The clique covering algorithms of the module binding which can be explored
+static const std::map<std::string, CliqueCovering_Algorithm> module_bindings = {{"TTT_FAST", CliqueCovering_Algorithm::TTT_CLIQUE_COVERING_FAST},
+                                                                                {"TTT_FAST2", CliqueCovering_Algorithm::TTT_CLIQUE_COVERING_FAST2},
+                                                                                {"TTT_FULL", CliqueCovering_Algorithm::TTT_CLIQUE_COVERING},
+                                                                                {"TTT_FULL2", CliqueCovering_Algorithm::TTT_CLIQUE_COVERING2},
+                                                                                {"TS", CliqueCovering_Algorithm::TS_CLIQUE_COVERING},
+                                                                                {"WEIGHTED_TS", CliqueCovering_Algorithm::TS_WEIGHTED_CLIQUE_COVERING},
+                                                                                {"COLORING", CliqueCovering_Algorithm::COLORING},
+                                                                                {"WEIGHTED_COLORING", CliqueCovering_Algorithm::WEIGHTED_COLORING},
+                                                                                {"BIPARTITE_MATCHING", CliqueCovering_Algorithm::BIPARTITE_MATCHING}};
+
+/// The memory channel types which can be explored
+static const std::map<std::string, MemoryAllocation_ChannelsType> channels_types = {
+    {CHANNELS_TYPE_MEM_ACC_11, MemoryAllocation_ChannelsType::MEM_ACC_11}, {CHANNELS_TYPE_MEM_ACC_N1, MemoryAllocation_ChannelsType::MEM_ACC_N1}, {CHANNELS_TYPE_MEM_ACC_NN, MemoryAllocation_ChannelsType::MEM_ACC_NN}};
+
+DesignSpaceExploration::Metrics::Metrics() : area(0.0), latency(0.0), frequency(0.0)
+{
+}
+
+DesignSpaceExploration::DesignSpaceExploration(const ParameterRef _parameters, const DesignFlowCreator& _create_design_flow)
+    : parameters(_parameters),
+      create_design_flow(_create_design_flow),
+      debug_level(_parameters->get_class_debug_level(GET_CLASS(*this))),
+      output_level(_parameters->getOption<int>(OPT_output_level)),
+      max_jobs(_parameters->IsParameter("dse-jobs") ? _parameters->GetParameter<size_t>("dse-jobs") : 1),
+      prune_margin(_parameters->IsParameter("dse-prune-margin") ? _parameters->GetParameter<double>("dse-prune-margin") : 0.1),
+      dse_dir(boost::filesystem::absolute(_parameters->IsParameter("dse-dir") ? _parameters->GetParameter<std::string>("dse-dir") : "dse").string()),
+      exact_evaluation(_parameters->getOption<bool>(OPT_evaluation))
+{
+   if(max_jobs == 0)
+   {
+      THROW_ERROR("dse-jobs must be at least 1");
+   }
+   if(prune_margin < 0.0)
+   {
+      THROW_ERROR("dse-prune-margin must not be negative");
+   }
+}
+
+DesignSpaceExploration::~DesignSpaceExploration() = default;
+
+bool DesignSpaceExploration::IsFrontendKnob(const std::string& knob)
+{
+   return knob == "scheduler" || knob == "channels-type" || knob == "clock-period";
+}
+
+void DesignSpaceExploration::ParseKnobs()
+{
+   std::vector<std::string> knob_strings;
+   const auto dse_string = parameters->GetParameter<std::string>("dse");
+   boost::algorithm::split(knob_strings, dse_string, boost::algorithm::is_any_of(","));
+   for(const auto& knob_string : knob_strings)
+   {
+      const auto colon = knob_string.find(':');
+      if(colon == std::string::npos)
+      {
+         THROW_ERROR("Malformed design space exploration knob: " + knob_string);
+      }
+      const auto knob = knob_string.substr(0, colon);
+      std::vector<std::string> values;
+      const auto values_string = knob_string.substr(colon + 1);
+      boost::algorithm::split(values, values_string, boost::algorithm::is_any_of("|"));
+      for(const auto& value : values)
+      {
+         const auto valid = [&]() -> bool {
+            if(knob == "scheduler")
+            {
+#if HAVE_ILP_BUILT
+               return value == "LIST_BASED" || value == "SDC";
+#else
+               return value == "LIST_BASED";
+#endif
+            }
+            if(knob == "register-allocation")
+            {
+               return register_allocations.find(value) != register_allocations.end();
+            }
+            if(knob == "module-binding")
+            {
+               return value == "UNIQUE" || module_bindings.find(value) != module_bindings.end();
+            }
+            if(knob == "channels-type")
+            {
+               return channels_types.find(value) != channels_types.end();
+            }
+            if(knob == "clock-period")
+            {
+               double period;
+               return boost::conversion::try_lexical_convert(value, period) && period > 0.0;
+            }
+            THROW_ERROR("Design space exploration knob not supported: " + knob);
+            return false;
+         }();
+         if(!valid)
+         {
+            THROW_ERROR("Value " + value + " not supported by design space exploration knob " + knob);
+         }
+      }
+      for(const auto& explored : knobs)
+      {
+         if(explored.first == knob)
+         {
+            THROW_ERROR("Design space exploration knob " + knob + " specified twice");
+         }
+      }
+      knobs.push_back(std::make_pair(knob, values));
+   }
+
+   /// the design points are the cartesian product of the knob values
+   std::vector<std::map<std::string, std::string>> configurations(1);
+   for(const auto& knob : knobs)
+   {
+      std::vector<std::map<std::string, std::string>> extended;
+      for(const auto& configuration : configurations)
+      {
+         for(const auto& value : knob.second)
+         {
+            extended.push_back(configuration);
+            extended.back()[knob.first] = value;
+         }
+      }
+      configurations.swap(extended);
+   }
+   for(const auto& configuration : configurations)
+   {
+      DesignPoint point;
+      point.name = "point_" + STR(points.size());
+      point.knobs = configuration;
+      point.has_estimate = false;
+      point.status = PointStatus::PENDING;
+      points.push_back(point);
+   }
+}
+
+void DesignSpaceExploration::ApplyKnob(const std::string& knob, const std::string& value) const
+{
+   if(knob == "scheduler")
+   {
+      /// SDC scheduling is also visible to the specification through the PANDA_SDC macro
+      std::string defines;
+      if(parameters->isOption(OPT_gcc_defines))
+      {
+         std::vector<std::string> old_defines;
+         const auto defines_string = parameters->getOption<std::string>(OPT_gcc_defines);
+         boost::algorithm::split(old_defines, defines_string, boost::algorithm::is_any_of(STR_CST_string_separator));
+         for(const auto& define : old_defines)
+         {
+            if(define != "PANDA_SDC" && define != "")
+            {
+               defines += (defines == "" ? "" : STR_CST_string_separator) + define;
+            }
+         }
+      }
+#if HAVE_ILP_BUILT
+      if(value == "SDC")
+      {
+         parameters->setOption(OPT_scheduling_algorithm, HLSFlowStep_Type::SDC_SCHEDULING);
+         defines += (defines == "" ? "" : STR_CST_string_separator) + std::string("PANDA_SDC");
+      }
+      else
+#endif
+      {
+         parameters->setOption(OPT_scheduling_algorithm, HLSFlowStep_Type::LIST_BASED_SCHEDULING);
+      }
+      if(defines == "")
+      {
+         parameters->removeOption(OPT_gcc_defines);
+      }
+      else
+      {
+         parameters->setOption(OPT_gcc_defines, defines);
+      }
+   }
+   else if(knob == "register-allocation")
+   {
+      const auto& register_allocation = register_allocations.at(value);
+      parameters->setOption(OPT_register_allocation_algorithm, register_allocation.first);
+      if(register_allocation.first == HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING)
+      {
+         parameters->setOption(OPT_weighted_clique_register_algorithm, register_allocation.second);
+      }
+   }
+   else if(knob == "module-binding")
+   {
+      if(value == "UNIQUE")
+      {
+         parameters->setOption(OPT_fu_binding_algorithm, HLSFlowStep_Type::UNIQUE_MODULE_BINDING);
+      }
+      else
+      {
+         parameters->setOption(OPT_fu_binding_algorithm, HLSFlowStep_Type::CDFC_MODULE_BINDING);
+         parameters->setOption(OPT_cdfc_module_binding_algorithm, module_bindings.at(value));
+      }
+   }
+   else if(knob == "channels-type")
+   {
+      parameters->setOption(OPT_channels_type, channels_types.at(value));
+      if(value == CHANNELS_TYPE_MEM_ACC_11)
+      {
+         parameters->setOption(OPT_channels_number, 1);
+      }
+   }
+   else if(knob == "clock-period")
+   {
+      parameters->setOption(OPT_clock_period, value);
+   }
+   else
+   {
+      THROW_UNREACHABLE(knob);
+   }
+}
+
+std::string DesignSpaceExploration::GetPointDirectory(size_t index) const
+{
+   return dse_dir + "/" + points.at(index).name;
+}
+
+DesignSpaceExploration::Metrics DesignSpaceExploration::ComputeMetrics(const HLS_managerRef& HLSMgr, bool exact) const
+{
+   Metrics metrics;
+   /// the same estimates of the analytical evaluation: the area is measured in LUTs, the latency is weighted by the profiling when available
+   const auto resources = AnalyticalEvaluation::EstimateResources(HLSMgr, parameters);
+   const auto calibration = AnalyticalEvaluation::ComputeCalibration(parameters);
+   metrics.area = std::round(resources.luts * calibration.luts);
+   double total_cycles, executions;
+   AnalyticalEvaluation::EstimateCycles(HLSMgr, parameters, total_cycles, executions);
+   metrics.latency = std::round(total_cycles / executions);
+   const auto top_functions = HLSMgr->CGetCallGraphManager()->GetRootFunctions();
+   THROW_ASSERT(top_functions.size() == 1, "Multiple top functions");
+   const auto top_HLS = HLSMgr->get_HLS(*top_functions.begin());
+   THROW_ASSERT(top_HLS, "Top function not synthesized");
+   metrics.frequency = 1000.0 / top_HLS->HLS_C->get_clock_period();
+   if(exact)
+   {
+      const auto& evaluations = HLSMgr->evaluations;
+      if(evaluations.find("AREA") != evaluations.end())
+      {
+         metrics.area = evaluations.at("AREA").at(0);
+      }
+      if(evaluations.find("CYCLES") != evaluations.end())
+      {
+         metrics.latency = evaluations.at("CYCLES").at(0);
+      }
+      if(evaluations.find("PERIOD") != evaluations.end())
+      {
+         metrics.frequency = 1000.0 / evaluations.at("PERIOD").at(0);
+      }
+   }
+   return metrics;
+}
+
+bool DesignSpaceExploration::ReadMetrics(const std::string& file_name, Metrics& metrics)
+{
+   std::ifstream file(file_name);
+   if(!file)
+   {
+      return false;
+   }
+   return static_cast<bool>(file >> metrics.area >> metrics.latency >> metrics.frequency);
+}
+
+bool DesignSpaceExploration::Dominates(const Metrics& first, const Metrics& second, double margin)
+{
+   if(first.area > second.area || first.latency > second.latency || first.frequency < second.frequency)
+   {
+      return false;
+   }
+   return first.area * (1.0 + margin) < second.area || first.latency * (1.0 + margin) < second.latency || first.frequency > second.frequency * (1.0 + margin);
+}
+
+void DesignSpaceExploration::SynthesizePoints(const std::vector<size_t>& indices, bool exact, const HLS_managerRef& HLSMgr, const DesignFlowManagerRef& design_flow_manager)
+{
+   const auto hls_flow_step_factory = GetPointer<const HLSFlowStepFactory>(design_flow_manager->CGetDesignFlowStepFactory("HLS"));
+   const auto temporary_directory = parameters->getOption<std::string>(OPT_output_temporary_directory);
+   const std::string result_file = exact ? "evaluation.txt" : "estimation.txt";
+   std::map<pid_t, size_t> running;
+   auto pending = indices.begin();
+   while(pending != indices.end() || !running.empty())
+   {
+      while(pending != indices.end() && running.size() < max_jobs)
+      {
+         const auto index = *pending;
+         const auto point_dir = GetPointDirectory(index);
+         boost::filesystem::create_directories(point_dir);
+         std::cout.flush();
+         std::cerr.flush();
+         const auto pid = fork();
+         if(pid < 0)
+         {
+            THROW_ERROR("Design space exploration process cannot be started");
+         }
+         if(pid == 0)
+         {
+            int exit_code = EXIT_FAILURE;
+            try
+            {
+               const auto log = open((point_dir + (exact ? "/evaluation.log" : "/estimation.log")).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+               if(log >= 0)
+               {
+                  dup2(log, STDOUT_FILENO);
+                  dup2(log, STDERR_FILENO);
+                  close(log);
+               }
+               /// the files produced by the synthesis are written in the directory of the point
+               const auto point_temporary_directory = temporary_directory + "/dse_" + points.at(index).name + "/";
+               boost::filesystem::create_directories(point_temporary_directory);
+               parameters->setOption(OPT_output_temporary_directory, point_temporary_directory);
+               boost::filesystem::current_path(point_dir);
+               for(const auto& knob : points.at(index).knobs)
+               {
+                  if(!IsFrontendKnob(knob.first))
+                  {
+                     ApplyKnob(knob.first, knob.second);
+                  }
+               }
+               parameters->setOption(OPT_evaluation, exact);
+               const std::pair<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef> hls_flow_step(parameters->getOption<HLSFlowStep_Type>(OPT_synthesis_flow), HLSFlowStepSpecializationConstRef());
+               design_flow_manager->AddSteps(hls_flow_step_factory->CreateHLSFlowSteps(hls_flow_step));
+               design_flow_manager->Exec();
+               const auto metrics = ComputeMetrics(HLSMgr, exact);
+               std::ofstream metrics_file(point_dir + "/" + result_file);
+               metrics_file << metrics.area << " " << metrics.latency << " " << metrics.frequency << std::endl;
+               exit_code = metrics_file ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+            catch(const char* str)
+            {
+               std::cerr << str << std::endl;
+            }
+            catch(const std::string& str)
+            {
+               std::cerr << str << std::endl;
+            }
+            catch(std::exception& e)
+            {
+               std::cerr << e.what() << std::endl;
+            }
+            catch(...)
+            {
+               std::cerr << "Unknown error type" << std::endl;
+            }
+            std::cout.flush();
+            std::cerr.flush();
+            _exit(exit_code);
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Started " + points.at(index).name);
+         running[pid] = index;
+         ++pending;
+      }
+      /// only the started processes are waited for, since the synthesis may have started other child processes
+      int status = 0;
+      pid_t pid = 0;
+      while(pid == 0)
+      {
+         for(const auto& running_point : running)
+         {
+            pid = waitpid(running_point.first, &status, WNOHANG);
+            if(pid < 0 && errno == EINTR)
+            {
+               pid = 0;
+            }
+            else if(pid < 0)
+            {
+               THROW_ERROR("Error while waiting for the design space exploration processes");
+            }
+            if(pid != 0)
+            {
+               break;
+            }
+         }
+         if(pid == 0)
+         {
+            usleep(DSE_POLLING_PERIOD);
+         }
+      }
+      const auto index = running.at(pid);
+      running.erase(pid);
+      if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Synthesis of " + points.at(index).name + " failed: see " + GetPointDirectory(index) + (exact ? "/evaluation.log" : "/estimation.log"));
+      }
+   }
+}
+
+void DesignSpaceExploration::ExploreGroup(const std::vector<size_t>& group)
+{
+   for(const auto& knob : points.at(group.front()).knobs)
+   {
+      if(IsFrontendKnob(knob.first))
+      {
+         ApplyKnob(knob.first, knob.second);
+      }
+   }
+   HLS_managerRef HLSMgr;
+   DesignFlowManagerRef design_flow_manager;
+   create_design_flow(parameters, HLSMgr, design_flow_manager);
+   const auto frontend_flow_step_factory = GetPointer<const FrontendFlowStepFactory>(design_flow_manager->CGetDesignFlowStepFactory("Frontend"));
+   design_flow_manager->AddStep(frontend_flow_step_factory->CreateApplicationFrontendFlowStep(FrontendFlowStepType::BAMBU_FRONTEND_FLOW));
+   design_flow_manager->Exec();
+
+   SynthesizePoints(group, false, HLSMgr, design_flow_manager);
+   if(!exact_evaluation)
+   {
+      return;
+   }
+   /// the points of the previous groups have already been estimated by the parent process
+   for(const auto index : group)
+   {
+      points.at(index).has_estimate = ReadMetrics(GetPointDirectory(index) + "/estimation.txt", points.at(index).estimated);
+   }
+   std::vector<size_t> survivors;
+   for(const auto index : group)
+   {
+      if(!points.at(index).has_estimate)
+      {
+         continue;
+      }
+      bool dominated = false;
+      for(const auto& other : points)
+      {
+         if(other.has_estimate && Dominates(other.estimated, points.at(index).estimated, prune_margin))
+         {
+            dominated = true;
+            break;
+         }
+      }
+      if(dominated)
+      {
+         std::ofstream(GetPointDirectory(index) + "/pruned");
+      }
+      else
+      {
+         survivors.push_back(index);
+      }
+   }
+   SynthesizePoints(survivors, true, HLSMgr, design_flow_manager);
+}
+
+size_t DesignSpaceExploration::WriteParetoFront() const
+{
+   xml_document document;
+   xml_element* root = document.create_root_node("dse");
+   size_t pareto_points = 0;
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "-->Pareto front (area, latency, frequency):");
+   for(const auto& point : points)
+   {
+      xml_element* point_element = root->add_child_element("point");
+      WRITE_XNVM2("name", point.name, point_element);
+      for(const auto& knob : point.knobs)
+      {
+         WRITE_XNVM2(knob.first, knob.second, point_element);
+      }
+      const std::string status = point.status == PointStatus::EVALUATED ? "evaluated" : point.status == PointStatus::PRUNED ? "pruned" : "failed";
+      WRITE_XNVM2("status", status, point_element);
+      if(point.has_estimate)
+      {
+         WRITE_XNVM2("estimated_area", STR(point.estimated.area), point_element);
+         WRITE_XNVM2("estimated_latency", STR(point.estimated.latency), point_element);
+         WRITE_XNVM2("estimated_frequency", STR(point.estimated.frequency), point_element);
+      }
+      if(point.status != PointStatus::EVALUATED)
+      {
+         continue;
+      }
+      bool pareto = true;
+      for(const auto& other : points)
+      {
+         if(other.status == PointStatus::EVALUATED && Dominates(other.actual, point.actual, 0.0))
+         {
+            pareto = false;
+            break;
+         }
+      }
+      WRITE_XNVM2("area", STR(point.actual.area), point_element);
+      WRITE_XNVM2("latency", STR(point.actual.latency), point_element);
+      WRITE_XNVM2("frequency", STR(point.actual.frequency), point_element);
+      WRITE_XNVM2("pareto", pareto ? "true" : "false", point_element);
+      if(pareto)
+      {
+         pareto_points++;
+         std::string configuration;
+         for(const auto& knob : point.knobs)
+         {
+            configuration += " " + knob.first + "=" + knob.second;
+         }
+         INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---" + point.name + ": " + STR(point.actual.area) + ", " + STR(point.actual.latency) + ", " + STR(point.actual.frequency) + " -" + configuration);
+      }
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--");
+   document.write_to_file_formatted(dse_dir + "/dse_pareto.xml");
+   return pareto_points;
+}
+
+int DesignSpaceExploration::Exec()
+{
+   ParseKnobs();
+   for(size_t index = 0; index < points.size(); ++index)
+   {
+      boost::filesystem::remove_all(GetPointDirectory(index));
+   }
+   boost::filesystem::create_directories(dse_dir);
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "-->Design space exploration of " + STR(points.size()) + " configurations");
+
+   /// the points are grouped by the values of the knobs which change the front end
+   std::map<std::string, std::vector<size_t>> groups;
+   for(size_t index = 0; index < points.size(); ++index)
+   {
+      std::string signature;
+      for(const auto& knob : points.at(index).knobs)
+      {
+         if(IsFrontendKnob(knob.first))
+         {
+            signature += knob.first + "=" + knob.second + ";";
+         }
+      }
+      groups[signature].push_back(index);
+   }
+   for(const auto& group : groups)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Front end " + (group.first == "" ? std::string("default") : group.first) + " shared by " + STR(group.second.size()) + " configurations");
+      std::cout.flush();
+      std::cerr.flush();
+      const auto pid = fork();
+      if(pid < 0)
+      {
+         THROW_ERROR("Design space exploration process cannot be started");
+      }
+      if(pid == 0)
+      {
+         int exit_code = EXIT_FAILURE;
+         try
+         {
+            ExploreGroup(group.second);
+            exit_code = EXIT_SUCCESS;
+         }
+         catch(const char* str)
+         {
+            std::cerr << str << std::endl;
+         }
+         catch(const std::string& str)
+         {
+            std::cerr << str << std::endl;
+         }
+         catch(std::exception& e)
+         {
+            std::cerr << e.what() << std::endl;
+         }
+         catch(...)
+         {
+            std::cerr << "Unknown error type" << std::endl;
+         }
+         std::cout.flush();
+         std::cerr.flush();
+         _exit(exit_code);
+      }
+      int status;
+      while(waitpid(pid, &status, 0) < 0)
+      {
+         if(errno != EINTR)
+         {
+            THROW_ERROR("Error while waiting for the design space exploration processes");
+         }
+      }
+      if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Front end " + group.first + " failed");
+      }
+      for(const auto index : group.second)
+      {
+         auto& point = points.at(index);
+         point.has_estimate = ReadMetrics(GetPointDirectory(index) + "/estimation.txt", point.estimated);
+         if(!point.has_estimate)
+         {
+            point.status = PointStatus::FAILED;
+         }
+         else if(!exact_evaluation)
+         {
+            point.actual = point.estimated;
+            point.status = PointStatus::EVALUATED;
+         }
+         else if(boost::filesystem::exists(GetPointDirectory(index) + "/pruned"))
+         {
+            point.status = PointStatus::PRUNED;
+         }
+         else
+         {
+            point.status = ReadMetrics(GetPointDirectory(index) + "/evaluation.txt", point.actual) ? PointStatus::EVALUATED : PointStatus::FAILED;
+         }
+      }
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--");
+   const auto pareto_points = WriteParetoFront();
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Pareto front written in " + dse_dir + "/dse_pareto.xml");
+   return pareto_points ? EXIT_SUCCESS : EXIT_FAILURE;
+}
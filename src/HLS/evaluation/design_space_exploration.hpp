@@ -0,0 +1,244 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_space_exploration.hpp
+ * @brief Design space exploration of the synthesis options sharing the front end among the explored configurations
+ *
+ */
+#ifndef DESIGN_SPACE_EXPLORATION_HPP
+#define DESIGN_SPACE_EXPLORATION_HPP
+
+/// utility include
+#include "refcount.hpp"
+
+/// STD includes
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+REF_FORWARD_DECL(DesignFlowManager);
+REF_FORWARD_DECL(HLS_manager);
+REF_FORWARD_DECL(Parameter);
+
+/// Creates the HLS manager and the design flow manager of a synthesis with all the step factories registered
+typedef std::function<void(const ParameterRef& parameters, HLS_managerRef& HLSMgr, DesignFlowManagerRef& design_flow_manager)> DesignFlowCreator;
+
+/**
+ * Explores the combinations of a set of synthesis options (knobs) and computes the Pareto front of area, latency and frequency.
+ * The knobs and their values are specified by --panda-parameter=dse=<knob>:<value>[|<value>...][,<knob>:...]; the supported knobs are
+ * - scheduler (LIST_BASED, SDC)
+ * - register-allocation (the values of --register-allocation)
+ * - module-binding (the values of --module-binding)
+ * - channels-type (the values of --channels-type)
+ * - clock-period (period in ns)
+ * The scheduler, the channels type and the clock period change the front end, so the configurations which share their values
+ * share a single execution of the front end: it is performed by a process which then forks a process for each configuration,
+ * so that the intermediate representation is shared copy-on-write. At most --panda-parameter=dse-jobs=<n> configurations (default 1)
+ * are synthesized concurrently.
+ * Each configuration is first synthesized without evaluation and estimated as the analytical evaluation does (LUTs and cycles);
+ * when the evaluation is requested (--evaluation) it is performed only on the configurations whose estimates are not dominated
+ * by more than --panda-parameter=dse-prune-margin=<fraction> (default 0.1) by any other estimated configuration.
+ * The results of each configuration are written in <dse-dir>/<configuration>, where dse-dir is set by --panda-parameter=dse-dir=<dir>
+ * (default dse); the Pareto front is written in <dse-dir>/dse_pareto.xml.
+ */
+class DesignSpaceExploration
+{
+ private:
+   /// The status of a design point
+   enum class PointStatus
+   {
+      PENDING,
+      FAILED,
+      PRUNED,
+      EVALUATED
+   };
+
+   /// Area, latency (cycles) and frequency (MHz) of a design point
+   struct Metrics
+   {
+      /// the area
+      double area;
+
+      /// the latency
+      double latency;
+
+      /// the frequency
+      double frequency;
+
+      /// Constructor
+      Metrics();
+   };
+
+   /// A design point
+   struct DesignPoint
+   {
+      /// the name of the configuration; it is also the name of the directory of its results
+      std::string name;
+
+      /// the values of the knobs
+      std::map<std::string, std::string> knobs;
+
+      /// the metrics estimated after the synthesis
+      Metrics estimated;
+
+      /// the metrics of the Pareto analysis (the evaluated ones, if the evaluation has been performed)
+      Metrics actual;
+
+      /// true if the estimate is available
+      bool has_estimate;
+
+      /// the status of the point
+      PointStatus status;
+   };
+
+   /// The set of input parameters; the knobs are set on them in the processes synthesizing the configurations
+   const ParameterRef parameters;
+
+   /// The function which creates the managers of each execution of the front end
+   const DesignFlowCreator create_design_flow;
+
+   /// The debug level
+   int debug_level;
+
+   /// The verbosity level
+   int output_level;
+
+   /// The explored knobs with their values
+   std::vector<std::pair<std::string, std::vector<std::string>>> knobs;
+
+   /// The design points
+   std::vector<DesignPoint> points;
+
+   /// The maximum number of configurations synthesized concurrently
+   size_t max_jobs;
+
+   /// The margin of the pruning based on the estimates
+   double prune_margin;
+
+   /// The directory where the results are written
+   std::string dse_dir;
+
+   /// True if the exact evaluation has been requested
+   bool exact_evaluation;
+
+   /**
+    * Parses the knobs and builds the design points
+    */
+   void ParseKnobs();
+
+   /**
+    * Returns true if the knob changes the result of the front end
+    * @param knob is the name of the knob
+    */
+   static bool IsFrontendKnob(const std::string& knob);
+
+   /**
+    * Sets the options corresponding to a value of a knob
+    * @param knob is the name of the knob
+    * @param value is the value
+    */
+   void ApplyKnob(const std::string& knob, const std::string& value) const;
+
+   /**
+    * Executes the front end once and then synthesizes the design points which share it; executed in a dedicated process
+    * @param group is the set of indices of the design points
+    */
+   void ExploreGroup(const std::vector<size_t>& group);
+
+   /**
+    * Synthesizes a set of design points, each in a process forked after the front end
+    * @param indices are the indices of the design points
+    * @param exact tells if the exact evaluation has to be performed
+    * @param HLSMgr is the HLS manager storing the result of the front end
+    * @param design_flow_manager is the design flow manager which executed the front end
+    */
+   void SynthesizePoints(const std::vector<size_t>& indices, bool exact, const HLS_managerRef& HLSMgr, const DesignFlowManagerRef& design_flow_manager);
+
+   /**
+    * Computes the metrics of the synthesized design
+    * @param HLSMgr is the HLS manager
+    * @param exact tells if the evaluations have to be used in place of the estimates
+    */
+   Metrics ComputeMetrics(const HLS_managerRef& HLSMgr, bool exact) const;
+
+   /**
+    * Returns the directory of the results of a design point
+    * @param index is the index of the design point
+    */
+   std::string GetPointDirectory(size_t index) const;
+
+   /**
+    * Reads the metrics written by the synthesis of a design point
+    * @param file_name is the name of the file
+    * @param metrics is where the metrics are stored
+    * @return true if the file exists
+    */
+   static bool ReadMetrics(const std::string& file_name, Metrics& metrics);
+
+   /**
+    * Returns true if first dominates second, i.e., it is not worse in any objective and it is better by more than margin (relative) in at least one
+    * @param first is the first set of metrics
+    * @param second is the second set of metrics
+    * @param margin is the relative margin
+    */
+   static bool Dominates(const Metrics& first, const Metrics& second, double margin);
+
+   /**
+    * Prints the Pareto front and writes it with all the design points in <dse-dir>/dse_pareto.xml
+    * @return the number of points in the Pareto front
+    */
+   size_t WriteParetoFront() const;
+
+ public:
+   /**
+    * Constructor
+    * @param parameters is the set of input parameters
+    * @param create_design_flow is the function which creates the managers of the synthesis, the same used by bambu
+    */
+   DesignSpaceExploration(const ParameterRef parameters, const DesignFlowCreator& create_design_flow);
+
+   /**
+    * Destructor
+    */
+   ~DesignSpaceExploration();
+
+   /**
+    * Explores the design space
+    * @return the exit code of bambu
+    */
+   int Exec();
+};
+typedef refcount<DesignSpaceExploration> DesignSpaceExplorationRef;
+#endif
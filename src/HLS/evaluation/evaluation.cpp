@@ -108,6 +108,11 @@ const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationC
                ret.insert(std::make_tuple(HLSFlowStep_Type::DRY_RUN_EVALUATION, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::WHOLE_APPLICATION));
                break;
             }
+            case Evaluation_Mode::ANALYTICAL:
+            {
+               ret.insert(std::make_tuple(HLSFlowStep_Type::ANALYTICAL_EVALUATION, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::WHOLE_APPLICATION));
+               break;
+            }
 #if HAVE_EXPERIMENTAL
             case Evaluation_Mode::ESTIMATION:
             {
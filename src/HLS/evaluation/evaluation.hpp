@@ -53,6 +53,7 @@ enum class Evaluation_Mode
 {
    NONE,
    DRY_RUN,
+   ANALYTICAL,
 #if HAVE_EXPERIMENTAL
    ESTIMATION,
 #endif
@@ -44,17 +44,46 @@
 /// Header include
 #include "synthesis_evaluation.hpp"
 
+/// HLS/evaluation include
+#include "analytical_evaluation.hpp"
+
 ///. include
 #include "Parameter.hpp"
 
-/// behavior include
+/// behavior includes
 #include "call_graph_manager.hpp"
+#include "function_behavior.hpp"
+#include "op_graph.hpp"
+
+/// design_flows includes
+#include "design_flow_graph.hpp"
+#include "design_flow_manager.hpp"
 
 /// HLS include
 #include "hls.hpp"
 #include "hls_constraints.hpp"
 #include "hls_manager.hpp"
 
+/// HLS/binding/module include
+#include "fu_binding.hpp"
+
+/// HLS/virtual_components include
+#include "generic_obj.hpp"
+
+/// HLS/module_allocation include
+#include "allocation_information.hpp"
+
+/// technology/physical_library include
+#include "technology_node.hpp"
+
+/// utility include
+#include "dbgPrintHelper.hpp"
+
+/// STD includes
+#include <algorithm>
+#include <map>
+#include <set>
+
 /// technology/physical_library/models
 #include "area_model.hpp"
 #include "time_model.hpp"
@@ -72,6 +101,125 @@ SynthesisEvaluation::SynthesisEvaluation(const ParameterConstRef _Param, const H
 
 SynthesisEvaluation::~SynthesisEvaluation() = default;
 
+void SynthesisEvaluation::ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type)
+{
+   if(relationship_type == INVALIDATION_RELATIONSHIP and not timing_closure_functions.empty())
+   {
+      /// the HLS of the functions affected by the back-annotated delays is repeated
+      const auto design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
+      for(const auto function : timing_closure_functions)
+      {
+         const vertex initialize_step = design_flow_manager.lock()->GetDesignFlowStep(HLSFunctionStep::ComputeSignature(HLSFlowStep_Type::INITIALIZE_HLS, HLSFlowStepSpecializationConstRef(), function));
+         if(initialize_step != NULL_VERTEX)
+         {
+            relationship.insert(design_flow_graph->CGetDesignFlowStepInfo(initialize_step)->design_flow_step);
+         }
+      }
+      timing_closure_functions.clear();
+   }
+   EvaluationBaseStep::ComputeRelationships(relationship, relationship_type);
+}
+
+bool SynthesisEvaluation::BackAnnotateTiming()
+{
+   if(not parameters->IsParameter("timing-closure"))
+      return false;
+   const time_modelRef time_m = HLSMgr->get_backend_flow()->get_timing_results();
+   if(not time_m or HLSMgr->timing_closure_iterations >= parameters->GetParameter<unsigned int>("timing-closure"))
+      return false;
+   const CallGraphManagerConstRef CGM = HLSMgr->CGetCallGraphManager();
+   const double clock_period = HLSMgr->get_HLS(*(CGM->GetRootFunctions().begin()))->HLS_C->get_clock_period();
+   const double slack = clock_period - time_m->get_execution_time();
+   /// the functions whose operation timings change
+   CustomOrderedSet<unsigned int> annotated_functions;
+   if(slack >= 0.0)
+   {
+      /// the chaining is relaxed only if it has been tightened by a previous iteration and the slack is large
+      if(HLSMgr->timing_back_annotation.empty() or slack < 0.25 * clock_period)
+         return false;
+      for(auto& function_annotation : HLSMgr->timing_back_annotation)
+      {
+         for(auto& operation_delay : function_annotation.second)
+         {
+            operation_delay.second /= 2;
+         }
+         annotated_functions.insert(function_annotation.first);
+      }
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Timing closure: slack " + STR(slack) + "ns, relaxing the back-annotated delays");
+   }
+   else
+   {
+      /// instance name of each functional unit -> (function, (functional unit type, instance number))
+      std::map<std::string, std::pair<unsigned int, std::pair<unsigned int, unsigned int>>> instances;
+      for(const auto function : CGM->GetReachedBodyFunctions())
+      {
+         const hlsRef HLS = HLSMgr->get_HLS(function);
+         if(not HLS or not HLS->Rfu)
+            continue;
+         for(const auto fu_type : HLS->Rfu->get_allocation_list())
+         {
+            for(unsigned int num = 0; num < HLS->Rfu->get_number(fu_type); num++)
+            {
+               const generic_objRef fu_obj = HLS->Rfu->get(fu_type, num);
+               if(fu_obj)
+                  instances[fu_obj->get_string()] = std::make_pair(function, std::make_pair(fu_type, num));
+            }
+         }
+      }
+      /// the violation of each path is spread among the functional unit instances it traverses
+      std::map<std::pair<unsigned int, std::pair<unsigned int, unsigned int>>, double> extra_delays;
+      for(const auto& path : HLSMgr->get_backend_flow()->GetCriticalPaths())
+      {
+         if(path.slack >= 0.0)
+            continue;
+         std::set<std::pair<unsigned int, std::pair<unsigned int, unsigned int>>> path_units;
+         for(const auto& cell : path.cells)
+         {
+            for(const auto& level : convert_string_to_vector<std::string>(cell, "/"))
+            {
+               if(instances.find(level) != instances.end())
+                  path_units.insert(instances.find(level)->second);
+            }
+         }
+         for(const auto& unit : path_units)
+         {
+            extra_delays[unit] = std::max(extra_delays[unit], -path.slack / static_cast<double>(path_units.size()));
+         }
+      }
+      if(extra_delays.empty())
+      {
+         THROW_WARNING("Timing closure: no functional unit found on the violating paths");
+         return false;
+      }
+      /// the delay is annotated on the operations executed by the instance, not on all the units of the same type
+      for(const auto& extra_delay : extra_delays)
+      {
+         const auto function = extra_delay.first.first;
+         const auto op_graph = HLSMgr->CGetFunctionBehavior(function)->CGetOpGraph(FunctionBehavior::CFG);
+         for(const auto op : HLSMgr->get_HLS(function)->Rfu->get_operations(extra_delay.first.second.first, extra_delay.first.second.second))
+         {
+            HLSMgr->timing_back_annotation[function][op_graph->CGetOpNodeInfo(op)->GetNodeId()] += extra_delay.second;
+         }
+         annotated_functions.insert(function);
+      }
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Timing closure: slack " + STR(slack) + "ns, back-annotated " + STR(extra_delays.size()) + " functional units");
+   }
+   HLSMgr->timing_closure_iterations++;
+   /// the HLS is repeated for the annotated functions and for the functions instantiating them
+   for(const auto function : CGM->GetReachedBodyFunctions())
+   {
+      const auto reached = CGM->GetReachedBodyFunctionsFrom(function);
+      if(std::any_of(annotated_functions.begin(), annotated_functions.end(), [&](unsigned int annotated) { return reached.find(annotated) != reached.end(); }))
+      {
+         timing_closure_functions.insert(function);
+         HLSMgr->GetFunctionBehavior(function)->UpdateBBVersion();
+      }
+   }
+   HLSMgr->hdl_files.clear();
+   HLSMgr->aux_files.clear();
+   return true;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> SynthesisEvaluation::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
    CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>> ret;
@@ -116,6 +264,11 @@ const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationC
 DesignFlowStep_Status SynthesisEvaluation::InternalExec()
 {
    HLSMgr->get_backend_flow()->ExecuteSynthesis();
+   if(BackAnnotateTiming())
+   {
+      /// the evaluation is performed on the last iteration
+      return DesignFlowStep_Status::SUCCESS;
+   }
    std::string objective_string = parameters->getOption<std::string>(OPT_evaluation_objectives);
    std::vector<std::string> objective_vector = convert_string_to_vector<std::string>(objective_string, ",");
    bool printed_area = false;
@@ -219,5 +372,12 @@ DesignFlowStep_Status SynthesisEvaluation::InternalExec()
          HLSMgr->evaluations["REGISTERS"] = std::vector<double>(1, reg);
       }
    }
+   /// the actual resources are used to calibrate the analytical evaluation of the next designs
+   const auto clb = GetPointer<clb_model>(HLSMgr->get_backend_flow()->get_used_resources());
+   if(clb)
+   {
+      const AnalyticalEvaluation::Resources actual(clb->get_resource_value(clb_model::SLICE_LUTS), clb->get_resource_value(clb_model::REGISTERS), clb->get_resource_value(clb_model::DSP), clb->get_resource_value(clb_model::BRAM));
+      AnalyticalEvaluation::StoreCalibrationSample(parameters, HLSMgr->get_backend_flow()->GetCacheKey(), AnalyticalEvaluation::EstimateResources(HLSMgr, parameters), actual);
+   }
    return DesignFlowStep_Status::SUCCESS;
 }
@@ -46,7 +46,8 @@
 /// superclass include
 #include "evaluation_base_step.hpp"
 
-/// utility include
+/// utility includes
+#include "custom_set.hpp"
 #include "refcount.hpp"
 
 /**
@@ -55,6 +56,19 @@
  */
 class SynthesisEvaluation : public EvaluationBaseStep
 {
+ private:
+   /// The functions whose synthesis has to be repeated with the back-annotated delays
+   CustomOrderedSet<unsigned int> timing_closure_functions;
+
+   /**
+    * Back-annotate the extra delay of the violating paths reported by the synthesis on the operations bound to the functional unit instances they traverse.
+    * Only the functions containing these instances and the functions instantiating them are synthesized again.
+    * The number of iterations is bounded by --panda-parameter=timing-closure=<n>; when the target period is met with a large slack,
+    * the delays annotated by the previous iterations are halved to relax the chaining.
+    * @return true if the synthesis of the functions has to be repeated
+    */
+   bool BackAnnotateTiming();
+
  protected:
    /**
     * Return the set of analyses in relationship with this design step
@@ -73,6 +87,13 @@ class SynthesisEvaluation : public EvaluationBaseStep
     */
    ~SynthesisEvaluation() override;
 
+   /**
+    * Compute the relationships of a step with other steps
+    * @param dependencies is where relationships will be stored
+    * @param relationship_type is the type of relationship to be computed
+    */
+   void ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type) override;
+
    /**
     * Execute the step
     * @return the exit status of this step
@@ -61,13 +61,22 @@
 
 /// STL include
 #include <list>
+#include <string>
+#include <vector>
 
 /// tree includes
 #include "behavioral_helper.hpp"
+#include "ext_tree_node.hpp"
+#include "tree_basic_block.hpp"
+#include "tree_helper.hpp"
 #include "tree_manager.hpp"
+#include "tree_node.hpp"
+#include "tree_reindex.hpp"
 
 /// utility include
+#include "custom_map.hpp"
 #include "dbgPrintHelper.hpp"
+#include "string_manipulation.hpp"
 #include "utility.hpp"
 
 OmpFunctionAllocationCS::OmpFunctionAllocationCS(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, const DesignFlowManagerConstRef _design_flow_manager)
@@ -90,12 +99,32 @@ DesignFlowStep_Status OmpFunctionAllocationCS::Exec()
    std::list<vertex> sorted_functions;
    call_graph->TopologicalSort(sorted_functions);
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Computing functions to be parallelized");
+   /// the functions whose calls have to be executed as dataflow stages
+   CustomSet<std::string> dataflow_names;
+   if(parameters->IsParameter("dataflow"))
+   {
+      for(const auto& dataflow_name : SplitString(parameters->GetParameter<std::string>("dataflow"), ","))
+      {
+         if(dataflow_name != "")
+         {
+            dataflow_names.insert(dataflow_name);
+         }
+      }
+   }
    int cycleInd = 0;
    for(const auto function : sorted_functions)
    {
       bool function_classification_found = false;
       const auto function_id = call_graph_manager->get_function(function);
       std::cout << cycleInd << " " << HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name() << std::endl;
+      if(dataflow_names.find(HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name()) != dataflow_names.end())
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Found dataflow function " + HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name());
+         omp_functions->dataflow_functions.insert(function_id);
+         ComputeDataflowStages(function_id);
+         ++cycleInd;
+         continue;
+      }
       if(HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->GetOmpForDegree()) // look for OMP function, add it to struct
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Found omp for wrapper " + HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name());
@@ -108,7 +137,7 @@ DesignFlowStep_Status OmpFunctionAllocationCS::Exec()
       { // if current function is called by parallel then is kernel
          const auto source = boost::source(*ie, *call_graph);
          const auto source_id = call_graph_manager->get_function(source);
-         if(omp_functions->omp_for_wrappers.find(source_id) != omp_functions->omp_for_wrappers.end())
+         if(omp_functions->omp_for_wrappers.find(source_id) != omp_functions->omp_for_wrappers.end() or omp_functions->dataflow_functions.find(source_id) != omp_functions->dataflow_functions.end())
          {
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Found kernel function: " + HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name());
             omp_functions->kernel_functions.insert(function_id);
@@ -148,7 +177,8 @@ DesignFlowStep_Status OmpFunctionAllocationCS::Exec()
       { // if current function is called by parallel then is kernel
          const auto target = boost::target(*ie, *call_graph);
          const auto target_id = call_graph_manager->get_function(target);
-         if(omp_functions->omp_for_wrappers.find(target_id) != omp_functions->omp_for_wrappers.end() or omp_functions->hierarchical_functions.find(target_id) != omp_functions->hierarchical_functions.end())
+         if(omp_functions->omp_for_wrappers.find(target_id) != omp_functions->omp_for_wrappers.end() or omp_functions->dataflow_functions.find(target_id) != omp_functions->dataflow_functions.end() or
+            omp_functions->hierarchical_functions.find(target_id) != omp_functions->hierarchical_functions.end())
          {
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Found hierarchical function: " + HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name());
             omp_functions->hierarchical_functions.insert(function_id);
@@ -165,3 +195,127 @@ void OmpFunctionAllocationCS::Initialize()
    HLS_step::Initialize();
    HLSMgr->Rfuns = functionsRef(new OmpFunctions(HLSMgr));
 }
+
+void OmpFunctionAllocationCS::ComputeDataflowStages(unsigned int function_id)
+{
+   auto omp_functions = GetPointer<OmpFunctions>(HLSMgr->Rfuns);
+   const auto TM = HLSMgr->get_tree_manager();
+   const auto function_name = HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->get_function_name();
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Computing dataflow stages of " + function_name);
+   const auto fd = GetPointer<const function_decl>(TM->get_tree_node_const(function_id));
+   THROW_ASSERT(fd and fd->body, "");
+   const auto sl = GetPointer<const statement_list>(GET_NODE(fd->body));
+   auto& stages = omp_functions->dataflow_stages[function_id];
+   /// for each local array, the stages to which it is passed
+   CustomMap<unsigned int, CustomOrderedSet<size_t>> array_stages;
+
+   /// the body has to be a sequence of basic blocks
+   auto current_bb = sl->list_of_bloc.at(BB_ENTRY)->list_of_succ.front();
+   while(current_bb != BB_EXIT)
+   {
+      const auto& block = sl->list_of_bloc.at(current_bb);
+      if(block->list_of_succ.size() != 1 or not block->CGetPhiList().empty())
+      {
+         THROW_ERROR("Dataflow function " + function_name + " must be a sequence of calls without control flow");
+      }
+      for(const auto& stmt : block->CGetStmtList())
+      {
+         const auto stmt_node = GET_NODE(stmt);
+         switch(stmt_node->get_kind())
+         {
+            case gimple_call_K:
+            {
+               const auto gc = GetPointer<const gimple_call>(stmt_node);
+               const auto ae = GetPointer<const addr_expr>(GET_NODE(gc->fn));
+               if(not ae or GET_NODE(ae->op)->get_kind() != function_decl_K)
+               {
+                  THROW_ERROR("Dataflow function " + function_name + " contains an indirect call: " + stmt_node->ToString());
+               }
+               for(const auto& arg : gc->args)
+               {
+                  auto actual_arg = GET_NODE(arg);
+                  if(actual_arg->get_kind() == ssa_name_K)
+                  {
+                     const auto def = GetPointer<const gimple_assign>(GET_NODE(GetPointer<const ssa_name>(actual_arg)->CGetDefStmt()));
+                     if(def and GET_NODE(def->op1)->get_kind() == addr_expr_K)
+                     {
+                        actual_arg = GET_NODE(def->op1);
+                     }
+                  }
+                  if(actual_arg->get_kind() == addr_expr_K)
+                  {
+                     auto array = GetPointer<const addr_expr>(actual_arg)->op;
+                     /// &array[0]
+                     const auto ar = GetPointer<const array_ref>(GET_NODE(array));
+                     if(ar and GET_NODE(ar->op1)->get_kind() == integer_cst_K and tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(ar->op1))) == 0)
+                     {
+                        array = ar->op0;
+                     }
+                     const auto vd = GetPointer<const var_decl>(GET_NODE(array));
+                     if(not vd or vd->static_flag or not vd->scpe or GET_INDEX_NODE(vd->scpe) != function_id)
+                     {
+                        THROW_ERROR("Dataflow function " + function_name + " passes to a stage an address which is not a local array: " + stmt_node->ToString());
+                     }
+                     array_stages[GET_INDEX_NODE(array)].insert(stages.size());
+                  }
+               }
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Stage " + STR(stages.size()) + ": " + stmt_node->ToString());
+               stages.push_back(stmt->index);
+               break;
+            }
+            case gimple_assign_K:
+            {
+               const auto ga = GetPointer<const gimple_assign>(stmt_node);
+               if(GET_NODE(ga->op1)->get_kind() != addr_expr_K or GET_NODE(ga->op0)->get_kind() != ssa_name_K)
+               {
+                  THROW_ERROR("Dataflow function " + function_name + " can only contain calls: " + stmt_node->ToString());
+               }
+               break;
+            }
+            case gimple_return_K:
+            {
+               if(GetPointer<const gimple_return>(stmt_node)->op)
+               {
+                  THROW_ERROR("Dataflow function " + function_name + " cannot return a value");
+               }
+               break;
+            }
+            case gimple_label_K:
+            case gimple_nop_K:
+            case gimple_pragma_K:
+            {
+               break;
+            }
+            default:
+            {
+               THROW_ERROR("Dataflow function " + function_name + " can only contain calls: " + stmt_node->ToString());
+            }
+         }
+      }
+      current_bb = block->list_of_succ.front();
+   }
+   if(stages.empty())
+   {
+      THROW_ERROR("Dataflow function " + function_name + " does not call any function");
+   }
+
+   /// each local array has to be written by a stage and read by the following one
+   auto& channels = omp_functions->dataflow_channels[function_id];
+   channels.resize(stages.size(), 0);
+   for(const auto& array_stage : array_stages)
+   {
+      const auto& users = array_stage.second;
+      const auto array_name = HLSMgr->CGetFunctionBehavior(function_id)->CGetBehavioralHelper()->PrintVariable(array_stage.first);
+      if(users.size() != 2 or *(users.rbegin()) != *(users.begin()) + 1)
+      {
+         THROW_ERROR("Array " + array_name + " of dataflow function " + function_name + " has to be shared by exactly two consecutive stages");
+      }
+      if(channels[*(users.begin())])
+      {
+         THROW_ERROR("Stages " + STR(*(users.begin())) + " and " + STR(*(users.begin()) + 1) + " of dataflow function " + function_name + " share more than one array");
+      }
+      channels[*(users.begin())] = array_stage.first;
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Channel between stage " + STR(*(users.begin())) + " and stage " + STR(*(users.begin()) + 1) + ": " + array_name);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Computed dataflow stages of " + function_name);
+}
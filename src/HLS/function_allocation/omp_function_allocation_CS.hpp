@@ -46,6 +46,13 @@
 
 class OmpFunctionAllocationCS : public fun_dominator_allocation
 {
+ private:
+   /**
+    * Compute the stages of a dataflow function and the arrays through which they communicate
+    * @param function_id is the index of the dataflow function
+    */
+   void ComputeDataflowStages(unsigned int function_id);
+
  public:
    /**
     * Constructor
@@ -67,6 +67,11 @@ std::ostream& operator<<(std::ostream& os, const OmpFunctions* omp_functions)
    {
       os << std::string(indentation + 2, ' ') << HLSMgr->CGetFunctionBehavior(omp_for_wrapper)->CGetBehavioralHelper()->get_function_name() << std::endl;
    }
+   os << std::string(indentation, ' ') << "Functions whose stages are executed in dataflow:" << std::endl;
+   for(const auto dataflow_function : omp_functions->dataflow_functions)
+   {
+      os << std::string(indentation + 2, ' ') << HLSMgr->CGetFunctionBehavior(dataflow_function)->CGetBehavioralHelper()->get_function_name() << std::endl;
+   }
    os << std::string(indentation, ' ') << "Functions that are kernel:" << std::endl;
    for(const auto kernel_functions : omp_functions->kernel_functions)
    {
@@ -48,7 +48,11 @@
 #include <ostream>
 #include <string>
 
+/// STL include
+#include <vector>
+
 /// utility include
+#include "custom_map.hpp"
 #include "custom_set.hpp"
 #include "refcount.hpp"
 
@@ -88,6 +92,15 @@ class OmpFunctions : public functions
    /// The set of functions propagating accesses to locks in parallel
    CustomSet<unsigned int> locks_parallel_comunication;
 
+   /// The set of functions whose calls are executed as concurrent dataflow stages
+   CustomSet<unsigned int> dataflow_functions;
+
+   /// For each dataflow function, the calls to its stages in execution order
+   CustomMap<unsigned int, std::vector<unsigned int>> dataflow_stages;
+
+   /// For each dataflow function, the local arrays written by stage i and read by stage i+1 (0 if the stages do not share any array)
+   CustomMap<unsigned int, std::vector<unsigned int>> dataflow_channels;
+
    /**
     * Constructor
     * @param HLSMgr is the HLS manager
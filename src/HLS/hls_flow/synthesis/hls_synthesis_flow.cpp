@@ -50,6 +50,9 @@
 /// HLS include
 #include "hls_manager.hpp"
 
+/// HLS/function_allocation include
+#include "omp_functions.hpp"
+
 /// STL include
 #include "custom_set.hpp"
 #include <tuple>
@@ -81,7 +84,12 @@ const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationC
             ret.insert(std::make_tuple(HLSFlowStep_Type::OMP_FUNCTION_ALLOCATION_CS, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
             if(design_flow_manager.lock()->GetStatus(HLS_step::ComputeSignature(HLSFlowStep_Type::OMP_FUNCTION_ALLOCATION_CS, HLSFlowStepSpecializationConstRef())) == DesignFlowStep_Status::SUCCESS)
             {
-               if(behavioral_helper->IsOmpBodyLoop())
+               const auto omp_functions = GetPointer<const OmpFunctions>(HLSMgr->Rfuns);
+               if(omp_functions and omp_functions->dataflow_functions.find(funId) != omp_functions->dataflow_functions.end())
+               {
+                  ret.insert(std::make_tuple(HLSFlowStep_Type::OMP_DATAFLOW_CS_SYNTHESIS_FLOW, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
+               }
+               else if(behavioral_helper->IsOmpBodyLoop())
                {
                   ret.insert(std::make_tuple(HLSFlowStep_Type::OMP_BODY_LOOP_SYNTHESIS_FLOW, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
                }
@@ -57,11 +57,13 @@
 #include "TopEntityMemoryMapped.hpp"
 #include "top_entity.hpp"
 #include "top_entity_cs.hpp"
+#include "top_entity_dataflow_cs.hpp"
 #include "top_entity_parallel_cs.hpp"
 
 /// HLS/architecture_creator/datapath_creation
 #include "classic_datapath.hpp"
 #include "datapath_cs.hpp"
+#include "datapath_dataflow_cs.hpp"
 #include "datapath_parallel_cs.hpp"
 
 /// ///HLS/architecture_creator/controller_creation
@@ -108,12 +110,14 @@
 #include "values_scheme.hpp"
 
 /// HLS/chaining
+#include "chaining_retiming.hpp"
 #if HAVE_EXPERIMENTAL
 #include "epdg_sched_based_chaining_computation.hpp"
 #endif
 #include "sched_based_chaining_computation.hpp"
 
 /// HLS/evaluation
+#include "analytical_evaluation.hpp"
 #include "dry_run_evaluation.hpp"
 #include "evaluation.hpp"
 
@@ -162,6 +166,7 @@
 #include "omp_for_wrapper_synthesis_flow.hpp"
 #endif
 #if HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#include "omp_dataflow_cs_synthesis_flow.hpp"
 #include "omp_for_wrapper_cs_synthesis_flow.hpp"
 #endif
 #include "standard_hls.hpp"
@@ -308,6 +313,11 @@ DesignFlowStepRef HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type t
          design_flow_step = DesignFlowStepRef(new allocation(parameters, HLS_mgr, funId, design_flow_manager.lock()));
          break;
       }
+      case HLSFlowStep_Type::ANALYTICAL_EVALUATION:
+      {
+         design_flow_step = DesignFlowStepRef(new AnalyticalEvaluation(parameters, HLS_mgr, design_flow_manager.lock()));
+         break;
+      }
 #if HAVE_EXPERIMENTAL
       case HLSFlowStep_Type::AREA_ESTIMATION:
       {
@@ -342,6 +352,11 @@ DesignFlowStepRef HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type t
          break;
       }
 #endif
+      case HLSFlowStep_Type::CHAINING_RETIMING:
+      {
+         design_flow_step = DesignFlowStepRef(new ChainingRetiming(parameters, HLS_mgr, funId, design_flow_manager.lock()));
+         break;
+      }
       case HLSFlowStep_Type::CHORDAL_COLORING_REGISTER_BINDING:
       {
          design_flow_step = DesignFlowStepRef(new chordal_coloring_register(parameters, HLS_mgr, funId, design_flow_manager.lock()));
@@ -357,6 +372,11 @@ DesignFlowStepRef HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type t
          design_flow_step = DesignFlowStepRef(new datapath_cs(parameters, HLS_mgr, funId, design_flow_manager.lock(), HLSFlowStep_Type::DATAPATH_CS_CREATOR));
          break;
       }
+      case HLSFlowStep_Type::DATAPATH_CS_DATAFLOW_CREATOR:
+      {
+         design_flow_step = DesignFlowStepRef(new datapath_dataflow_cs(parameters, HLS_mgr, funId, design_flow_manager.lock(), HLSFlowStep_Type::DATAPATH_CS_DATAFLOW_CREATOR));
+         break;
+      }
       case HLSFlowStep_Type::DATAPATH_CS_PARALLEL_CREATOR:
       {
          design_flow_step = DesignFlowStepRef(new datapath_parallel_cs(parameters, HLS_mgr, funId, design_flow_manager.lock(), HLSFlowStep_Type::DATAPATH_CS_PARALLEL_CREATOR));
@@ -657,6 +677,11 @@ DesignFlowStepRef HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type t
          design_flow_step = DesignFlowStepRef(new OmpForWrapperCSSynthesisFlow(parameters, HLS_mgr, funId, design_flow_manager.lock()));
          break;
       }
+      case HLSFlowStep_Type::OMP_DATAFLOW_CS_SYNTHESIS_FLOW:
+      {
+         design_flow_step = DesignFlowStepRef(new OmpDataflowCSSynthesisFlow(parameters, HLS_mgr, funId, design_flow_manager.lock()));
+         break;
+      }
 #endif
 #if HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
       case HLSFlowStep_Type::OMP_FUNCTION_ALLOCATION:
@@ -771,6 +796,11 @@ DesignFlowStepRef HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type t
          break;
       }
 
+      case HLSFlowStep_Type::TOP_ENTITY_CS_DATAFLOW_CREATION:
+      {
+         design_flow_step = DesignFlowStepRef(new top_entity_dataflow_cs(parameters, HLS_mgr, funId, design_flow_manager.lock(), HLSFlowStep_Type::TOP_ENTITY_CS_DATAFLOW_CREATION));
+         break;
+      }
       case HLSFlowStep_Type::TOP_ENTITY_CS_PARALLEL_CREATION:
       {
          design_flow_step = DesignFlowStepRef(new top_entity_parallel_cs(parameters, HLS_mgr, funId, design_flow_manager.lock(), HLSFlowStep_Type::TOP_ENTITY_CS_PARALLEL_CREATION));
@@ -872,6 +902,7 @@ const DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(const CustomUnord
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Creating step " + HLS_step::EnumToName(hls_flow_step.first));
       switch(hls_flow_step.first)
       {
+         case HLSFlowStep_Type::ANALYTICAL_EVALUATION:
          case HLSFlowStep_Type::DRY_RUN_EVALUATION:
          case HLSFlowStep_Type::EVALUATION:
          case HLSFlowStep_Type::GENERATE_HDL:
@@ -923,6 +954,7 @@ const DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(const CustomUnord
 #if HAVE_EXPERIMENTAL
          case HLSFlowStep_Type::CHAINING_BASED_LIVENESS:
 #endif
+         case HLSFlowStep_Type::CHAINING_RETIMING:
          case HLSFlowStep_Type::CHORDAL_COLORING_REGISTER_BINDING:
          case HLSFlowStep_Type::CLASSIC_DATAPATH_CREATOR:
 #if HAVE_EXPERIMENTAL
@@ -932,6 +964,7 @@ const DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(const CustomUnord
          case HLSFlowStep_Type::CONTROL_FLOW_CHECKER:
          case HLSFlowStep_Type::C_TESTBENCH_EXECUTION:
          case HLSFlowStep_Type::DATAPATH_CS_CREATOR:
+         case HLSFlowStep_Type::DATAPATH_CS_DATAFLOW_CREATOR:
          case HLSFlowStep_Type::DATAPATH_CS_PARALLEL_CREATOR:
 #if HAVE_BEAGLE
          case HLSFlowStep_Type::DSE_DESIGN_FLOW:
@@ -996,6 +1029,7 @@ const DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(const CustomUnord
 #endif
 #if HAVE_FROM_PRAGMA_BUILT
          case HLSFlowStep_Type::OMP_FOR_WRAPPER_CS_SYNTHESIS_FLOW:
+         case HLSFlowStep_Type::OMP_DATAFLOW_CS_SYNTHESIS_FLOW:
 #endif
 #if HAVE_FROM_PRAGMA_BUILT
          case HLSFlowStep_Type::OMP_FUNCTION_ALLOCATION:
@@ -1029,6 +1063,7 @@ const DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(const CustomUnord
 #endif
          case HLSFlowStep_Type::TOP_ENTITY_CREATION:
          case HLSFlowStep_Type::TOP_ENTITY_CS_CREATION:
+         case HLSFlowStep_Type::TOP_ENTITY_CS_DATAFLOW_CREATION:
          case HLSFlowStep_Type::TOP_ENTITY_CS_PARALLEL_CREATION:
          case HLSFlowStep_Type::TOP_ENTITY_MEMORY_MAPPED_CREATION:
          case HLSFlowStep_Type::UNIQUE_MODULE_BINDING:
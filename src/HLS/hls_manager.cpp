@@ -88,6 +88,8 @@ HLS_manager::HLS_manager(const ParameterConstRef _Param, const HLS_targetRef _HL
       ,
       aadl_information(new AadlInformation())
 #endif
+      ,
+      timing_closure_iterations(0)
 {
 #if HAVE_TASTE
    if(Param->isOption(OPT_context_switch))
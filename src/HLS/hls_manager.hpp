@@ -131,6 +131,12 @@ class HLS_manager : public application_manager
    /// global resource constraints
    std::map<std::pair<std::string, std::string>, unsigned> global_resource_constraints;
 
+   /// delays back-annotated from the post-synthesis timing reports: function_id->operation index->additional delay (ns)
+   std::map<unsigned int, std::map<unsigned int, double>> timing_back_annotation;
+
+   /// number of timing closure iterations already performed
+   unsigned int timing_closure_iterations;
+
    /**
     * Constructor.
     */
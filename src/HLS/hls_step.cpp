@@ -129,6 +129,8 @@ const std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type
          return "AddLibrary";
       case HLSFlowStep_Type::ALLOCATION:
          return "Allocation";
+      case HLSFlowStep_Type::ANALYTICAL_EVALUATION:
+         return "AnalyticalEvaluation";
 #if HAVE_EXPERIMENTAL
       case HLSFlowStep_Type::AREA_ESTIMATION:
          return "AreaEstimation";
@@ -145,12 +147,16 @@ const std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type
       case HLSFlowStep_Type::CHAINING_BASED_LIVENESS:
          return "ChainingBasedLiveness";
 #endif
+      case HLSFlowStep_Type::CHAINING_RETIMING:
+         return "ChainingRetiming";
       case HLSFlowStep_Type::CHORDAL_COLORING_REGISTER_BINDING:
          return "ChordalColoringRegisterBinding";
       case HLSFlowStep_Type::CLASSIC_DATAPATH_CREATOR:
          return "ClassicDatapathCreator";
       case HLSFlowStep_Type::DATAPATH_CS_CREATOR:
          return "DatapathCreatorCS";
+      case HLSFlowStep_Type::DATAPATH_CS_DATAFLOW_CREATOR:
+         return "DatapathCreatorCSDataflow";
       case HLSFlowStep_Type::DATAPATH_CS_PARALLEL_CREATOR:
          return "DatapathCreatorCSParallel";
       case HLSFlowStep_Type::CLASSICAL_HLS_SYNTHESIS_FLOW:
@@ -287,6 +293,8 @@ const std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type
 #if HAVE_FROM_PRAGMA_BUILT
       case HLSFlowStep_Type::OMP_FOR_WRAPPER_CS_SYNTHESIS_FLOW:
          return "OmpForWrapperCSSynthesisFlow";
+      case HLSFlowStep_Type::OMP_DATAFLOW_CS_SYNTHESIS_FLOW:
+         return "OmpDataflowCSSynthesisFlow";
 #endif
 #if HAVE_FROM_PRAGMA_BUILT
       case HLSFlowStep_Type::OMP_FUNCTION_ALLOCATION:
@@ -342,6 +350,8 @@ const std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type
          return "TopEntityCreation";
       case HLSFlowStep_Type::TOP_ENTITY_CS_CREATION:
          return "TopEntityCSCreation";
+      case HLSFlowStep_Type::TOP_ENTITY_CS_DATAFLOW_CREATION:
+         return "TopEntityCSDataflowCreation";
       case HLSFlowStep_Type::TOP_ENTITY_CS_PARALLEL_CREATION:
          return "TopEntityCSParallelCreation";
       case HLSFlowStep_Type::TOP_ENTITY_MEMORY_MAPPED_CREATION:
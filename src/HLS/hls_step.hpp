@@ -100,6 +100,7 @@ enum class HLSFlowStep_Type
    UNKNOWN = 0,
    ADD_LIBRARY,
    ALLOCATION,
+   ANALYTICAL_EVALUATION,
 #if HAVE_EXPERIMENTAL
    AREA_ESTIMATION,
    AXI4LITE_INTERFACE_GENERATION,
@@ -110,9 +111,11 @@ enum class HLSFlowStep_Type
 #if HAVE_EXPERIMENTAL
    CHAINING_BASED_LIVENESS,
 #endif
+   CHAINING_RETIMING,
    CHORDAL_COLORING_REGISTER_BINDING,
    CLASSIC_DATAPATH_CREATOR,
    DATAPATH_CS_CREATOR,
+   DATAPATH_CS_DATAFLOW_CREATOR,
    DATAPATH_CS_PARALLEL_CREATOR,
 #if HAVE_EXPERIMENTAL
    CLOCK_SLACK_ESTIMATION,
@@ -199,6 +202,7 @@ enum class HLSFlowStep_Type
 #endif
 #if HAVE_FROM_PRAGMA_BUILT
    OMP_FOR_WRAPPER_CS_SYNTHESIS_FLOW,
+   OMP_DATAFLOW_CS_SYNTHESIS_FLOW,
 #endif
 #if HAVE_FROM_PRAGMA_BUILT
    OMP_FUNCTION_ALLOCATION,
@@ -236,6 +240,7 @@ enum class HLSFlowStep_Type
    TIME_ESTIMATION,
 #endif
    TOP_ENTITY_CS_CREATION,
+   TOP_ENTITY_CS_DATAFLOW_CREATION,
    TOP_ENTITY_CS_PARALLEL_CREATION,
    TOP_ENTITY_CREATION,
    TOP_ENTITY_MEMORY_MAPPED_CREATION,
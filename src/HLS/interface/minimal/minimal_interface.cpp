@@ -81,6 +81,7 @@
 
 /// utility include
 #include "copyrights_strings.hpp"
+#include "dbgPrintHelper.hpp"
 #include "string_manipulation.hpp"
 
 minimal_interface::minimal_interface(const ParameterConstRef _Param, const HLS_managerRef _HLSMgr, unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager, const HLSFlowStep_Type _hls_flow_step_type)
@@ -208,7 +209,8 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
             const std::string& argName_string = GetPointer<identifier_node>(argName)->strg;
             THROW_ASSERT(DesignInterfaceArgs.find(argName_string) != DesignInterfaceArgs.end(), "unexpected condition:" + argName_string);
             auto interfaceType = DesignInterfaceArgs.find(argName_string)->second;
-            if(interfaceType != "default")
+            /// m_axi parameters keep their port: its value is the base address of the AXI4 transactions
+            if(interfaceType != "default" && interfaceType != "m_axi")
             {
                auto argTypeNode = GET_NODE(a->type);
                if(tree_helper::is_a_pointer(TM, GET_INDEX_NODE(a->type)))
@@ -677,6 +679,22 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
       }
    }
 
+   /// cache between the masters and the external memory (--panda-parameter=ext-cache=1)
+   const auto cache_line_bytes = HLSMgr->Rmem->get_ext_cache_line_bytes(parameters);
+   if(cache_line_bytes && with_master && top_function_ids.find(funId) != top_function_ids.end())
+   {
+      structural_objectRef Mout_oe_ram = wrappedObj->find_member("Mout_oe_ram", port_o_K, wrappedObj);
+      structural_objectRef S_oe_ram = wrappedObj->find_member("S_oe_ram", port_o_K, wrappedObj);
+      if(portsToSkip.find(Mout_oe_ram) != portsToSkip.end())
+      {
+         /// the external memory is not accessed
+      }
+      else if(Mout_oe_ram->get_kind() == port_vector_o_K || (with_slave && portsToConstant.find(S_oe_ram) == portsToConstant.end()) || !wrappedObj->find_member(DONE_PORT_NAME, port_o_K, wrappedObj))
+         THROW_WARNING("The cache in front of the external memory requires a single memory channel, internal memories not visible from the external bus and a done port: the cache has not been added");
+      else
+         add_ext_cache(wrappedObj, interfaceObj, SM_minimal_interface, cache_line_bytes, portsToSkip, portsToConnect);
+   }
+
    // in ports
    for(unsigned int i = 0; i < GetPointer<module>(wrappedObj)->get_in_port_size(); ++i)
    {
@@ -785,6 +803,20 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
                               portsToSkip.insert(int_port);
                            }
                         }
+                        else
+                        {
+                           /// check if we have an AXI4-Stream interface
+                           int_port = wrappedObj->find_member("_" + port_name + "_TDATA", port_o_K, wrappedObj);
+                           if(int_port)
+                           {
+                              if(GetPointer<port_o>(int_port)->get_port_interface() == port_o::port_interface::PI_S_AXIS || GetPointer<port_o>(int_port)->get_port_interface() == port_o::port_interface::PI_M_AXIS)
+                              {
+                                 int_port = wrappedObj->find_member(port_name, port_o_K, wrappedObj);
+                                 THROW_ASSERT(int_port, "unexpected condition");
+                                 portsToSkip.insert(int_port);
+                              }
+                           }
+                        }
                      }
                   }
                }
@@ -893,7 +925,10 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
             GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_RACK || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_READ ||
             GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_WRITE || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_ADDRESS ||
             GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_CHIPENABLE || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_WRITEENABLE ||
-            GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_DOUT)
+            GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_DOUT || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXI_AW ||
+            GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXI_W || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXI_B ||
+            GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXI_AR || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXI_R ||
+            GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_S_AXIS || GetPointer<port_o>(port_out)->get_port_interface() == port_o::port_interface::PI_M_AXIS)
          {
             portsToSkip.insert(port_out);
             auto port_name = GetPointer<port_o>(port_out)->get_id();
@@ -992,3 +1027,79 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
       SM_minimal_interface->add_connection(port_in_out, ext_port);
    }
 }
+
+void minimal_interface::add_ext_cache(structural_objectRef wrappedObj, structural_objectRef interfaceObj, structural_managerRef SM_minimal_interface, unsigned int line_bytes, CustomOrderedSet<structural_objectRef>& portsToSkip,
+                                      std::map<structural_objectRef, structural_objectRef>& portsToConnect)
+{
+   const auto ways = parameters->IsParameter("ext-cache-ways") ? parameters->GetParameter<unsigned int>("ext-cache-ways") : 1u;
+   const auto sets = parameters->IsParameter("ext-cache-sets") ? parameters->GetParameter<unsigned int>("ext-cache-sets") : 64u;
+   if(ways == 0 || (ways & (ways - 1)))
+      THROW_ERROR("The number of ways of the cache must be a power of two: " + STR(ways));
+   if(sets < 2 || (sets & (sets - 1)))
+      THROW_ERROR("The number of sets of the cache must be a power of two greater than one: " + STR(sets));
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Cache in front of the external memory: " + STR(ways) + " way(s), " + STR(sets) + " sets, lines of " + STR(line_bytes) + " bytes, write-back");
+
+   const technology_managerRef TM = HLSMgr->get_HLS_target()->get_technology_manager();
+   structural_objectRef cache = SM_minimal_interface->add_module_from_technology_library("ext_cache", MEMORY_CACHE_STD, TM->get_library(MEMORY_CACHE_STD), interfaceObj, TM);
+   GetPointer<module>(cache)->SetParameter("CACHE_WAYS", STR(ways));
+   GetPointer<module>(cache)->SetParameter("CACHE_SETS", STR(sets));
+   GetPointer<module>(cache)->SetParameter("CACHE_LINE_BYTES", STR(line_bytes));
+   const auto is_bus = [](const structural_objectRef& port) -> bool { return GetPointer<port_o>(port)->get_is_data_bus() || GetPointer<port_o>(port)->get_is_addr_bus() || GetPointer<port_o>(port)->get_is_size_bus(); };
+
+   /// requests of the masters go to the cache, the requests of the cache go to the external memory
+   for(const auto& port_name : {"Mout_oe_ram", "Mout_we_ram", "Mout_addr_ram", "Mout_Wdata_ram", "Mout_data_ram_size"})
+   {
+      structural_objectRef port_out = wrappedObj->find_member(port_name, port_o_K, wrappedObj);
+      structural_objectRef cache_in = cache->find_member("S" + std::string(port_name).substr(4), port_o_K, cache);
+      structural_objectRef cache_out = cache->find_member(port_name, port_o_K, cache);
+      if(is_bus(cache_in))
+      {
+         cache_in->type_resize(GET_TYPE_SIZE(port_out));
+         cache_out->type_resize(GET_TYPE_SIZE(port_out));
+      }
+      structural_objectRef sign = SM_minimal_interface->add_sign(std::string(port_name) + "_INT", interfaceObj, port_out->get_typeRef());
+      SM_minimal_interface->add_connection(port_out, sign);
+      SM_minimal_interface->add_connection(sign, cache_in);
+      structural_objectRef ext_port = SM_minimal_interface->add_port(port_name, port_o::OUT, interfaceObj, port_out->get_typeRef());
+      port_o::fix_port_properties(port_out, ext_port);
+      SM_minimal_interface->add_connection(cache_out, ext_port);
+      portsToSkip.insert(port_out);
+   }
+   for(const auto& port_name : {"M_Rdata_ram", "M_DataRdy"})
+   {
+      structural_objectRef port_in = wrappedObj->find_member(port_name, port_o_K, wrappedObj);
+      structural_objectRef cache_in = cache->find_member(port_name, port_o_K, cache);
+      structural_objectRef cache_out = cache->find_member("Sout" + std::string(port_name).substr(1), port_o_K, cache);
+      if(is_bus(cache_in))
+      {
+         cache_in->type_resize(GET_TYPE_SIZE(port_in));
+         cache_out->type_resize(GET_TYPE_SIZE(port_in));
+      }
+      structural_objectRef ext_port = SM_minimal_interface->add_port(port_name, port_o::IN, interfaceObj, port_in->get_typeRef());
+      port_o::fix_port_properties(port_in, ext_port);
+      SM_minimal_interface->add_connection(ext_port, cache_in);
+      portsToConnect[port_in] = cache_out;
+   }
+
+   /// the done of the top function starts the write back of the dirty lines
+   structural_objectRef done_port = wrappedObj->find_member(DONE_PORT_NAME, port_o_K, wrappedObj);
+   structural_objectRef sign = SM_minimal_interface->add_sign(std::string(DONE_PORT_NAME) + "_INT", interfaceObj, done_port->get_typeRef());
+   SM_minimal_interface->add_connection(done_port, sign);
+   SM_minimal_interface->add_connection(sign, cache->find_member("done_in", port_o_K, cache));
+   structural_objectRef ext_done = SM_minimal_interface->add_port(parameters->isOption(OPT_done_name) ? parameters->getOption<std::string>(OPT_done_name) : DONE_PORT_NAME, port_o::OUT, interfaceObj, done_port->get_typeRef());
+   port_o::fix_port_properties(done_port, ext_done);
+   SM_minimal_interface->add_connection(cache->find_member(DONE_PORT_NAME, port_o_K, cache), ext_done);
+   portsToSkip.insert(done_port);
+
+   /// clock and reset are shared with the top function
+   const std::string clock_name = parameters->isOption(OPT_clock_name) ? parameters->getOption<std::string>(OPT_clock_name) : CLOCK_PORT_NAME;
+   const std::string reset_name = parameters->isOption(OPT_reset_name) ? parameters->getOption<std::string>(OPT_reset_name) : RESET_PORT_NAME;
+   for(const auto& port_names : {std::make_pair(std::string(CLOCK_PORT_NAME), clock_name), std::make_pair(std::string(RESET_PORT_NAME), reset_name)})
+   {
+      structural_objectRef cache_port = cache->find_member(port_names.first, port_o_K, cache);
+      structural_objectRef ext_port = interfaceObj->find_member(port_names.second, port_o_K, interfaceObj);
+      if(!ext_port)
+         ext_port = SM_minimal_interface->add_port(port_names.second, port_o::IN, interfaceObj, cache_port->get_typeRef());
+      SM_minimal_interface->add_connection(ext_port, cache_port);
+   }
+}
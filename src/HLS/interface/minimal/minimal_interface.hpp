@@ -48,11 +48,28 @@
 
 #include "module_interface.hpp"
 
+#include "custom_set.hpp"
+#include <map>
+
 /**
  * Class generating minimal interfaces
  */
 class minimal_interface : public module_interface
 {
+ private:
+   /**
+    * Add the cache between the masters of the top function and the external memory;
+    * the completion of the top function is notified once the dirty lines have been written back
+    * @param wrappedObj is the top function
+    * @param interfaceObj is the interface module
+    * @param SM_minimal_interface is the structural manager of the interface
+    * @param line_bytes is the size in bytes of the cache lines
+    * @param portsToSkip is the set of the ports of wrappedObj already connected
+    * @param portsToConnect is the map between the input ports of wrappedObj and the objects they have to be connected to
+    */
+   void add_ext_cache(structural_objectRef wrappedObj, structural_objectRef interfaceObj, structural_managerRef SM_minimal_interface, unsigned int line_bytes, CustomOrderedSet<structural_objectRef>& portsToSkip,
+                      std::map<structural_objectRef, structural_objectRef>& portsToConnect);
+
  public:
    /**
     * Constructor
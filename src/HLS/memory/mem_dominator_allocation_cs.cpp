@@ -45,6 +45,7 @@
 #include "hls_manager.hpp"
 #include "memory_cs.hpp"
 #include "omp_functions.hpp"
+#include "tree_helper.hpp"
 
 /// utility include
 #include "math_function.hpp"
@@ -73,5 +74,22 @@ DesignFlowStep_Status mem_dominator_allocation_cs::Exec()
       num_bits_acc = 1;
    tag_index = context_switch + num_bits_acc + 2; // tag_index is log2(switch)+log2(thread)+2
    GetPointer<memory_cs>(HLSMgr->Rmem)->set_bus_tag_bitsize(static_cast<unsigned>(tag_index));
+
+   /// the arrays shared by consecutive dataflow stages are duplicated, so that the producer can write a bank while the consumer reads the other one
+   const auto omp_functions = GetPointer<const OmpFunctions>(HLSMgr->Rfuns);
+   if(omp_functions)
+   {
+      const auto TM = HLSMgr->get_tree_manager();
+      for(const auto& dataflow_channels : omp_functions->dataflow_channels)
+      {
+         for(const auto channel : dataflow_channels.second)
+         {
+            if(channel)
+            {
+               GetPointer<memory_cs>(HLSMgr->Rmem)->add_dataflow_channel(channel, compute_n_bytes(tree_helper::size(TM, channel)));
+            }
+         }
+      }
+   }
    return DesignFlowStep_Status::SUCCESS;
 }
@@ -528,6 +528,19 @@ unsigned int memory::get_max_address() const
    return std::max(next_base_address, maximum_private_memory_size + internal_base_address_start);
 }
 
+unsigned int memory::get_ext_cache_line_bytes(const ParameterConstRef parameters) const
+{
+   if(!parameters->IsParameter("ext-cache") || parameters->GetParameter<int>("ext-cache") != 1)
+      return 0;
+   /// a line contains at least a word of the data bus
+   const auto line_bytes = std::max(parameters->IsParameter("ext-cache-line-size") ? parameters->GetParameter<unsigned int>("ext-cache-line-size") : 16u, bus_data_bitsize / 8);
+   if(line_bytes & (line_bytes - 1))
+      THROW_ERROR("The size of the cache lines must be a power of two: " + STR(line_bytes));
+   if(parameters->getOption<unsigned int>(OPT_base_address) % line_bytes)
+      THROW_ERROR("The base address of the external memory must be aligned to the size of the cache lines (" + STR(line_bytes) + ")");
+   return line_bytes;
+}
+
 bool memory::is_parm_decl_copied(unsigned int var) const
 {
    return parm_decl_copied.find(var) != parm_decl_copied.end();
@@ -551,6 +551,13 @@ class memory
       return bus_data_bitsize;
    }
 
+   /**
+    * Return the size in bytes of the lines of the cache generated between the top function and the external memory (--panda-parameter=ext-cache=1)
+    * @param parameters is the set of input parameters
+    * @return the size of the lines or 0 if the cache is not requested
+    */
+   unsigned int get_ext_cache_line_bytes(const ParameterConstRef parameters) const;
+
    /**
     * set the bus size bitsize
     */
@@ -37,6 +37,10 @@
  */
 #include "memory_cs.hpp"
 
+/// utility include
+#include "exceptions.hpp"
+#include "utility.hpp"
+
 memory_cs::memory_cs(const tree_managerRef _TreeM, unsigned int _off_base_address, unsigned int max_bram, bool _null_pointer_check, bool initial_internal_address_p, unsigned int initial_internal_address, const unsigned int _address_bitsize)
     : memory(_TreeM, _off_base_address, max_bram, _null_pointer_check, initial_internal_address_p, initial_internal_address, _address_bitsize)
 {
@@ -46,3 +50,20 @@ memory_cs::memory_cs(const tree_managerRef _TreeM, unsigned int _off_base_addres
 memory_cs::~memory_cs()
 {
 }
+
+void memory_cs::add_dataflow_channel(unsigned int var, unsigned int size)
+{
+   THROW_ASSERT(dataflow_channel_banks.find(var) == dataflow_channel_banks.end(), "Channel " + STR(var) + " already allocated");
+   const auto first_bank = get_memory_address();
+   reserve_space(size);
+   const auto second_bank = get_memory_address();
+   reserve_space(size);
+   dataflow_channel_banks[var] = std::make_pair(first_bank, second_bank);
+}
+
+unsigned int memory_cs::get_dataflow_channel_bank(unsigned int var, unsigned int bank) const
+{
+   THROW_ASSERT(dataflow_channel_banks.find(var) != dataflow_channel_banks.end(), "Channel " + STR(var) + " not allocated");
+   THROW_ASSERT(bank < 2, "Wrong bank " + STR(bank));
+   return bank == 0 ? dataflow_channel_banks.find(var)->second.first : dataflow_channel_banks.find(var)->second.second;
+}
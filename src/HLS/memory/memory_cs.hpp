@@ -41,11 +41,18 @@
 #define MEMORY_CS_H
 #include "memory.hpp"
 
+/// STD include
+#include <map>
+#include <utility>
+
 class memory_cs : public memory
 {
    /// bus data bitsize
    unsigned int bus_tag_bitsize;
 
+   /// for each array used as channel between dataflow stages, the base addresses of its two banks
+   std::map<unsigned int, std::pair<unsigned int, unsigned int>> dataflow_channel_banks;
+
  public:
    /**
     * Constructor
@@ -72,6 +79,20 @@ class memory_cs : public memory
    {
       return bus_tag_bitsize;
    }
+
+   /**
+    * Allocate in the external memory the two banks of an array used as channel between dataflow stages
+    * @param var is the array
+    * @param size is the size in bytes of a bank
+    */
+   void add_dataflow_channel(unsigned int var, unsigned int size);
+
+   /**
+    * Return the base address of a bank of a dataflow channel
+    * @param var is the array
+    * @param bank is the index of the bank (0 or 1)
+    */
+   unsigned int get_dataflow_channel_bank(unsigned int var, unsigned int bank) const;
 };
 
 #endif // MEMORY_CS_H
@@ -122,7 +122,13 @@ const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationC
                {
                   auto omp_functions = GetPointer<OmpFunctions>(HLSMgr->Rfuns);
                   THROW_ASSERT(omp_functions, "OMP_functions must not be null");
-                  if(omp_functions->omp_for_wrappers.find(funId) != omp_functions->omp_for_wrappers.end())
+                  if(omp_functions->dataflow_functions.find(funId) != omp_functions->dataflow_functions.end())
+                  {
+                     const HLSFlowStep_Type top_entity_type = HLSFlowStep_Type::TOP_ENTITY_CS_DATAFLOW_CREATION;
+                     ret.insert(std::make_tuple(top_entity_type, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
+                     found = true;
+                  }
+                  else if(omp_functions->omp_for_wrappers.find(funId) != omp_functions->omp_for_wrappers.end())
                   {
                      const HLSFlowStep_Type top_entity_type = HLSFlowStep_Type::TOP_ENTITY_CS_PARALLEL_CREATION;
                      ret.insert(std::make_tuple(top_entity_type, HLSFlowStepSpecializationConstRef(), HLSFlowStep_Relationship::SAME_FUNCTION));
@@ -182,13 +188,13 @@ DesignFlowStep_Status add_library::InternalExec()
    technology_nodeRef wrapper_tn = TM->get_fu(wrapped_fu_name, PROXY_LIBRARY);
    if(wrapper_tn)
    {
-      TM->get_library_manager(PROXY_LIBRARY)->remove_fu(wrapped_fu_name);
+      TM->remove_fu(wrapped_fu_name, PROXY_LIBRARY);
    }
    const std::string proxy_fu_name = PROXY_PREFIX + module_name;
    technology_nodeRef proxy_tn = TM->get_fu(proxy_fu_name, PROXY_LIBRARY);
    if(proxy_tn)
    {
-      TM->get_library_manager(PROXY_LIBRARY)->remove_fu(proxy_fu_name);
+      TM->remove_fu(proxy_fu_name, PROXY_LIBRARY);
    }
 
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Adding " + module_name + " to " + WORK_LIBRARY + " - Object is " + HLS->top->get_circ()->get_path());
@@ -978,6 +978,11 @@ bool allocation::check_for_memory_compliancy(bool Has_extern_allocated_data, tec
    {
       return true;
    }
+   /// caches are added by the interface in front of the external memory and are never bound to operations
+   if(memory_ctrl_type == MEMORY_CTRL_TYPE_CACHE)
+   {
+      return true;
+   }
 #if !HAVE_EXPERIMENTAL
    if(GetPointer<functional_unit>(current_fu)->functional_unit_name == "MEMORY_CTRL_P1N")
    {
@@ -1950,6 +1955,7 @@ DesignFlowStep_Status allocation::InternalExec()
       INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level, "<--");
    }
 #endif
+   allocation_information->ComputeOperationTimings();
    STOP_TIME(step_time);
    if(output_level >= OUTPUT_LEVEL_MINIMUM and output_level <= OUTPUT_LEVEL_PEDANTIC)
       INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "Time to perform module allocation: " + print_cpu_time(step_time) + " seconds");
@@ -294,6 +294,24 @@ double AllocationInformation::get_execution_time(const unsigned int fu_name, uns
 {
    if(v == ENTRY_ID or v == EXIT_ID)
       return 0.0;
+   if(const auto timing = GetOperationTiming(fu_name, v))
+      return timing->execution_time;
+   /// the back-annotated delay of a pipelined operation is added to its stage period
+   const auto execution_time = GetLibraryExecutionTime(fu_name, v);
+   return GetLibraryStagePeriod(fu_name, v) > 0.0 ? execution_time : execution_time + GetBackAnnotatedDelay(v);
+}
+
+double AllocationInformation::GetBackAnnotatedDelay(const unsigned int statement_index) const
+{
+   const auto back_annotation = hls_manager->timing_back_annotation.find(function_index);
+   if(back_annotation == hls_manager->timing_back_annotation.end())
+      return 0.0;
+   const auto delay = back_annotation->second.find(statement_index);
+   return delay != back_annotation->second.end() ? delay->second : 0.0;
+}
+
+double AllocationInformation::GetLibraryExecutionTime(const unsigned int fu_name, const unsigned int v) const
+{
    THROW_ASSERT(can_implement_set(v).find(fu_name) != can_implement_set(v).end(), "This function (" + get_string_name(fu_name) + ") cannot implement the operation " + STR(v));
    if(!has_to_be_synthetized(fu_name))
       return 0.0;
@@ -669,6 +687,8 @@ ControlStep AllocationInformation::get_initiation_time(const unsigned int fu_nam
 {
    if(statement_index == ENTRY_ID or statement_index == EXIT_ID)
       return ControlStep(0u);
+   if(const auto timing = GetOperationTiming(fu_name, statement_index))
+      return ControlStep(timing->initiation_time);
    const auto operation_name = GetPointer<const gimple_node>(TreeM->get_tree_node_const(statement_index))->operation;
    THROW_ASSERT(can_implement_set(statement_index).find(fu_name) != can_implement_set(statement_index).end(), "This function (" + get_string_name(fu_name) + ") cannot implement the operation " + operation_name);
    if(!has_to_be_synthetized(fu_name))
@@ -886,6 +906,14 @@ double AllocationInformation::get_stage_period(const unsigned int fu_name, const
 {
    if(v == ENTRY_ID or v == EXIT_ID)
       return 0.0;
+   if(const auto timing = GetOperationTiming(fu_name, v))
+      return timing->stage_period;
+   const auto stage_period = GetLibraryStagePeriod(fu_name, v);
+   return stage_period > 0.0 ? stage_period + GetBackAnnotatedDelay(v) : stage_period;
+}
+
+double AllocationInformation::GetLibraryStagePeriod(const unsigned int fu_name, const unsigned int v) const
+{
    const std::string operation_t = GetPointer<const gimple_node>(TreeM->get_tree_node_const(v))->operation;
    THROW_ASSERT(can_implement_set(v).find(fu_name) != can_implement_set(v).end(), "This function (" + get_string_name(fu_name) + ") cannot implement the operation " + tree_helper::normalized_ID(operation_t));
    if(!has_to_be_synthetized(fu_name))
@@ -957,6 +985,8 @@ unsigned int AllocationInformation::get_cycles(const unsigned int fu_name, const
 {
    if(v == ENTRY_ID or v == EXIT_ID)
       return 0;
+   if(const auto timing = GetOperationTiming(fu_name, v))
+      return timing->cycles;
    const std::string operation_t = GetPointer<const gimple_node>(TreeM->get_tree_node_const(v))->operation;
    THROW_ASSERT(can_implement_set(v).find(fu_name) != can_implement_set(v).end(), "This function (" + get_string_name(fu_name) + ") cannot implement the operation " + tree_helper::normalized_ID(operation_t));
    if(!has_to_be_synthetized(fu_name))
@@ -967,6 +997,44 @@ unsigned int AllocationInformation::get_cycles(const unsigned int fu_name, const
    return GetPointer<operation>(node_op)->time_m->get_cycles();
 }
 
+void AllocationInformation::ComputeOperationTimings()
+{
+   operation_timings.clear();
+   for(const auto& op : node_id_to_fus)
+   {
+      const auto statement_index = op.first.first;
+      if(statement_index == ENTRY_ID or statement_index == EXIT_ID)
+         continue;
+      const auto gn = GetPointer<const gimple_node>(TreeM->get_tree_node_const(statement_index));
+      /// skip the entries referring to an old version of the operation
+      if(!gn or gn->operation != op.first.second)
+         continue;
+      const auto normalized_operation = tree_helper::normalized_ID(gn->operation);
+      std::vector<OperationTiming> timings;
+      for(const auto fu_name : op.second)
+      {
+         if(has_to_be_synthetized(fu_name))
+         {
+            /// units without timing information are left to the lookups, which report the problem when actually queried
+            const auto fu = GetPointer<functional_unit>(list_of_FU[fu_name]);
+            const auto node_op = fu->get_operation(normalized_operation);
+            const auto cycles_op = fu->get_operation(gn->operation);
+            if(!node_op or !GetPointer<operation>(node_op)->time_m or !cycles_op or !GetPointer<operation>(cycles_op)->time_m)
+               continue;
+         }
+         OperationTiming timing;
+         timing.fu_type = fu_name;
+         timing.execution_time = get_execution_time(fu_name, statement_index);
+         timing.stage_period = get_stage_period(fu_name, statement_index);
+         timing.cycles = get_cycles(fu_name, statement_index);
+         timing.initiation_time = from_strongtype_cast<unsigned int>(get_initiation_time(fu_name, statement_index));
+         timings.push_back(timing);
+      }
+      if(!timings.empty())
+         operation_timings[statement_index] = timings;
+   }
+}
+
 technology_nodeRef AllocationInformation::get_fu(unsigned int fu_name) const
 {
    THROW_ASSERT(fu_name < get_number_fu_types(), "functional unit id " + STR(fu_name) + " is not meaningful");
@@ -3490,6 +3558,7 @@ void AllocationInformation::Clear()
    tech_constraints.clear();
    node_id_to_fus.clear();
    fus_to_node_id.clear();
+   operation_timings.clear();
    binding.clear();
    memory_units_sizes.clear();
    vars_to_memory_units.clear();
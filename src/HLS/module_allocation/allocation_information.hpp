@@ -55,6 +55,7 @@
 #include <iosfwd>      // for ostream
 #include <string>      // for string
 #include <utility>     // for pair
+#include <vector>      // for vector
 
 CONSTREF_FORWARD_DECL(AllocationInformation);
 CONSTREF_FORWARD_DECL(BehavioralHelper);
@@ -218,6 +219,74 @@ class AllocationInformation : public HLSFunctionIR
    /// in case of pointer plus expr between constants: no wire delay
    CustomUnorderedSet<unsigned int> simple_pointer_plus_expr;
 
+   /// The timing of an operation on one of the functional units which can implement it
+   struct OperationTiming
+   {
+      /// the functional unit type
+      unsigned int fu_type;
+
+      /// the execution time
+      double execution_time;
+
+      /// the stage period
+      double stage_period;
+
+      /// the number of cycles
+      unsigned int cycles;
+
+      /// the initiation time
+      unsigned int initiation_time;
+   };
+
+   /// For each statement, the timing on the functional units which can implement it; filled at the end of the allocation
+   CustomUnorderedMap<unsigned int, std::vector<OperationTiming>> operation_timings;
+
+   /**
+    * Return the precomputed timing of an operation on a functional unit
+    * @param fu_name is the id of the functional unit
+    * @param statement_index is the operation
+    * @return the timing or nullptr if it has not been precomputed
+    */
+   inline const OperationTiming* GetOperationTiming(const unsigned int fu_name, const unsigned int statement_index) const
+   {
+      const auto timings = operation_timings.find(statement_index);
+      if(timings == operation_timings.end())
+         return nullptr;
+      for(const auto& timing : timings->second)
+      {
+         if(timing.fu_type == fu_name)
+            return &timing;
+      }
+      return nullptr;
+   }
+
+   /**
+    * Return the delay back-annotated to an operation by the previous timing closure iterations
+    * @param statement_index is the operation
+    * @return the delay to be added to the library timing of the operation (0 if not annotated)
+    */
+   double GetBackAnnotatedDelay(const unsigned int statement_index) const;
+
+   /**
+    * Return the execution time of an operation on a functional unit as characterized in the technology library
+    * @param fu_name is the id of the functional unit
+    * @param v is the operation
+    */
+   double GetLibraryExecutionTime(const unsigned int fu_name, const unsigned int v) const;
+
+   /**
+    * Return the stage period of an operation on a functional unit as characterized in the technology library
+    * @param fu_name is the id of the functional unit
+    * @param v is the operation
+    */
+   double GetLibraryStagePeriod(const unsigned int fu_name, const unsigned int v) const;
+
+   /**
+    * Precompute the timing of each allocated operation on each functional unit which can implement it, so that
+    * get_execution_time, get_stage_period, get_cycles and get_initiation_time do not repeat the library lookups
+    */
+   void ComputeOperationTimings();
+
    /// The roots used to compute a ssa
    mutable CustomMap<unsigned int, CustomSet<unsigned int>> ssa_roots;
 
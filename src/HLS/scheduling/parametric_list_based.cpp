@@ -78,6 +78,9 @@
 #include "frontend_flow_step_factory.hpp"
 #include "function_frontend_flow_step.hpp"
 
+/// HLS/memory include
+#include "memory_allocation.hpp"
+
 /// HLS/module_allocation include
 #include "allocation_information.hpp"
 
@@ -547,6 +550,13 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
    std::string fname;
    tree_helper::get_mangled_fname(fd, fname);
    CustomUnorderedSet<vertex> RW_stmts;
+   /// with independent memory channels (MEM_ACC_NN) the accesses to the external memory issued in the same control step are completed independently,
+   /// so that they can be overlapped instead of serializing the round-trips (--panda-parameter=nonblocking-memory=1);
+   /// only the D00 controller holds the data of the channels completed while the others are still pending;
+   /// the accesses do not outlive their control step, so the computation overlapped with them is limited to the bounded operations of the same step
+   const bool nonblocking_memory = parameters->IsParameter("nonblocking-memory") and parameters->GetParameter<int>("nonblocking-memory") == 1 and
+                                   parameters->getOption<MemoryAllocation_ChannelsType>(OPT_channels_type) == MemoryAllocation_ChannelsType::MEM_ACC_NN and parameters->isOption(OPT_channels_number) and
+                                   parameters->getOption<unsigned int>(OPT_channels_number) > 1 and parameters->getOption<std::string>(OPT_memory_controller_type) == "D00";
    if(HLSMgr->design_interface_loads.find(fname) != HLSMgr->design_interface_loads.end())
    {
       for(auto bb2arg2stmtsR : HLSMgr->design_interface_loads.find(fname)->second)
@@ -589,6 +599,8 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
       bool unbounded = false;
       bool unbounded_RW = false;
       bool store_unbounded_check = false;
+      /// true if all the unbounded operations and the non-direct memory accesses scheduled in this control step are accesses which can be overlapped
+      bool only_nonblocking_accesses = true;
       unsigned int n_scheduled_ops = 0;
       PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "      schedule->num_scheduled() " + std::to_string(schedule->num_scheduled()));
       PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "      already_sch " + std::to_string(already_sch));
@@ -736,6 +748,10 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
                }
 
                bool is_live = check_if_is_live_in_next_cycle(live_vertices, current_cycle, ending_time, clock_cycle);
+               const bool is_nonblocking_access = nonblocking_memory and (GET_TYPE(flow_graph, current_vertex) & (TYPE_LOAD | TYPE_STORE)) and not HLS->allocation_information->is_direct_access_memory_unit(fu_type) and
+                                                  not HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type) and RW_stmts.find(current_vertex) == RW_stmts.end();
+               /// the access is issued together with the other outstanding ones; the state is left when all of them have completed
+               const bool overlapped_access = is_nonblocking_access and only_nonblocking_accesses and not unbounded_RW and not is_live;
                THROW_ASSERT(!(GET_TYPE(flow_graph, current_vertex) & (TYPE_WHILE | TYPE_FOR)), "not expected operation type");
                /// put these type of operations as last operation scheduled for the basic block
                if((GET_TYPE(flow_graph, current_vertex) & (TYPE_IF | TYPE_RET | TYPE_SWITCH | TYPE_MULTIIF | TYPE_GOTO)) && (unbounded || unbounded_RW || is_live))
@@ -764,7 +780,7 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
                   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "            Scheduling of Control Vertex " + GET_NAME(flow_graph, current_vertex) + " postponed to the next cycle to register the output");
                   continue;
                }
-               if(!HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type) && RW_stmts.find(current_vertex) == RW_stmts.end() && (unbounded || unbounded_RW || is_live || store_unbounded_check))
+               if(!HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type) && RW_stmts.find(current_vertex) == RW_stmts.end() && (unbounded || unbounded_RW || is_live || store_unbounded_check) && !overlapped_access)
                {
                   if(black_list.find(fu_type) == black_list.end())
                      black_list.emplace(fu_type, OpVertexSet(flow_graph));
@@ -799,7 +815,7 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
                bool predecessorsCond, pipeliningCond, cannotBeChained0, chainingRetCond, cannotBeChained1, asyncCond, cannotBeChained2, MultiCond0, MultiCond1, nonDirectMemCond;
 
                CheckSchedulabilityConditions(current_vertex, current_cycle, current_starting_time, current_ending_time, current_stage_period, local_connection_map, current_cycle_starting_time, current_cycle_ending_time, setup_hold_time, phi_extra_time,
-                                             scheduling_mux_margins, unbounded, cstep_has_RET_conflict, fu_type, current_ASAP, res_binding, schedule, predecessorsCond, pipeliningCond, cannotBeChained0, chainingRetCond, cannotBeChained1, asyncCond,
+                                             scheduling_mux_margins, unbounded && !overlapped_access, cstep_has_RET_conflict, fu_type, current_ASAP, res_binding, schedule, predecessorsCond, pipeliningCond, cannotBeChained0, chainingRetCond, cannotBeChained1, asyncCond,
                                              cannotBeChained2, MultiCond0, MultiCond1, nonDirectMemCond);
 
                /// checking if predecessors have finished
@@ -1034,12 +1050,13 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
                if(!HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type) && RW_stmts.find(current_vertex) == RW_stmts.end())
                {
                   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "                  " + GET_NAME(flow_graph, current_vertex) + " is unbounded");
-                  THROW_ASSERT(!(unbounded || is_live || store_unbounded_check), "unexpected case");
+                  THROW_ASSERT(overlapped_access || !(unbounded || is_live || store_unbounded_check), "unexpected case");
                   double ex_time = HLS->allocation_information->get_execution_time(fu_type, current_vertex, flow_graph);
                   if(ex_time > clock_cycle)
                      THROW_WARNING("Operation execution time of the unbounded operation is greater than the clock period resource fraction (" + STR(clock_cycle) + ").\n\tExecution time " + STR(ex_time) + " of " + GET_NAME(flow_graph, current_vertex) +
                                    " of type " + flow_graph->CGetOpNodeInfo(current_vertex)->GetOperation() + "\nThis may prevent meeting the timing constraints.\n");
                   unbounded = true;
+                  only_nonblocking_accesses = only_nonblocking_accesses && is_nonblocking_access;
                }
                else if(!HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type) && RW_stmts.find(current_vertex) != RW_stmts.end())
                {
@@ -1069,6 +1086,7 @@ void parametric_list_based::exec(const OpVertexSet& operations, ControlStep curr
                if((GET_TYPE(flow_graph, current_vertex) & (TYPE_LOAD | TYPE_STORE)) and not HLS->allocation_information->is_direct_access_memory_unit(fu_type))
                {
                   store_unbounded_check = true; /// even if it is bounded we would like to prevent non-direct memory accesses running together with unbounded operations
+                  only_nonblocking_accesses = only_nonblocking_accesses && is_nonblocking_access;
                }
                // if(GET_TYPE(flow_graph, current_vertex)&TYPE_EXTERNAL && !HLS->allocation_information->is_operation_bounded(flow_graph, current_vertex, fu_type))
                //   seen_cstep_has_RET_conflict=cstep_has_RET_conflict = true;
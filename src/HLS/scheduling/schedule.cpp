@@ -280,6 +280,37 @@ void Schedule::clear()
    starting_cycles_to_ops.clear();
 }
 
+void Schedule::PostponeOperations(const CustomUnorderedSet<unsigned int>& operations, const ControlStep c_step)
+{
+   const auto hls = hls_manager.lock()->get_HLS(function_index);
+   const auto clock_period = hls->HLS_C->get_clock_period() * hls->HLS_C->get_clock_period_resource_fraction();
+   starting_cycles_to_ops.clear();
+   for(auto& starting_cycle : op_starting_cycle)
+   {
+      if(operations.count(starting_cycle.first) or starting_cycle.second > c_step)
+      {
+         starting_cycle.second += 1u;
+         if(starting_times.find(starting_cycle.first) != starting_times.end())
+         {
+            starting_times.at(starting_cycle.first) += clock_period;
+         }
+      }
+      starting_cycles_to_ops[starting_cycle.second].insert(starting_cycle.first);
+   }
+   for(auto& ending_cycle : op_ending_cycle)
+   {
+      if(operations.count(ending_cycle.first) or ending_cycle.second > c_step)
+      {
+         ending_cycle.second += 1u;
+         if(ending_times.find(ending_cycle.first) != ending_times.end())
+         {
+            ending_times.at(ending_cycle.first) += clock_period;
+         }
+      }
+   }
+   tot_csteps += 1u;
+}
+
 void Schedule::UpdateTime(const unsigned int operation_index, bool update_cs)
 {
    if(operation_index == ENTRY_ID or operation_index == EXIT_ID)
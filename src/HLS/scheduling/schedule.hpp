@@ -331,6 +331,13 @@ class Schedule
     */
    void clear();
 
+   /**
+    * Postpones by one control step a set of operations and all the operations scheduled after them; used when a state is split
+    * @param operations are the indices of the operations moved into the new state
+    * @param c_step is the control step where the operations were scheduled
+    */
+   void PostponeOperations(const CustomUnorderedSet<unsigned int>& operations, const ControlStep c_step);
+
    /**
     * set the slack associated with the vertex with respect to the clock period
     */
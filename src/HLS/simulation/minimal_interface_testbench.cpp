@@ -71,6 +71,7 @@
 #include "SimulationInformation.hpp"
 
 /// STD include
+#include <algorithm>
 #include <string>
 
 /// tree include
@@ -560,11 +561,214 @@ void MinimalInterfaceTestbench::write_interface_handler() const
                writer->write(STR(STD_CLOSING_CHAR));
                writer->write("end\n");
             }
+            else if(InterfaceType == port_o::port_interface::PI_M_AXI_AR && portInst->get_id().size() > std::string("_arready").size() &&
+                    portInst->get_id().substr(portInst->get_id().size() - std::string("_arready").size()) == "_arready")
+            {
+               write_m_axi_slave(portInst->get_id().substr(0, portInst->get_id().size() - std::string("_arready").size()));
+            }
+            else if(InterfaceType == port_o::port_interface::PI_S_AXIS && portInst->get_id().size() > std::string("_TVALID").size() &&
+                    portInst->get_id().substr(portInst->get_id().size() - std::string("_TVALID").size()) == "_TVALID")
+            {
+               write_axis_source(portInst->get_id().substr(0, portInst->get_id().size() - std::string("_TVALID").size()));
+            }
+            else if(InterfaceType == port_o::port_interface::PI_M_AXIS && portInst->get_id().size() > std::string("_TREADY").size() &&
+                    portInst->get_id().substr(portInst->get_id().size() - std::string("_TREADY").size()) == "_TREADY")
+            {
+               write_axis_sink(portInst->get_id().substr(0, portInst->get_id().size() - std::string("_TREADY").size()));
+            }
          }
       }
    }
 }
 
+void MinimalInterfaceTestbench::write_m_axi_slave(const std::string& bundle) const
+{
+   const auto port_rdata = mod->find_member(bundle + "_rdata", port_o_K, cir);
+   THROW_ASSERT(port_rdata && GetPointer<port_o>(port_rdata)->get_port_interface() == port_o::port_interface::PI_M_AXI_R, "inconsistent interface");
+   const auto nbytes = GET_TYPE_SIZE(port_rdata) / 8;
+   const auto name = [&](const std::string& channel_signal) { return HDL_manager::convert_to_identifier(writer.get(), bundle + "_" + channel_signal); };
+   const auto state = [&](const std::string& var) { return HDL_manager::convert_to_identifier(writer.get(), "__" + bundle + "_" + var); };
+   writer->write_comment("AXI4 slave handler of " + bundle + ": one burst at a time on each direction, one beat per cycle\n");
+   writer->write("reg [31:0] " + state("raddr") + " = 0;\n");
+   writer->write("reg [8:0] " + state("rleft") + " = 0;\n");
+   writer->write("reg [31:0] " + state("waddr") + " = 0;\n");
+   writer->write("reg [1:0] " + state("wstate") + " = 0;\n");
+   writer->write("always @ (posedge " + std::string(CLOCK_PORT_NAME) + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("rresp") + " <= 2'b00;\n");
+   writer->write(name("bresp") + " <= 2'b00;\n");
+   writer->write(name("arready") + " <= " + state("rleft") + " == 0 && !" + name("rvalid") + " && !(" + name("arvalid") + " && " + name("arready") + ");\n");
+   writer->write("if(" + name("arvalid") + " && " + name("arready") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(state("raddr") + " <= " + name("araddr") + ";\n");
+   writer->write(state("rleft") + " <= " + name("arlen") + " + 1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("else if(" + state("rleft") + " != 0 && (!" + name("rvalid") + " || " + name("rready") + "))\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("rvalid") + " <= 1'b1;\n");
+   writer->write(name("rlast") + " <= " + state("rleft") + " == 1;\n");
+   std::string mem_aggregated = "{";
+   for(unsigned int byte = nbytes; byte > 0; --byte)
+   {
+      if(byte != nbytes)
+         mem_aggregated += ", ";
+      mem_aggregated += "_bambu_testbench_mem_[" + state("raddr") + " + " + STR(byte - 1) + " - base_addr]";
+   }
+   mem_aggregated += "}";
+   writer->write(name("rdata") + " <= " + mem_aggregated + ";\n");
+   writer->write(state("raddr") + " <= " + state("raddr") + " + " + STR(nbytes) + ";\n");
+   writer->write(state("rleft") + " <= " + state("rleft") + " - 1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("else if(" + name("rvalid") + " && " + name("rready") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("rvalid") + " <= 1'b0;\n");
+   writer->write(name("rlast") + " <= 1'b0;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("case(" + state("wstate") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("0:\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("if(" + name("awvalid") + " && " + name("awready") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("awready") + " <= 1'b0;\n");
+   writer->write(name("wready") + " <= 1'b1;\n");
+   writer->write(state("waddr") + " <= " + name("awaddr") + ";\n");
+   writer->write(state("wstate") + " <= 1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("else\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write(name("awready") + " <= 1'b1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("1:\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("if(" + name("wvalid") + " && " + name("wready") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   for(unsigned int byte = 0; byte < nbytes; ++byte)
+   {
+      writer->write("if(" + name("wstrb") + "[" + STR(byte) + "])\n");
+      writer->write(STR(STD_OPENING_CHAR));
+      writer->write("_bambu_testbench_mem_[" + state("waddr") + " + " + STR(byte) + " - base_addr] <= " + name("wdata") + "[" + STR(8 * byte + 7) + ":" + STR(8 * byte) + "];\n");
+      writer->write(STR(STD_CLOSING_CHAR));
+   }
+   writer->write(state("waddr") + " <= " + state("waddr") + " + " + STR(nbytes) + ";\n");
+   writer->write("if(" + name("wlast") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("wready") + " <= 1'b0;\n");
+   writer->write(name("bvalid") + " <= 1'b1;\n");
+   writer->write(state("wstate") + " <= 2;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("default:\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("if(" + name("bvalid") + " && " + name("bready") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("bvalid") + " <= 1'b0;\n");
+   writer->write(state("wstate") + " <= 0;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("endcase\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n\n");
+}
+
+std::string MinimalInterfaceTestbench::axis_backpressure(const std::string& signal) const
+{
+   const auto percent = parameters->IsParameter("axis-tb-backpressure") ? parameters->GetParameter<unsigned int>("axis-tb-backpressure") : 0u;
+   if(percent == 0)
+      return signal;
+   return "(" + signal + " && ({$random} % 100) >= " + STR(std::min(percent, 99u)) + ")";
+}
+
+void MinimalInterfaceTestbench::write_axis_source(const std::string& stream) const
+{
+   const auto port_tdata = mod->find_member(stream + "_TDATA", port_o_K, cir);
+   THROW_ASSERT(port_tdata && GetPointer<port_o>(port_tdata)->get_port_interface() == port_o::port_interface::PI_S_AXIS, "inconsistent interface");
+   const auto nbytes = GET_TYPE_SIZE(port_tdata) / 8;
+   const auto name = [&](const std::string& channel_signal) { return HDL_manager::convert_to_identifier(writer.get(), stream + "_" + channel_signal); };
+   const auto index = HDL_manager::convert_to_identifier(writer.get(), "__" + stream + "_idx");
+   writer->write_comment("AXI4-Stream source of " + stream + ": the beats are read in order from the parameter memory\n");
+   writer->write("reg [31:0] " + index + " = 0;\n");
+   writer->write("always @ (posedge " + std::string(CLOCK_PORT_NAME) + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write("if(__state == 2)\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(index + " <= 0;\n");
+   writer->write(name("TVALID") + " <= 1'b0;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("else if(" + axis_backpressure("__state == 3") + " && (!" + name("TVALID") + " || " + name("TREADY") + "))\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("TVALID") + " <= 1'b1;\n");
+   std::string mem_aggregated = "{";
+   for(unsigned int byte = nbytes; byte > 0; --byte)
+   {
+      if(byte != nbytes)
+         mem_aggregated += ", ";
+      mem_aggregated += "_bambu_testbench_mem_[paddr" + name("TDATA") + " + " + index + "*" + STR(nbytes) + " + " + STR(byte - 1) + " - base_addr]";
+   }
+   mem_aggregated += "}";
+   writer->write(name("TDATA") + " <= " + mem_aggregated + ";\n");
+   writer->write(index + " <= " + index + " + 1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write("else if(" + name("TREADY") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write(name("TVALID") + " <= 1'b0;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n\n");
+}
+
+void MinimalInterfaceTestbench::write_axis_sink(const std::string& stream) const
+{
+   const auto port_tdata = mod->find_member(stream + "_TDATA", port_o_K, cir);
+   THROW_ASSERT(port_tdata && GetPointer<port_o>(port_tdata)->get_port_interface() == port_o::port_interface::PI_M_AXIS, "inconsistent interface");
+   const auto nbytes = GET_TYPE_SIZE(port_tdata) / 8;
+   const auto name = [&](const std::string& channel_signal) { return HDL_manager::convert_to_identifier(writer.get(), stream + "_" + channel_signal); };
+   const auto index = HDL_manager::convert_to_identifier(writer.get(), "__" + stream + "_idx");
+   writer->write_comment("AXI4-Stream sink of " + stream + ": the beats are stored in order into the parameter memory\n");
+   writer->write("reg [31:0] " + index + " = 0;\n");
+   writer->write("always @ (posedge " + std::string(CLOCK_PORT_NAME) + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   writer->write(name("TREADY") + " <= " + axis_backpressure("__state == 3") + ";\n");
+   writer->write("if(__state == 2)\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write(index + " <= 0;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("else if(" + name("TVALID") + " && " + name("TREADY") + ")\n");
+   writer->write(STR(STD_OPENING_CHAR));
+   writer->write("begin\n");
+   for(unsigned int byte = 0; byte < nbytes; ++byte)
+      writer->write("_bambu_testbench_mem_[paddr" + name("TDATA") + " + " + index + "*" + STR(nbytes) + " + " + STR(byte) + " - base_addr] <= " + name("TDATA") + "[" + STR(8 * byte + 7) + ":" + STR(8 * byte) + "];\n");
+   writer->write(index + " <= " + index + " + 1;\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n");
+   writer->write(STR(STD_CLOSING_CHAR));
+   writer->write("end\n\n");
+}
+
 void MinimalInterfaceTestbench::write_slave_initializations(bool with_memory) const
 {
    if(with_memory)
@@ -685,7 +889,9 @@ void MinimalInterfaceTestbench::write_output_signal_declaration() const
             writer->write("reg " + writer->type_converter(portInst->get_typeRef()) + writer->type_converter_size(portInst));
             writer->write("registered_" + HDL_manager::convert_to_identifier(writer.get(), port_name) + ";\n");
          }
-         else if(GetPointer<port_o>(portInst)->get_port_interface() == port_o::port_interface::PI_DOUT)
+         else if(GetPointer<port_o>(portInst)->get_port_interface() == port_o::port_interface::PI_DOUT ||
+                 (GetPointer<port_o>(portInst)->get_port_interface() == port_o::port_interface::PI_M_AXIS && port_name.size() > std::string("_TDATA").size() &&
+                  port_name.substr(port_name.size() - std::string("_TDATA").size()) == "_TDATA"))
          {
             writer->write("reg " + writer->type_converter(portInst->get_typeRef()) + writer->type_converter_size(portInst));
             writer->write("ex_" + HDL_manager::convert_to_identifier(writer.get(), port_name) + ";\n");
@@ -856,6 +1062,10 @@ void MinimalInterfaceTestbench::write_file_reading_operations() const
          portInst = mod->find_member(par + "_din", port_o_K, cir);
       }
       if(!portInst)
+      {
+         portInst = mod->find_member(par + "_TDATA", port_o_K, cir);
+      }
+      if(!portInst)
       {
          portInst = mod->find_member(par + "_d0", port_o_K, cir);
       }
@@ -883,7 +1093,8 @@ void MinimalInterfaceTestbench::write_file_reading_operations() const
          }
          read_input_value_from_file_RNONE(input_name, first_valid_input, bitsize);
       }
-      else if(InterfaceType == port_o::port_interface::PI_WNONE || InterfaceType == port_o::port_interface::PI_DIN || InterfaceType == port_o::port_interface::PI_DOUT)
+      else if(InterfaceType == port_o::port_interface::PI_WNONE || InterfaceType == port_o::port_interface::PI_DIN || InterfaceType == port_o::port_interface::PI_DOUT || InterfaceType == port_o::port_interface::PI_S_AXIS ||
+              InterfaceType == port_o::port_interface::PI_M_AXIS)
          read_input_value_from_file("paddr" + input_name, first_valid_input);
       else
          THROW_ERROR("not yet supported port interface for port " + input_name);
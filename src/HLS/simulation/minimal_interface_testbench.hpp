@@ -62,6 +62,30 @@ class MinimalInterfaceTestbench : public TestbenchGenerationBaseStep
 
    void write_interface_handler() const override;
 
+   /**
+    * Write the AXI4 slave model serving the m_axi bundle through the testbench memory
+    * @param bundle is the common prefix of the ports of the bundle
+    */
+   void write_m_axi_slave(const std::string& bundle) const;
+
+   /**
+    * Return the condition guarding a stream handshake signal, randomly deasserted when axis-tb-backpressure is set
+    * @param signal is the condition under which the handshake signal is asserted
+    */
+   std::string axis_backpressure(const std::string& signal) const;
+
+   /**
+    * Write the AXI4-Stream source feeding an axis input parameter from the testbench memory
+    * @param stream is the name of the parameter
+    */
+   void write_axis_source(const std::string& stream) const;
+
+   /**
+    * Write the AXI4-Stream sink storing the beats of an axis output parameter into the testbench memory
+    * @param stream is the name of the parameter
+    */
+   void write_axis_sink(const std::string& stream) const;
+
    void write_signals(const tree_managerConstRef TreeM, bool& withMemory, bool& hasMultiIrq) const override;
 
    void write_slave_initializations(bool withMemory) const override;
@@ -80,8 +80,9 @@
 /// HLS/binding/module include
 #include "fu_binding.hpp"
 
-/// HLS/memory include
+/// HLS/memory includes
 #include "memory.hpp"
+#include "memory_allocation.hpp"
 
 // include from HLS/simulation
 #include "SimulationInformation.hpp"
@@ -231,6 +232,34 @@ std::string TestbenchGenerationBaseStep::print_var_init(const tree_managerConstR
    return init;
 }
 
+std::vector<std::string> TestbenchGenerationBaseStep::print_memory_bytes(const std::string& binary_value)
+{
+   THROW_ASSERT(binary_value.size() % 8 == 0, "Memory initialization is not a sequence of bytes: " + binary_value);
+   std::vector<std::string> records;
+   const size_t n_bytes = binary_value.size() / 8;
+   if(n_bytes > 1 && binary_value.find_first_not_of('0') == std::string::npos)
+   {
+      records.push_back("z" + STR(n_bytes));
+      return records;
+   }
+   static const char hex_digits[] = "0123456789abcdef";
+   for(size_t first_byte = 0; first_byte < n_bytes; first_byte += MEMORY_RECORD_BYTES)
+   {
+      const size_t record_bytes = std::min(n_bytes - first_byte, static_cast<size_t>(MEMORY_RECORD_BYTES));
+      const auto record_bits = binary_value.substr(binary_value.size() - 8 * (first_byte + record_bytes), 8 * record_bytes);
+      std::string record = std::string("M") + hex_digits[record_bytes - 1];
+      for(size_t nibble = 0; nibble < record_bits.size(); nibble += 4)
+      {
+         unsigned int digit = 0;
+         for(size_t bit = nibble; bit < nibble + 4; ++bit)
+            digit = (digit << 1) | (record_bits.at(bit) == '1' ? 1U : 0U);
+         record += hex_digits[digit];
+      }
+      records.push_back(record);
+   }
+   return records;
+}
+
 std::string TestbenchGenerationBaseStep::verilator_testbench() const
 {
    if(not parameters->getOption<bool>(OPT_generate_testbench))
@@ -242,7 +271,16 @@ std::string TestbenchGenerationBaseStep::verilator_testbench() const
    if(not boost::filesystem::exists(simulation_values_path))
       THROW_ERROR("Error in generating Verilator testbench, values file missing!");
 
-   std::string fileName = write_verilator_testbench(simulation_values_path);
+   std::string fileName;
+   if(parameters->IsParameter("verilator-native") and parameters->GetParameter<int>("verilator-native") == 1)
+   {
+      if(is_verilator_native_testbench_supported())
+         fileName = write_verilator_native_testbench(simulation_values_path);
+      else
+         THROW_WARNING("Native Verilator testbench not supported by the interface of " + cir->get_id() + ": the HDL testbench is used");
+   }
+   if(fileName.empty())
+      fileName = write_verilator_testbench(simulation_values_path);
 
    PRINT_DBG_MEX(DEBUG_LEVEL_MINIMUM, debug_level, "  . End of the Verilator testbench");
 
@@ -332,6 +370,697 @@ std::string TestbenchGenerationBaseStep::write_verilator_testbench(const std::st
    return fileName;
 }
 
+/// width of a port of the top component including all the ports of a port vector
+static unsigned long long int get_port_bitsize(const structural_objectRef& port)
+{
+   unsigned long long int bitsize = GET_TYPE_SIZE(port);
+   if(port->get_kind() == port_vector_o_K)
+      bitsize *= GetPointer<port_o>(port)->get_ports_size();
+   return bitsize;
+}
+
+bool TestbenchGenerationBaseStep::is_verilator_native_testbench_supported() const
+{
+   if(parameters->getOption<HLSFlowStep_Type>(OPT_interface_type) != HLSFlowStep_Type::MINIMAL_INTERFACE_GENERATION)
+      return false;
+   if((parameters->isOption(OPT_discrepancy) and parameters->getOption<bool>(OPT_discrepancy)) or (parameters->isOption(OPT_discrepancy_hw) and parameters->getOption<bool>(OPT_discrepancy_hw)))
+      return false;
+   /// the delayed read data of the block RAM policies and the slave memories read by the testbench are modeled only by the HDL testbench
+   const auto memory_allocation_policy = parameters->getOption<MemoryAllocation_Policy>(OPT_memory_allocation_policy);
+   if(memory_allocation_policy == MemoryAllocation_Policy::ALL_BRAM or memory_allocation_policy == MemoryAllocation_Policy::EXT_PIPELINED_BRAM)
+      return false;
+   if(mod->find_member("Sin_Rdata_ram", port_o_K, cir) or mod->find_member("Sin_DataRdy", port_o_K, cir))
+      return false;
+   if(static_cast<bool>(mod->find_member("Sout_Rdata_ram", port_o_K, cir)) != static_cast<bool>(mod->find_member("Sout_DataRdy", port_o_K, cir)))
+      return false;
+   if(mod->get_in_out_port_size())
+      return false;
+   /// the ports are accessed as plain integers of the verilated model
+   const auto is_supported_port = [&](const structural_objectRef& port) -> bool { return get_port_bitsize(port) <= 64 and HDL_manager::convert_to_identifier(writer.get(), port->get_id()) == port->get_id(); };
+   for(unsigned int i = 0; i < mod->get_in_port_size(); i++)
+      if(not is_supported_port(mod->get_in_port(i)))
+         return false;
+   for(unsigned int i = 0; i < mod->get_out_port_size(); i++)
+      if(not is_supported_port(mod->get_out_port(i)))
+         return false;
+   for(const auto& par : HLSMgr->RSim->simulationArgSignature)
+   {
+      const auto portInst = mod->find_member(par, port_o_K, cir);
+      if(not portInst or GetPointer<port_o>(portInst)->get_port_interface() != port_o::port_interface::PI_DEFAULT)
+         return false;
+   }
+   return true;
+}
+
+std::string TestbenchGenerationBaseStep::write_verilator_native_testbench(const std::string& input_file) const
+{
+   const tree_managerRef TreeM = HLSMgr->get_tree_manager();
+
+   /// the simulation script builds the testbench written in HDL when it exists
+   const std::string hdl_testbench_file = output_directory + hdl_testbench_basename + "_tb.v";
+   if(boost::filesystem::exists(hdl_testbench_file))
+      boost::filesystem::remove(hdl_testbench_file);
+
+   const std::string top_fname = mod->get_typeRef()->id_type;
+   const std::string result_file = parameters->getOption<std::string>(OPT_simulation_output);
+   unsigned int testbench_memsize = HLSMgr->Rmem->get_memory_address() - parameters->getOption<unsigned int>(OPT_base_address);
+   if(testbench_memsize == 0)
+      testbench_memsize = 1;
+   const std::string reset_active = parameters->getOption<bool>(OPT_level_reset) ? "1" : "0";
+   const std::string reset_inactive = parameters->getOption<bool>(OPT_level_reset) ? "0" : "1";
+   std::string mem_delay_read = parameters->getOption<std::string>(OPT_mem_delay_read);
+   if(parameters->getOption<std::string>(OPT_bram_high_latency) == "_3")
+      mem_delay_read = "3";
+   else if(parameters->getOption<std::string>(OPT_bram_high_latency) == "_4")
+      mem_delay_read = "4";
+   else if(parameters->getOption<std::string>(OPT_bram_high_latency) != "")
+      THROW_ERROR("unexpected bram high latency delay");
+   const std::string mem_delay_write = parameters->getOption<std::string>(OPT_mem_delay_write);
+
+   /// external memory channels
+   const structural_objectRef Mout_addr_ram_port = mod->find_member("Mout_addr_ram", port_o_K, cir);
+   const bool has_memory = static_cast<bool>(Mout_addr_ram_port);
+   const bool has_sout = static_cast<bool>(mod->find_member("Sout_Rdata_ram", port_o_K, cir));
+   unsigned int n_channels = 0, n_write_channels = 0;
+   unsigned long long int addr_bitsize = 0, wdata_bitsize = 0, rdata_bitsize = 0, size_bitsize = 0;
+   std::vector<std::pair<std::string, std::string>> slave_ports;
+   std::vector<std::string> master_input_ports;
+   if(has_memory)
+   {
+      const structural_objectRef Mout_Wdata_ram_port = mod->find_member("Mout_Wdata_ram", port_o_K, cir);
+      THROW_ASSERT(Mout_Wdata_ram_port, "Mout_Wdata_ram port is missing");
+      const structural_objectRef M_Rdata_ram_port = mod->find_member("M_Rdata_ram", port_o_K, cir);
+      THROW_ASSERT(M_Rdata_ram_port, "M_Rdata_ram port is missing");
+      const structural_objectRef Mout_data_ram_size_port = mod->find_member("Mout_data_ram_size", port_o_K, cir);
+      THROW_ASSERT(Mout_data_ram_size_port, "Mout_data_ram_size port is missing");
+      n_channels = M_Rdata_ram_port->get_kind() == port_vector_o_K ? GetPointer<port_o>(M_Rdata_ram_port)->get_ports_size() : 1;
+      n_write_channels = Mout_Wdata_ram_port->get_kind() == port_vector_o_K ? GetPointer<port_o>(Mout_Wdata_ram_port)->get_ports_size() : 1;
+      addr_bitsize = GET_TYPE_SIZE(Mout_addr_ram_port);
+      wdata_bitsize = GET_TYPE_SIZE(Mout_Wdata_ram_port);
+      rdata_bitsize = GET_TYPE_SIZE(M_Rdata_ram_port);
+      size_bitsize = GET_TYPE_SIZE(Mout_data_ram_size_port);
+      for(const std::string signal : {"oe_ram", "we_ram", "addr_ram", "data_ram_size", "Wdata_ram"})
+      {
+         if(mod->find_member("S_" + signal, port_o_K, cir))
+            slave_ports.push_back(std::make_pair("S_" + signal, "Mout_" + signal));
+         if(mod->find_member("Min_" + signal, port_o_K, cir))
+            master_input_ports.push_back("Min_" + signal);
+      }
+   }
+
+   /// parameters read from the stimuli file and pointed memory compared with the expected values (the size of the elements is 0 for integers)
+   std::vector<std::string> parameters_ports;
+   std::vector<std::pair<std::string, unsigned int>> checked_pointers;
+   for(const auto& par : HLSMgr->RSim->simulationArgSignature)
+   {
+      const auto portInst = mod->find_member(par, port_o_K, cir);
+      THROW_ASSERT(portInst, "unexpected condition");
+      parameters_ports.push_back(portInst->get_id());
+      if(GetPointer<port_o>(portInst)->get_is_memory() || (GetPointer<port_o>(portInst)->get_is_extern() && GetPointer<port_o>(portInst)->get_is_global()) || !portInst->get_typeRef()->treenode ||
+         !tree_helper::is_a_pointer(TreeM, portInst->get_typeRef()->treenode))
+         continue;
+      unsigned int pt_type_index = tree_helper::get_pointed_type(TreeM, tree_helper::get_type_index(TreeM, portInst->get_typeRef()->treenode));
+      tree_nodeRef pt_node = TreeM->get_tree_node_const(pt_type_index);
+      while(GetPointer<array_type>(pt_node))
+      {
+         pt_type_index = GET_INDEX_NODE(GetPointer<array_type>(pt_node)->elts);
+         pt_node = GET_NODE(GetPointer<array_type>(pt_node)->elts);
+      }
+      unsigned int element_bitsize = 0;
+      if(tree_helper::is_real(TreeM, pt_type_index))
+      {
+         element_bitsize = tree_helper::size(TreeM, pt_type_index);
+         if(element_bitsize != 32 and element_bitsize != 64)
+            THROW_ERROR_CODE(NODE_NOT_YET_SUPPORTED_EC, "floating point precision not yet supported: " + STR(element_bitsize));
+      }
+      checked_pointers.push_back(std::make_pair(portInst->get_id(), element_bitsize));
+   }
+
+   const structural_objectRef return_port = mod->find_member(RETURN_PORT_NAME, port_o_K, cir);
+   const unsigned long long int return_bitsize = return_port ? GET_TYPE_SIZE(return_port) : 0;
+   const bool return_is_real = return_port and return_port->get_typeRef()->type == structural_type_descriptor::REAL;
+   if(return_is_real and return_bitsize != 32 and return_bitsize != 64)
+      THROW_ERROR_CODE(NODE_NOT_YET_SUPPORTED_EC, "floating point precision not yet supported: " + STR(return_bitsize));
+   const std::string return_to_real = return_bitsize == 32 ? "bits32_to_real64" : "bits64_to_real64";
+
+   std::ostringstream os;
+   simple_indent PP('{', '}', 3);
+   PP(os, "#include <cmath>\n");
+   PP(os, "#include <cstdio>\n");
+   PP(os, "#include <cstdlib>\n");
+   PP(os, "#include <cstring>\n");
+   PP(os, "#include <vector>\n");
+   PP(os, "#ifdef _WIN32\n");
+   PP(os, "#include <fstream>\n");
+   PP(os, "#include <iterator>\n");
+   PP(os, "#else\n");
+   PP(os, "#include <fcntl.h>\n");
+   PP(os, "#include <sys/mman.h>\n");
+   PP(os, "#include <sys/stat.h>\n");
+   PP(os, "#include <unistd.h>\n");
+   PP(os, "#endif\n");
+   PP(os, "#include <verilated.h>\n");
+   PP(os, "#include \"V" + top_fname + ".h\"\n");
+   PP(os, "\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "# include <verilated_vcd_c.h>\n");
+   PP(os, "#endif\n");
+   PP(os, "\n");
+   PP(os, "#define SIMULATION_MAX " + STR(parameters->getOption<int>(OPT_max_sim_cycles)) + "\n");
+   PP(os, "\n");
+   PP(os, "static const double CLOCK_PERIOD = " + boost::lexical_cast<std::string>(target_period) + ";\n");
+   PP(os, "static const double HALF_CLOCK_PERIOD = CLOCK_PERIOD/2;\n");
+   PP(os, "static const unsigned long long int MEMSIZE = " + STR(testbench_memsize) + ";\n");
+   PP(os, "static const double MAX_ULP = " + STR(parameters->getOption<double>(OPT_max_ulp)) + ";\n");
+   PP(os, "static const unsigned char RESET_ACTIVE = " + reset_active + ";\n");
+   PP(os, "static const unsigned char RESET_INACTIVE = " + reset_inactive + ";\n");
+   PP(os, "\n");
+   PP(os, "double main_time = 0;\n");
+   PP(os, "\n");
+   PP(os, "double sc_time_stamp ()  {return main_time;}\n");
+   PP(os, "\n");
+   PP(os, "static V" + top_fname + "* top;\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "static VerilatedVcdC* tfp = nullptr;\n");
+   PP(os, "#endif\n");
+   PP(os, "static FILE* res_file = nullptr;\n");
+   PP(os, "\n");
+   PP(os, "/// content of the stimuli file\n");
+   PP(os, "static const char* values_cursor = nullptr;\n");
+   PP(os, "static const char* values_end = nullptr;\n");
+   PP(os, "\n");
+   PP(os, "/// external memory: a flat array of bytes starting at base_addr\n");
+   PP(os, "static std::vector<unsigned char> memory(MEMSIZE, 0);\n");
+   PP(os, "static unsigned long long int base_addr = 0;\n");
+   PP(os, "static unsigned long long int addr_i = 0;\n");
+   PP(os, "\n");
+   PP(os, "static bool success = true;\n");
+   PP(os, "static bool compare_outputs = false;\n");
+   PP(os, "\n");
+   PP(os, "static void finish(int status)\n");
+   PP(os, "{\n");
+   PP(os, "if(res_file)\n");
+   PP(os, "   fclose(res_file);\n");
+   PP(os, "top->final();\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "if(tfp)\n");
+   PP(os, "{\n");
+   PP(os, "tfp->close();\n");
+   PP(os, "delete tfp;\n");
+   PP(os, "}\n");
+   PP(os, "#endif\n");
+   PP(os, "delete top;\n");
+   PP(os, "exit(status);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static unsigned long long int get_bits(unsigned long long int signal, unsigned int lsb, unsigned int width)\n");
+   PP(os, "{\n");
+   PP(os, "return (signal >> lsb) & (width >= 64 ? ~0ULL : ((1ULL << width) - 1));\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static unsigned long long int set_bits(unsigned long long int signal, unsigned int lsb, unsigned int width, unsigned long long int value)\n");
+   PP(os, "{\n");
+   PP(os, "const unsigned long long int mask = (width >= 64 ? ~0ULL : ((1ULL << width) - 1)) << lsb;\n");
+   PP(os, "return (signal & ~mask) | ((value << lsb) & mask);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "/// little endian read of n_bytes bytes of the memory\n");
+   PP(os, "static unsigned long long int load(unsigned long long int offset, unsigned int n_bytes)\n");
+   PP(os, "{\n");
+   PP(os, "unsigned long long int value = 0;\n");
+   PP(os, "for(unsigned int byte = 0; byte < n_bytes; ++byte)\n");
+   PP(os, "   if(offset + byte < MEMSIZE)\n");
+   PP(os, "      value |= static_cast<unsigned long long int>(memory[offset + byte]) << (8 * byte);\n");
+   PP(os, "return value;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static void skip_line()\n");
+   PP(os, "{\n");
+   PP(os, "while(values_cursor < values_end && *values_cursor != '\\n')\n");
+   PP(os, "   ++values_cursor;\n");
+   PP(os, "if(values_cursor < values_end)\n");
+   PP(os, "   ++values_cursor;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "/// return the kind of the next record skipping comments and empty lines (0 at the end of the file)\n");
+   PP(os, "static char next_record()\n");
+   PP(os, "{\n");
+   PP(os, "while(values_cursor < values_end && (*values_cursor == '/' || *values_cursor == '\\n' || *values_cursor == '\\r'))\n");
+   PP(os, "   skip_line();\n");
+   PP(os, "return values_cursor < values_end ? *values_cursor : 0;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "/// return the payload of the current record and move to the next one\n");
+   PP(os, "static const char* read_record(size_t& length)\n");
+   PP(os, "{\n");
+   PP(os, "const char* payload = ++values_cursor;\n");
+   PP(os, "while(values_cursor < values_end && *values_cursor != '\\n' && *values_cursor != '\\r')\n");
+   PP(os, "   ++values_cursor;\n");
+   PP(os, "length = static_cast<size_t>(values_cursor - payload);\n");
+   PP(os, "skip_line();\n");
+   PP(os, "return payload;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static void read_error()\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"ERROR - Unknown error while reading the file. Character found: %c\\n\", values_cursor < values_end ? *values_cursor : ' ');\n");
+   PP(os, "finish(1);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static unsigned long long int binary_value(const char* digits, size_t length)\n");
+   PP(os, "{\n");
+   PP(os, "unsigned long long int value = 0;\n");
+   PP(os, "for(size_t digit = 0; digit < length; ++digit)\n");
+   PP(os, "   value = (value << 1) | (digits[digit] == '1' ? 1ULL : 0ULL);\n");
+   PP(os, "return value;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static unsigned int hex_digit(char digit)\n");
+   PP(os, "{\n");
+   PP(os, "return digit >= 'a' ? static_cast<unsigned int>(digit - 'a' + 10) : (digit >= 'A' ? static_cast<unsigned int>(digit - 'A' + 10) : static_cast<unsigned int>(digit - '0'));\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static void read_memory_records()\n");
+   PP(os, "{\n");
+   PP(os, "for(char record = next_record(); record == 'm' || record == 'M' || record == 'z'; record = next_record())\n");
+   PP(os, "{\n");
+   PP(os, "size_t length;\n");
+   PP(os, "const char* payload = read_record(length);\n");
+   PP(os, "if(record == 'm')\n");
+   PP(os, "{\n");
+   PP(os, "if(addr_i < MEMSIZE)\n");
+   PP(os, "   memory[addr_i] = static_cast<unsigned char>(binary_value(payload, length));\n");
+   PP(os, "++addr_i;\n");
+   PP(os, "}\n");
+   PP(os, "else if(record == 'M')\n");
+   PP(os, "{\n");
+   PP(os, "/// expected format: Mnhh...h (n+1 bytes, starting from the one with the highest address)\n");
+   PP(os, "if(length == 0)\n");
+   PP(os, "   read_error();\n");
+   PP(os, "const unsigned int n_bytes = hex_digit(payload[0]) + 1;\n");
+   PP(os, "const char* digits = payload + 1;\n");
+   PP(os, "const size_t n_digits = length - 1;\n");
+   PP(os, "for(unsigned int byte = 0; byte < n_bytes; ++byte)\n");
+   PP(os, "{\n");
+   PP(os, "unsigned int value = 0;\n");
+   PP(os, "if(2 * byte < n_digits)\n");
+   PP(os, "   value = hex_digit(digits[n_digits - 1 - 2 * byte]);\n");
+   PP(os, "if(2 * byte + 1 < n_digits)\n");
+   PP(os, "   value |= hex_digit(digits[n_digits - 2 - 2 * byte]) << 4;\n");
+   PP(os, "if(addr_i + byte < MEMSIZE)\n");
+   PP(os, "   memory[addr_i + byte] = static_cast<unsigned char>(value);\n");
+   PP(os, "}\n");
+   PP(os, "addr_i += n_bytes;\n");
+   PP(os, "}\n");
+   PP(os, "else\n");
+   PP(os, "{\n");
+   PP(os, "/// expected format: zd...d (number of zero bytes)\n");
+   PP(os, "unsigned long long int n_bytes = 0;\n");
+   PP(os, "for(size_t digit = 0; digit < length; ++digit)\n");
+   PP(os, "   n_bytes = n_bytes * 10 + static_cast<unsigned long long int>(payload[digit] - '0');\n");
+   PP(os, "for(unsigned long long int byte = 0; byte < n_bytes && addr_i + byte < MEMSIZE; ++byte)\n");
+   PP(os, "   memory[addr_i + byte] = 0;\n");
+   PP(os, "addr_i += n_bytes;\n");
+   PP(os, "}\n");
+   PP(os, "}\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static unsigned long long int read_parameter()\n");
+   PP(os, "{\n");
+   PP(os, "if(next_record() != 'p')\n");
+   PP(os, "   read_error();\n");
+   PP(os, "size_t length;\n");
+   PP(os, "const char* payload = read_record(length);\n");
+   PP(os, "return binary_value(payload, length);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static double bits64_to_real64(unsigned long long int in)\n");
+   PP(os, "{\n");
+   PP(os, "double out;\n");
+   PP(os, "memcpy(&out, &in, sizeof(out));\n");
+   PP(os, "return out;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static double bits32_to_real64(unsigned long long int in)\n");
+   PP(os, "{\n");
+   PP(os, "const unsigned long long int exponent = (in >> 23) & 0xFFULL;\n");
+   PP(os, "const unsigned long long int exp_tmp = exponent == 0 ? 0 : (exponent == 0xFFULL ? 0x7FFULL : exponent + 896);\n");
+   PP(os, "return bits64_to_real64((((in >> 31) & 1ULL) << 63) | (exp_tmp << 52) | ((in & 0x7FFFFFULL) << 29));\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static double compute_ulp32(unsigned long long int computed, unsigned long long int expected)\n");
+   PP(os, "{\n");
+   PP(os, "computed &= 0xFFFFFFFFULL;\n");
+   PP(os, "expected &= 0xFFFFFFFFULL;\n");
+   PP(os, "if(((expected >> 23) & 0xFFULL) == 0xFFULL || ((computed >> 23) & 0xFFULL) == 0xFFULL)\n");
+   PP(os, "   return computed != expected && ((computed & 0x7FFFFFULL) == 0 || (expected & 0x7FFFFFULL) == 0) ? static_cast<double>(0x7F000001ULL) : 0.0;\n");
+   PP(os, "if((expected & 0x7FFFFFFFULL) == 0 && (computed & 0x7FFFFFFFULL) == 0 && (expected >> 31) != (computed >> 31))\n");
+   PP(os, "   return 1.0;\n");
+   PP(os, "const unsigned long long int denom = (expected & 0x7FFFFFFFULL) == 0 ? (104ULL << 23) : ((((expected >> 23) - 23) & 0xFFULL) << 23);\n");
+   PP(os, "return std::fabs(bits32_to_real64(computed & 0x7FFFFFFFULL) - bits32_to_real64(expected & 0x7FFFFFFFULL)) / bits32_to_real64(denom);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "static double compute_ulp64(unsigned long long int computed, unsigned long long int expected)\n");
+   PP(os, "{\n");
+   PP(os, "if(((expected >> 52) & 0x7FFULL) == 0x7FFULL || ((computed >> 52) & 0x7FFULL) == 0x7FFULL)\n");
+   PP(os, "   return computed != expected && ((computed & 0xFFFFFFFFFFFFFULL) == 0 || (expected & 0xFFFFFFFFFFFFFULL) == 0) ? static_cast<double>(0x7FE0000000000001ULL) : 0.0;\n");
+   PP(os, "if((expected & 0x7FFFFFFFFFFFFFFFULL) == 0 && (computed & 0x7FFFFFFFFFFFFFFFULL) == 0 && (expected >> 63) != (computed >> 63))\n");
+   PP(os, "   return 1.0;\n");
+   PP(os, "const unsigned long long int denom = (expected & 0x7FFFFFFFFFFFFFFFULL) == 0 ? (971ULL << 52) : ((((expected >> 52) - 52) & 0x7FFULL) << 52);\n");
+   PP(os, "return std::fabs(bits64_to_real64(computed & 0x7FFFFFFFFFFFFFFFULL) - bits64_to_real64(expected & 0x7FFFFFFFFFFFFFFFULL)) / bits64_to_real64(denom);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "/// compare the memory pointed by a parameter with the expected values (bitsize is 32 or 64 for reals, 0 for integers compared byte by byte)\n");
+   PP(os, "static void check_memory(unsigned long long int address, unsigned int bitsize)\n");
+   PP(os, "{\n");
+   PP(os, "unsigned long long int offset = address - base_addr;\n");
+   PP(os, "for(char record = next_record(); record == 'o'; record = next_record())\n");
+   PP(os, "{\n");
+   PP(os, "size_t length;\n");
+   PP(os, "const char* payload = read_record(length);\n");
+   PP(os, "compare_outputs = true;\n");
+   PP(os, "if(bitsize)\n");
+   PP(os, "{\n");
+   PP(os, "const double ulp = bitsize == 32 ? compute_ulp32(load(offset, 4), binary_value(payload, length)) : compute_ulp64(load(offset, 8), binary_value(payload, length));\n");
+   PP(os, "if(ulp > MAX_ULP)\n");
+   PP(os, "   success = false;\n");
+   PP(os, "offset += bitsize / 8;\n");
+   PP(os, "}\n");
+   PP(os, "else\n");
+   PP(os, "{\n");
+   PP(os, "size_t lsb = length;\n");
+   PP(os, "do\n");
+   PP(os, "{\n");
+   PP(os, "const size_t msb = lsb > 8 ? lsb - 8 : 0;\n");
+   PP(os, "if(load(offset, 1) != binary_value(payload + msb, lsb - msb))\n");
+   PP(os, "   success = false;\n");
+   PP(os, "++offset;\n");
+   PP(os, "lsb = msb;\n");
+   PP(os, "} while(lsb > 0);\n");
+   PP(os, "}\n");
+   PP(os, "}\n");
+   PP(os, "if(next_record() != 'e')\n");
+   PP(os, "   read_error();\n");
+   PP(os, "size_t length;\n");
+   PP(os, "read_record(length);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   if(has_memory)
+   {
+      PP(os, "static const unsigned int MEM_DELAY_READ = " + mem_delay_read + ";\n");
+      PP(os, "static const unsigned int MEM_DELAY_WRITE = " + mem_delay_write + ";\n");
+      PP(os, "static const unsigned int N_CHANNELS = " + STR(n_channels) + ";\n");
+      PP(os, "static const unsigned int N_WRITE_CHANNELS = " + STR(n_write_channels) + ";\n");
+      PP(os, "static const unsigned int ADDR_BITSIZE = " + STR(addr_bitsize) + ";\n");
+      PP(os, "static const unsigned int WDATA_BITSIZE = " + STR(wdata_bitsize) + ";\n");
+      PP(os, "static const unsigned int RDATA_BITSIZE = " + STR(rdata_bitsize) + ";\n");
+      PP(os, "static const unsigned int SIZE_BITSIZE = " + STR(size_bitsize) + ";\n");
+      PP(os, "static unsigned int data_ready[N_CHANNELS];\n");
+      PP(os, "\n");
+      PP(os, "static bool in_range(unsigned long long int address)\n");
+      PP(os, "{\n");
+      PP(os, "return base_addr <= address && address < base_addr + MEMSIZE;\n");
+      PP(os, "}\n");
+      PP(os, "\n");
+      PP(os, "/// combinational part of the memory model: read data and data ready of each channel\n");
+      PP(os, "static void drive_memory()\n");
+      PP(os, "{\n");
+      PP(os, "unsigned long long int rdata = 0;\n");
+      PP(os, "unsigned long long int data_rdy = 0;\n");
+      PP(os, "for(unsigned int channel = 0; channel < N_CHANNELS; ++channel)\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned long long int address = get_bits(top->Mout_addr_ram, channel * ADDR_BITSIZE, ADDR_BITSIZE);\n");
+      PP(os, "if(in_range(address))\n");
+      PP(os, "{\n");
+      PP(os, "rdata = set_bits(rdata, channel * RDATA_BITSIZE, RDATA_BITSIZE, load(address - base_addr, RDATA_BITSIZE / 8));\n");
+      PP(os, "if(data_ready[channel] == MEM_DELAY_READ - 1 || (get_bits(top->Mout_we_ram, channel, 1) && data_ready[channel] == MEM_DELAY_WRITE - 1))\n");
+      PP(os, "   data_rdy = set_bits(data_rdy, channel, 1, 1);\n");
+      PP(os, "}\n");
+      if(has_sout)
+      {
+         PP(os, "else\n");
+         PP(os, "   rdata = set_bits(rdata, channel * RDATA_BITSIZE, RDATA_BITSIZE, get_bits(top->Sout_Rdata_ram, channel * RDATA_BITSIZE, RDATA_BITSIZE));\n");
+      }
+      PP(os, "}\n");
+      if(has_sout)
+      {
+         PP(os, "top->M_Rdata_ram = rdata;\n");
+         PP(os, "top->M_DataRdy = data_rdy | top->Sout_DataRdy;\n");
+      }
+      else
+      {
+         PP(os, "top->M_Rdata_ram = rdata;\n");
+         PP(os, "top->M_DataRdy = data_rdy;\n");
+      }
+      for(const auto& slave_port : slave_ports)
+         PP(os, "top->" + slave_port.first + " = top->" + slave_port.second + ";\n");
+      PP(os, "}\n");
+      PP(os, "\n");
+      PP(os, "/// sequential part of the memory model, evaluated just before the rising edge of the clock\n");
+      PP(os, "static void clock_memory()\n");
+      PP(os, "{\n");
+      PP(os, "for(unsigned int channel = 0; channel < N_WRITE_CHANNELS; ++channel)\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned long long int address = get_bits(top->Mout_addr_ram, channel * ADDR_BITSIZE, ADDR_BITSIZE);\n");
+      PP(os, "if(get_bits(top->Mout_we_ram, channel, 1) && in_range(address))\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned long long int size = get_bits(top->Mout_data_ram_size, channel * SIZE_BITSIZE, SIZE_BITSIZE);\n");
+      PP(os, "const unsigned long long int mask = size >= 64 ? ~0ULL : ((1ULL << size) - 1);\n");
+      PP(os, "const unsigned long long int wdata = get_bits(top->Mout_Wdata_ram, channel * WDATA_BITSIZE, WDATA_BITSIZE);\n");
+      PP(os, "for(unsigned int byte = 0; byte < WDATA_BITSIZE / 8 && address - base_addr + byte < MEMSIZE; ++byte)\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned char byte_mask = static_cast<unsigned char>(mask >> (8 * byte));\n");
+      PP(os, "unsigned char& cell = memory[address - base_addr + byte];\n");
+      PP(os, "cell = static_cast<unsigned char>((cell & ~byte_mask) | ((wdata >> (8 * byte)) & byte_mask));\n");
+      PP(os, "}\n");
+      PP(os, "}\n");
+      PP(os, "}\n");
+      PP(os, "for(unsigned int channel = 0; channel < N_CHANNELS; ++channel)\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned long long int address = get_bits(top->Mout_addr_ram, channel * ADDR_BITSIZE, ADDR_BITSIZE);\n");
+      PP(os, "const bool oe = get_bits(top->Mout_oe_ram, channel, 1) != 0;\n");
+      PP(os, "const bool we = get_bits(top->Mout_we_ram, channel, 1) != 0;\n");
+      PP(os, "if(oe && we)\n");
+      PP(os, "{\n");
+      PP(os, "printf(\"ERROR - Mout_we_ram and Mout_oe_ram both enabled\\n\");\n");
+      PP(os, "finish(1);\n");
+      PP(os, "}\n");
+      PP(os, "if(oe && in_range(address))\n");
+      PP(os, "   data_ready[channel] = data_ready[channel] < MEM_DELAY_READ - 1 ? data_ready[channel] + 1 : 0;\n");
+      PP(os, "else if(we && in_range(address))\n");
+      PP(os, "   data_ready[channel] = data_ready[channel] < MEM_DELAY_WRITE - 1 ? data_ready[channel] + 1 : 0;\n");
+      PP(os, "else\n");
+      PP(os, "   data_ready[channel] = 0;\n");
+      PP(os, "}\n");
+      PP(os, "}\n");
+      PP(os, "\n");
+      PP(os, "/// propagate the responses of the memory until the requests of the top component are stable\n");
+      PP(os, "static void settle()\n");
+      PP(os, "{\n");
+      PP(os, "for(unsigned int iteration = 0; iteration < 16; ++iteration)\n");
+      PP(os, "{\n");
+      PP(os, "const unsigned long long int oe = top->Mout_oe_ram, we = top->Mout_we_ram, address = top->Mout_addr_ram, wdata = top->Mout_Wdata_ram, size = top->Mout_data_ram_size;\n");
+      PP(os, "drive_memory();\n");
+      PP(os, "top->eval();\n");
+      PP(os, "if(oe == top->Mout_oe_ram && we == top->Mout_we_ram && address == top->Mout_addr_ram && wdata == top->Mout_Wdata_ram && size == top->Mout_data_ram_size)\n");
+      PP(os, "   break;\n");
+      PP(os, "}\n");
+      PP(os, "}\n");
+   }
+   else
+   {
+      PP(os, "static void settle()\n");
+      PP(os, "{\n");
+      PP(os, "top->eval();\n");
+      PP(os, "}\n");
+   }
+   if(return_port)
+   {
+      PP(os, "\n");
+      PP(os, "static void check_return_value(unsigned long long int computed)\n");
+      PP(os, "{\n");
+      PP(os, "for(char record = next_record(); record == 'o'; record = next_record())\n");
+      PP(os, "{\n");
+      PP(os, "size_t length;\n");
+      PP(os, "const char* payload = read_record(length);\n");
+      PP(os, "compare_outputs = true;\n");
+      PP(os, "const unsigned long long int expected = get_bits(binary_value(payload, length), 0, " + STR(return_bitsize) + ");\n");
+      if(return_is_real)
+      {
+         PP(os, "printf(\" " + std::string(RETURN_PORT_NAME) + " = %20.20f   expected = %20.20f \\n\", " + return_to_real + "(computed), " + return_to_real + "(expected));\n");
+         PP(os, "printf(\" FP error %f \\n\\n\", compute_ulp" + STR(return_bitsize) + "(computed, expected));\n");
+         PP(os, "if(compute_ulp" + STR(return_bitsize) + "(computed, expected) > MAX_ULP)\n");
+         PP(os, "   success = false;\n");
+      }
+      else
+      {
+         PP(os, "printf(\" " + std::string(RETURN_PORT_NAME) + " = %llu   expected = %llu \\n\\n\", computed, expected);\n");
+         PP(os, "if(computed != expected)\n");
+         PP(os, "   success = false;\n");
+      }
+      PP(os, "}\n");
+      PP(os, "if(next_record() != 'e')\n");
+      PP(os, "   read_error();\n");
+      PP(os, "size_t length;\n");
+      PP(os, "read_record(length);\n");
+      PP(os, "}\n");
+   }
+   PP(os, "\n");
+   PP(os, "/// simulate a clock cycle; the inputs driven by the testbench change just after the rising edge\n");
+   PP(os, "static void cycle(unsigned char start, unsigned char reset)\n");
+   PP(os, "{\n");
+   PP(os, "top->" + std::string(CLOCK_PORT_NAME) + " = 0;\n");
+   PP(os, "settle();\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "if (tfp) tfp->dump (main_time);\n");
+   PP(os, "#endif\n");
+   PP(os, "main_time += HALF_CLOCK_PERIOD;\n");
+   if(has_memory)
+      PP(os, "clock_memory();\n");
+   PP(os, "top->" + std::string(CLOCK_PORT_NAME) + " = 1;\n");
+   PP(os, "top->eval();\n");
+   PP(os, "top->" + std::string(START_PORT_NAME) + " = start;\n");
+   PP(os, "top->" + std::string(RESET_PORT_NAME) + " = reset;\n");
+   PP(os, "settle();\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "if (tfp) tfp->dump (main_time);\n");
+   PP(os, "#endif\n");
+   PP(os, "main_time += HALF_CLOCK_PERIOD;\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+   PP(os, "int main (int argc, char **argv, char **env)\n");
+   PP(os, "{\n");
+   PP(os, "Verilated::commandArgs(argc, argv);\n");
+   PP(os, "Verilated::debug(0);\n");
+   PP(os, "#ifdef _WIN32\n");
+   PP(os, "std::ifstream values_file(\"" + input_file + "\", std::ios::binary);\n");
+   PP(os, "std::vector<char> values_buffer((std::istreambuf_iterator<char>(values_file)), std::istreambuf_iterator<char>());\n");
+   PP(os, "values_cursor = values_buffer.data();\n");
+   PP(os, "values_end = values_cursor + values_buffer.size();\n");
+   PP(os, "#else\n");
+   PP(os, "/// the stimuli file is mapped in memory and parsed in place\n");
+   PP(os, "const int values_fd = open(\"" + input_file + "\", O_RDONLY);\n");
+   PP(os, "struct stat values_stat;\n");
+   PP(os, "if(values_fd < 0 || fstat(values_fd, &values_stat) != 0)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"ERROR - Error opening the input file\\n\");\n");
+   PP(os, "return 1;\n");
+   PP(os, "}\n");
+   PP(os, "if(values_stat.st_size > 0)\n");
+   PP(os, "{\n");
+   PP(os, "void* values_map = mmap(nullptr, static_cast<size_t>(values_stat.st_size), PROT_READ, MAP_PRIVATE, values_fd, 0);\n");
+   PP(os, "if(values_map == MAP_FAILED)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"ERROR - Error mapping the input file\\n\");\n");
+   PP(os, "return 1;\n");
+   PP(os, "}\n");
+   PP(os, "madvise(values_map, static_cast<size_t>(values_stat.st_size), MADV_SEQUENTIAL);\n");
+   PP(os, "values_cursor = static_cast<const char*>(values_map);\n");
+   PP(os, "values_end = values_cursor + values_stat.st_size;\n");
+   PP(os, "}\n");
+   PP(os, "close(values_fd);\n");
+   PP(os, "#endif\n");
+   PP(os, "res_file = fopen(\"" + result_file + "\", \"w\");\n");
+   PP(os, "if(!res_file)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"ERROR - Error opening the res_file\\n\");\n");
+   PP(os, "return 1;\n");
+   PP(os, "}\n");
+   PP(os, "top = new V" + top_fname + ";\n");
+   PP(os, "#if VM_TRACE\n");
+   PP(os, "Verilated::traceEverOn(true);\n");
+   PP(os, "tfp = new VerilatedVcdC;\n");
+   PP(os, "top->trace (tfp, 99);\n");
+   PP(os, "tfp->open (\"" + output_directory + "test.vcd\");\n");
+   PP(os, "#endif\n");
+   PP(os, "top->" + std::string(CLOCK_PORT_NAME) + " = 1;\n");
+   PP(os, "top->" + std::string(RESET_PORT_NAME) + " = RESET_ACTIVE;\n");
+   PP(os, "top->" + std::string(START_PORT_NAME) + " = 0;\n");
+   for(const auto& master_port : master_input_ports)
+      PP(os, "top->" + master_port + " = 0;\n");
+   PP(os, "settle();\n");
+   PP(os, "cycle(0, RESET_ACTIVE);\n");
+   PP(os, "cycle(0, RESET_INACTIVE);\n");
+   PP(os, "unsigned int n_vectors = 0;\n");
+   PP(os, "while(true)\n");
+   PP(os, "{\n");
+   PP(os, "if(!next_record())\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"No more values found. Simulation(s) executed: %u.\\n\\n\", n_vectors);\n");
+   PP(os, "break;\n");
+   PP(os, "}\n");
+   PP(os, "++n_vectors;\n");
+   PP(os, "printf(\"Start reading vector %u's values from input file.\\n\\n\", n_vectors);\n");
+   PP(os, "while(next_record() == 'b')\n");
+   PP(os, "{\n");
+   PP(os, "size_t length;\n");
+   PP(os, "const char* payload = read_record(length);\n");
+   PP(os, "base_addr = binary_value(payload, length);\n");
+   PP(os, "}\n");
+   PP(os, "read_memory_records();\n");
+   for(const auto& parameter : parameters_ports)
+      PP(os, "top->" + parameter + " = read_parameter();\n");
+   PP(os, "printf(\"Reading of vector values from input file completed. Simulation started.\\n\");\n");
+   PP(os, "cycle(1, RESET_INACTIVE);\n");
+   PP(os, "unsigned long long int sim_time = 1;\n");
+   PP(os, "while(!top->" + std::string(DONE_PORT_NAME) + ")\n");
+   PP(os, "{\n");
+   PP(os, "if(sim_time > SIMULATION_MAX)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"Simulation not completed into %d cycles\\n\", SIMULATION_MAX);\n");
+   PP(os, "fprintf(res_file, \"X\\t\");\n");
+   PP(os, "fprintf(res_file, \"%d\\n\", SIMULATION_MAX);\n");
+   PP(os, "finish(0);\n");
+   PP(os, "}\n");
+   PP(os, "cycle(0, RESET_INACTIVE);\n");
+   PP(os, "++sim_time;\n");
+   PP(os, "}\n");
+   if(return_port)
+      PP(os, "const unsigned long long int registered_return_port = get_bits(top->" + std::string(RETURN_PORT_NAME) + ", 0, " + STR(return_bitsize) + ");\n");
+   PP(os, "cycle(0, RESET_INACTIVE);\n");
+   PP(os, "success = true;\n");
+   PP(os, "compare_outputs = false;\n");
+   for(const auto& checked_pointer : checked_pointers)
+      PP(os, "check_memory(top->" + checked_pointer.first + ", " + STR(checked_pointer.second) + ");\n");
+   if(return_port)
+      PP(os, "check_return_value(registered_return_port);\n");
+   PP(os, "if(compare_outputs)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"Simulation ended after %llu cycles.\\n\\n\", sim_time);\n");
+   PP(os, "if(success)\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"Simulation completed with success\\n\\n\");\n");
+   PP(os, "fprintf(res_file, \"1\\t\");\n");
+   PP(os, "}\n");
+   PP(os, "else\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"Simulation FAILED\\n\\n\");\n");
+   PP(os, "fprintf(res_file, \"0\\t\");\n");
+   PP(os, "}\n");
+   PP(os, "}\n");
+   PP(os, "else\n");
+   PP(os, "{\n");
+   PP(os, "printf(\"Simulation ended after %llu cycles (no expected outputs specified).\\n\\n\", sim_time);\n");
+   PP(os, "fprintf(res_file, \"-\\t\");\n");
+   PP(os, "}\n");
+   PP(os, "fprintf(res_file, \"%llu\\n\", sim_time);\n");
+   PP(os, "cycle(0, RESET_INACTIVE);\n");
+   if(HLSMgr->RSim->test_vectors.size() <= 1)
+      PP(os, "break;\n");
+   PP(os, "cycle(0, RESET_INACTIVE);\n");
+   PP(os, "}\n");
+   PP(os, "finish(0);\n");
+   PP(os, "}\n");
+   PP(os, "\n");
+
+   std::string fileName = output_directory + hdl_testbench_basename + "_main.cpp";
+   std::ofstream fileOut(fileName.c_str(), std::ios::out);
+   fileOut << os.str() << std::endl;
+   fileOut.close();
+
+   return fileName;
+}
+
 std::string TestbenchGenerationBaseStep::create_HDL_testbench(bool xilinx_isim) const
 {
    if(!parameters->getOption<bool>(OPT_generate_testbench))
@@ -475,6 +1204,10 @@ void TestbenchGenerationBaseStep::write_output_checks(const tree_managerConstRef
             portInst = mod->find_member(par + "_din", port_o_K, cir);
          }
          if(!portInst)
+         {
+            portInst = mod->find_member(par + "_TDATA", port_o_K, cir);
+         }
+         if(!portInst)
          {
             portInst = mod->find_member(par + "_d0", port_o_K, cir);
             if(portInst)
@@ -680,6 +1413,10 @@ void TestbenchGenerationBaseStep::write_output_checks(const tree_managerConstRef
             portInst = mod->find_member(par + "_din", port_o_K, cir);
          }
          if(!portInst)
+         {
+            portInst = mod->find_member(par + "_TDATA", port_o_K, cir);
+         }
+         if(!portInst)
          {
             portInst = mod->find_member(par + "_d0", port_o_K, cir);
          }
@@ -849,7 +1586,7 @@ void TestbenchGenerationBaseStep::write_output_checks(const tree_managerConstRef
             writer->write(STR(STD_CLOSING_CHAR));
             writer->write("end\n");
          }
-         else if(InterfaceType == port_o::port_interface::PI_RNONE || InterfaceType == port_o::port_interface::PI_DIN)
+         else if(InterfaceType == port_o::port_interface::PI_RNONE || InterfaceType == port_o::port_interface::PI_DIN || InterfaceType == port_o::port_interface::PI_S_AXIS)
          {
             writer->write("\n");
             writer->write_comment("OPTIONAL - skip expected value for " + portInst->get_id() + " --------------------------------------------------------------\n");
@@ -1016,11 +1753,13 @@ void TestbenchGenerationBaseStep::write_output_checks(const tree_managerConstRef
             writer->write(STR(STD_CLOSING_CHAR));
             writer->write("end\n");
          }
-         else if(InterfaceType == port_o::port_interface::PI_DOUT)
+         else if(InterfaceType == port_o::port_interface::PI_DOUT || InterfaceType == port_o::port_interface::PI_M_AXIS)
          {
             auto port_name = portInst->get_id();
-            auto terminate = port_name.size() > 3 ? port_name.size() - std::string("_d0").size() : 0;
-            THROW_ASSERT(port_name.substr(terminate) == "_d0", "inconsistent interface");
+            /// the stream beats are stored one after the other starting from the parameter address
+            const std::string data_suffix = InterfaceType == port_o::port_interface::PI_M_AXIS ? "_TDATA" : "_d0";
+            auto terminate = port_name.size() > data_suffix.size() ? port_name.size() - data_suffix.size() : 0;
+            THROW_ASSERT(port_name.substr(terminate) == data_suffix, "inconsistent interface");
             auto orig_name = port_name.substr(0, terminate);
 
             std::string port_to_be_compared;
@@ -1036,15 +1775,20 @@ void TestbenchGenerationBaseStep::write_output_checks(const tree_managerConstRef
                   else
                      bitsize = port_bitwidth;
                }
-               auto port_addr = mod->find_member(orig_name + "_address0", port_o_K, cir);
-               THROW_ASSERT(port_addr && GetPointer<port_o>(port_addr)->get_port_interface() == port_o::port_interface::PI_ADDRESS, "inconsistent interface");
+               unsigned int stride = bitsize / 8;
+               if(InterfaceType == port_o::port_interface::PI_DOUT)
+               {
+                  auto port_addr = mod->find_member(orig_name + "_address0", port_o_K, cir);
+                  THROW_ASSERT(port_addr && GetPointer<port_o>(port_addr)->get_port_interface() == port_o::port_interface::PI_ADDRESS, "inconsistent interface");
+                  stride = GetPointer<port_o>(port_addr)->get_port_alignment();
+               }
 
                port_to_be_compared = "{";
                for(unsigned int bitsize_index = 0; bitsize_index < bitsize; bitsize_index = bitsize_index + 8)
                {
                   if(bitsize_index)
                      port_to_be_compared += ", ";
-                  port_to_be_compared += "_bambu_testbench_mem_[paddr" + port_name + " + " + STR((bitsize - bitsize_index) / 8 - 1) + " - base_addr + _i_*" + STR(GetPointer<port_o>(port_addr)->get_port_alignment()) + "]";
+                  port_to_be_compared += "_bambu_testbench_mem_[paddr" + port_name + " + " + STR((bitsize - bitsize_index) / 8 - 1) + " - base_addr + _i_*" + STR(stride) + "]";
                }
                port_to_be_compared += "}";
             }
@@ -1686,6 +2430,10 @@ void TestbenchGenerationBaseStep::write_auxiliary_signal_declaration() const
             portInst = mod->find_member(par + "_din", port_o_K, cir);
          }
          if(!portInst)
+         {
+            portInst = mod->find_member(par + "_TDATA", port_o_K, cir);
+         }
+         if(!portInst)
          {
             portInst = mod->find_member(par + "_d0", port_o_K, cir);
          }
@@ -1696,7 +2444,8 @@ void TestbenchGenerationBaseStep::write_auxiliary_signal_declaration() const
          THROW_ASSERT(portInst, "unexpected condition");
          auto InterfaceType = GetPointer<port_o>(portInst)->get_port_interface();
          std::string input_name = HDL_manager::convert_to_identifier(writer.get(), portInst->get_id());
-         if(InterfaceType == port_o::port_interface::PI_RNONE || InterfaceType == port_o::port_interface::PI_WNONE || InterfaceType == port_o::port_interface::PI_DIN || InterfaceType == port_o::port_interface::PI_DOUT)
+         if(InterfaceType == port_o::port_interface::PI_RNONE || InterfaceType == port_o::port_interface::PI_WNONE || InterfaceType == port_o::port_interface::PI_DIN || InterfaceType == port_o::port_interface::PI_DOUT ||
+            InterfaceType == port_o::port_interface::PI_S_AXIS || InterfaceType == port_o::port_interface::PI_M_AXIS)
          {
             writer->write("reg [31:0] paddr" + input_name + ";\n");
             writeP = true;
@@ -1706,7 +2455,9 @@ void TestbenchGenerationBaseStep::write_auxiliary_signal_declaration() const
          writer->write("\n");
    }
    writer->write("reg [7:0] _bambu_testbench_mem_ [0:MEMSIZE-1];\n\n");
-   writer->write("reg [7:0] _bambu_databyte_;\n\n");
+   writer->write("reg [7:0] _bambu_databyte_;\n");
+   writer->write("reg [" + STR(8 * MEMORY_RECORD_BYTES - 1) + ":0] _bambu_dataword_;\n");
+   writer->write("integer _bambu_nbytes_, _bambu_index_;\n\n");
    writer->write("reg [3:0] __state, __next_state;\n");
    writer->write("reg start_results_comparison;\n");
    writer->write("reg next_start_port;\n");
@@ -1821,6 +2572,11 @@ void TestbenchGenerationBaseStep::initialize_input_signals(const tree_managerCon
          {
             writer->write("ex_" + port_obj->get_id() + " = 0;\n");
          }
+         else if(interfaceType == port_o::port_interface::PI_M_AXIS && port_obj->get_id().size() > std::string("_TDATA").size() &&
+                 port_obj->get_id().substr(port_obj->get_id().size() - std::string("_TDATA").size()) == "_TDATA")
+         {
+            writer->write("ex_" + port_obj->get_id() + " = 0;\n");
+         }
       }
       writer->write("\n");
    }
@@ -1975,7 +2731,7 @@ void TestbenchGenerationBaseStep::reading_base_memory_address_from_file() const
 void TestbenchGenerationBaseStep::memory_initialization_from_file() const
 {
    writer->write_comment("initializing memory --------------------------------------------------------------\n");
-   writer->write("while (_ch_ == \"/\" || _ch_ == \"\\n\" || _ch_ == \"m\")\n");
+   writer->write("while (_ch_ == \"/\" || _ch_ == \"\\n\" || _ch_ == \"m\" || _ch_ == \"M\" || _ch_ == \"z\")\n");
    writer->write(STR(STD_OPENING_CHAR));
    writer->write("begin\n");
    {
@@ -1989,6 +2745,39 @@ void TestbenchGenerationBaseStep::memory_initialization_from_file() const
       }
       writer->write(STR(STD_CLOSING_CHAR));
       writer->write("end\n");
+      writer->write("else if (_ch_ == \"M\")\n");
+      writer->write(STR(STD_OPENING_CHAR));
+      writer->write("begin\n");
+      {
+         writer->write_comment("expected format: Mnhh...h (n+1 bytes, starting from the one with the highest address)\n");
+         writer->write("_ch_ = $fgetc(file);\n");
+         writer->write("_bambu_nbytes_ = (_ch_ >= \"a\" ? _ch_ - \"a\" + 10 : _ch_ - \"0\") + 1;\n");
+         writer->write("_r_ = $fscanf(file,\"%h\\n\", _bambu_dataword_);\n");
+         writer->write("for (_bambu_index_ = 0; _bambu_index_ < _bambu_nbytes_; _bambu_index_ = _bambu_index_ + 1)\n");
+         writer->write(STR(STD_OPENING_CHAR));
+         writer->write("begin\n");
+         writer->write("_bambu_databyte_ = _bambu_dataword_ >> (8 * _bambu_index_);\n");
+         writer->write("_bambu_testbench_mem_[_addr_i_ + _bambu_index_] = _bambu_databyte_;\n");
+         writer->write(STR(STD_CLOSING_CHAR));
+         writer->write("end\n");
+         writer->write("_addr_i_ = _addr_i_ + _bambu_nbytes_;\n");
+      }
+      writer->write(STR(STD_CLOSING_CHAR));
+      writer->write("end\n");
+      writer->write("else if (_ch_ == \"z\")\n");
+      writer->write(STR(STD_OPENING_CHAR));
+      writer->write("begin\n");
+      {
+         writer->write_comment("expected format: zd...d (number of zero bytes)\n");
+         writer->write("_r_ = $fscanf(file,\"%d\\n\", _bambu_nbytes_);\n");
+         writer->write("for (_bambu_index_ = 0; _bambu_index_ < _bambu_nbytes_; _bambu_index_ = _bambu_index_ + 1)\n");
+         writer->write(STR(STD_OPENING_CHAR));
+         writer->write("_bambu_testbench_mem_[_addr_i_ + _bambu_index_] = 8'b0;\n");
+         writer->write(STR(STD_CLOSING_CHAR));
+         writer->write("_addr_i_ = _addr_i_ + _bambu_nbytes_;\n");
+      }
+      writer->write(STR(STD_CLOSING_CHAR));
+      writer->write("end\n");
       writer->write("else\n");
       writer->write(STR(STD_OPENING_CHAR));
       writer->write("begin\n");
@@ -183,6 +183,20 @@ class TestbenchGenerationBaseStep : public HLS_step
     */
    std::string write_verilator_testbench(const std::string& input_file) const;
 
+   /**
+    * Check if the Verilator testbench can be a C++ harness directly driving the top component
+    * (i.e., minimal interface, only default parameter ports no wider than 64 bits and no memory shared with the testbench)
+    */
+   bool is_verilator_native_testbench_supported() const;
+
+   /**
+    * Write the native Verilator testbench: the C++ harness owns the external memory as a flat array of bytes,
+    * services the memory ports of the top component, reads the stimuli file mapped in memory and checks the results.
+    *
+    * @param input_file Filename of the stimuli file.
+    */
+   std::string write_verilator_native_testbench(const std::string& input_file) const;
+
    /**
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
@@ -225,6 +239,15 @@ class TestbenchGenerationBaseStep : public HLS_step
 
    static std::string print_var_init(const tree_managerConstRef TreeM, unsigned int var, const memoryRef mem);
 
+   /**
+    * Returns the records of the values file which initialize a sequence of bytes of the memory.
+    * Up to 16 bytes are stored in hexadecimal in a single M record (M, number of bytes minus one, bytes starting from the one with the highest address),
+    * while a sequence of zero bytes is stored as a single z record (z, number of bytes)
+    * @param binary_value is the binary string of the bytes; the least significant byte is the one with the lowest address
+    * @return the records (without the line terminator)
+    */
+   static std::vector<std::string> print_memory_bytes(const std::string& binary_value);
+
    /**
     * Execute the step
     * @return the exit status of this step
@@ -121,6 +121,15 @@ void TestbenchMemoryAllocation::AllocTestbenchMemory(void) const
          mem.push_back(p);
    }
 
+   /// the lines of the cache in front of the external memory have to be entirely contained in the memory of the testbench
+   const auto cache_line_bytes = HLSMgr->Rmem->get_ext_cache_line_bytes(parameters);
+   const auto align_to_cache_line = [&]() -> void {
+      const auto memory_size = HLSMgr->Rmem->get_memory_address() - parameters->getOption<unsigned int>(OPT_base_address);
+      if(cache_line_bytes && memory_size % cache_line_bytes)
+         HLSMgr->Rmem->reserve_space(cache_line_bytes - memory_size % cache_line_bytes);
+   };
+   align_to_cache_line();
+
    // loop on the test vectors
    unsigned int v_idx = 0;
    for(const auto& curr_test_vector : HLSMgr->RSim->test_vectors)
@@ -198,6 +207,7 @@ void TestbenchMemoryAllocation::AllocTestbenchMemory(void) const
                HLSMgr->RSim->param_address[v_idx][*l] = HLSMgr->Rmem->get_memory_address();
                HLSMgr->RSim->param_mem_size[v_idx][*l] = reserved_bytes;
                HLSMgr->Rmem->reserve_space(reserved_bytes);
+               align_to_cache_line();
 
                INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
                               "---Parameter " + param + " (" + STR((*l)) + ") (testvector " + STR(v_idx) + ") allocated at " + STR(HLSMgr->RSim->param_address.at(v_idx).find(*l)->second) +
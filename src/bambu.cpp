@@ -78,6 +78,7 @@
 #include "frontend_flow_step_factory.hpp"
 
 /// HLS includes
+#include "design_space_exploration.hpp"
 #include "hls_flow_step_factory.hpp"
 #include "hls_manager.hpp"
 #include "hls_step.hpp"
@@ -111,6 +112,35 @@
 /// wrapper/treegcc includes
 #include "gcc_wrapper.hpp"
 
+/**
+ * Creates the HLS manager and the design flow manager of a synthesis with all the step factories registered
+ * @param parameters is the set of input parameters
+ * @param HLSMgr is where the HLS manager is stored
+ * @param design_flow_manager is where the design flow manager is stored
+ */
+static void CreateDesignFlow(const ParameterRef& parameters, HLS_managerRef& HLSMgr, DesignFlowManagerRef& design_flow_manager)
+{
+   /// ==== Creating target for the synthesis ==== ///
+   HLS_targetRef HLS_T = HLS_target::create_target(parameters);
+
+   /// ==== Creating behavioral specification ==== ///
+   HLSMgr = HLS_managerRef(new HLS_manager(parameters, HLS_T));
+   // create the datastructures (inside application_manager) where the problem specification is contained
+   design_flow_manager = DesignFlowManagerRef(new DesignFlowManager(parameters));
+   const DesignFlowStepFactoryConstRef frontend_flow_step_factory(new FrontendFlowStepFactory(HLSMgr, design_flow_manager, parameters));
+   design_flow_manager->RegisterFactory(frontend_flow_step_factory);
+   const DesignFlowStepFactoryConstRef hls_flow_step_factory(new HLSFlowStepFactory(design_flow_manager, HLSMgr, parameters));
+   design_flow_manager->RegisterFactory(hls_flow_step_factory);
+   const DesignFlowStepFactoryConstRef c_backend_step_factory(new CBackendStepFactory(design_flow_manager, HLSMgr, parameters));
+   design_flow_manager->RegisterFactory(c_backend_step_factory);
+   const DesignFlowStepFactoryConstRef technology_flow_step_factory(new TechnologyFlowStepFactory(HLS_T->get_technology_manager(), HLS_T->get_target_device(), design_flow_manager, parameters));
+   design_flow_manager->RegisterFactory(technology_flow_step_factory);
+#if HAVE_FROM_AADL_ASN_BUILT
+   const DesignFlowStepFactoryConstRef parser_flow_step_factory(new ParserFlowStepFactory(design_flow_manager, HLSMgr, parameters));
+   design_flow_manager->RegisterFactory(parser_flow_step_factory);
+#endif
+}
+
 /**
  * Main file used to perform high-level synthesis starting from a C specification.
  * @anchor MainBambu
@@ -215,28 +245,27 @@ int main(int argc, char* argv[])
 
       // up to now all parameters have been parsed and data structures created, so synthesis can start
 
-      /// ==== Creating target for the synthesis ==== ///
-      HLS_targetRef HLS_T = HLS_target::create_target(parameters);
+      /// ==== Design space exploration ==== ///
+      if(parameters->IsParameter("dse"))
+      {
+         const DesignSpaceExplorationRef design_space_exploration(new DesignSpaceExploration(parameters, CreateDesignFlow));
+         exit_code = design_space_exploration->Exec();
+         if(not(parameters->getOption<bool>(OPT_no_clean)))
+         {
+            boost::filesystem::remove_all(parameters->getOption<std::string>(OPT_output_temporary_directory));
+         }
+         return exit_code;
+      }
 
       /// ==== Creating intermediate representation ==== ///
       START_TIME(cpu_time);
-      /// ==== Creating behavioral specification ==== ///
-      HLS_managerRef HLSMgr = HLS_managerRef(new HLS_manager(parameters, HLS_T));
+      HLS_managerRef HLSMgr;
+      DesignFlowManagerRef design_flow_manager;
+      CreateDesignFlow(parameters, HLSMgr, design_flow_manager);
       START_TIME(HLSMgr->HLS_execution_time);
-      // create the datastructures (inside application_manager) where the problem specification is contained
-      const DesignFlowManagerRef design_flow_manager(new DesignFlowManager(parameters));
-      const DesignFlowStepFactoryConstRef frontend_flow_step_factory(new FrontendFlowStepFactory(HLSMgr, design_flow_manager, parameters));
-      design_flow_manager->RegisterFactory(frontend_flow_step_factory);
-      const DesignFlowStepFactoryConstRef hls_flow_step_factory(new HLSFlowStepFactory(design_flow_manager, HLSMgr, parameters));
-      design_flow_manager->RegisterFactory(hls_flow_step_factory);
-      const DesignFlowStepFactoryConstRef c_backend_step_factory(new CBackendStepFactory(design_flow_manager, HLSMgr, parameters));
-      design_flow_manager->RegisterFactory(c_backend_step_factory);
-      const DesignFlowStepFactoryConstRef technology_flow_step_factory(new TechnologyFlowStepFactory(HLS_T->get_technology_manager(), HLS_T->get_target_device(), design_flow_manager, parameters));
-      design_flow_manager->RegisterFactory(technology_flow_step_factory);
-#if HAVE_FROM_AADL_ASN_BUILT
-      const DesignFlowStepFactoryConstRef parser_flow_step_factory(new ParserFlowStepFactory(design_flow_manager, HLSMgr, parameters));
-      design_flow_manager->RegisterFactory(parser_flow_step_factory);
-#endif
+      const auto frontend_flow_step_factory = design_flow_manager->CGetDesignFlowStepFactory("Frontend");
+      const auto hls_flow_step_factory = design_flow_manager->CGetDesignFlowStepFactory("HLS");
+      const auto c_backend_step_factory = design_flow_manager->CGetDesignFlowStepFactory("CBackend");
 
       if(parameters->isOption(OPT_dry_run_evaluation) and parameters->getOption<bool>(OPT_dry_run_evaluation))
       {
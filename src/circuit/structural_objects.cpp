@@ -889,7 +889,9 @@ const std::string structural_object::get_path() const
 
 const char* port_o::port_directionNames[] = {"IN", "OUT", "IO", "GEN", "UNKNOWN"};
 
-const char* port_o::port_interfaceNames[] = {"PI_DEFAULT", "PI_RNONE", "PI_WNONE"};
+const char* port_o::port_interfaceNames[] = {"PI_DEFAULT", "PI_RNONE",      "PI_WNONE",      "PI_RACK",  "PI_WACK",  "PI_RVALID",   "PI_WVALID",   "PI_EMPTY_N", "PI_READ",   "PI_FULL_N", "PI_WRITE",
+                                             "PI_ADDRESS", "PI_CHIPENABLE", "PI_WRITEENABLE", "PI_DIN", "PI_DOUT", "PI_M_AXI_AW", "PI_M_AXI_W", "PI_M_AXI_B", "PI_M_AXI_AR", "PI_M_AXI_R",
+                                             "PI_S_AXIS",  "PI_M_AXIS"};
 
 port_o::port_o(int _debug_level, const structural_objectRef o, port_direction _dir, so_kind _port_type)
     : structural_object(_debug_level, o),
@@ -687,7 +687,14 @@ struct port_o : public structural_object
       PI_CHIPENABLE,
       PI_WRITEENABLE,
       PI_DIN,
-      PI_DOUT
+      PI_DOUT,
+      PI_M_AXI_AW, ///< AXI4 master write address channel
+      PI_M_AXI_W,  ///< AXI4 master write data channel
+      PI_M_AXI_B,  ///< AXI4 master write response channel
+      PI_M_AXI_AR, ///< AXI4 master read address channel
+      PI_M_AXI_R,  ///< AXI4 master read data channel
+      PI_S_AXIS,   ///< AXI4-Stream slave: the stream consumed by the design
+      PI_M_AXIS    ///< AXI4-Stream master: the stream produced by the design
    };
 
    static const unsigned int PARAMETRIC_PORT = static_cast<unsigned int>(-1);
@@ -43,4 +43,7 @@
 /// The basename of the testbench files
 #define STR_CST_testbench_generation_basename "values"
 
+/// The maximum number of bytes stored in a single memory initialization record of the values file
+#define MEMORY_RECORD_BYTES 16
+
 #endif
@@ -67,6 +67,9 @@
 /// HLS/memory include
 #include "memory.hpp"
 
+/// constants include
+#include "testbench_generation_constants.hpp"
+
 /// HLS/simulation include
 #include "SimulationInformation.hpp"
 #include "c_initialization_parser.hpp"
@@ -186,26 +189,55 @@ void HLSCWriter::WriteTestbenchHelperFunctions()
    indented_output_stream->Append("void _Dec2Bin_(FILE * __bambu_testbench_fp, long long int num, unsigned int precision)\n");
    indented_output_stream->Append("{\n");
    indented_output_stream->Append("unsigned int i;\n");
+   indented_output_stream->Append("char buffer[64];\n");
    indented_output_stream->Append("unsigned long long int ull_value = (unsigned long long int) num;\n");
    indented_output_stream->Append("for (i = 0; i < precision; ++i)\n");
-   indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"%c\", (((1LLU << (precision - i -1)) & ull_value) ? '1' : '0'));\n");
+   indented_output_stream->Append("buffer[i] = (((1LLU << (precision - i -1)) & ull_value) ? '1' : '0');\n");
+   indented_output_stream->Append("fwrite(buffer, 1, precision, __bambu_testbench_fp);\n");
    indented_output_stream->Append("}\n\n");
    // pointer to binary conversion function
    indented_output_stream->Append("void _Ptd2Bin_(FILE * __bambu_testbench_fp, unsigned char * num, unsigned int precision)\n");
    indented_output_stream->Append("{\n");
-   indented_output_stream->Append("unsigned int i, j;\n");
+   indented_output_stream->Append("unsigned int i, j, k = 0;\n");
    indented_output_stream->Append("char value;\n");
+   indented_output_stream->Append("char buffer[256];\n");
    indented_output_stream->Append("if (precision%8)\n");
    indented_output_stream->Append("{\n");
    indented_output_stream->Append("value = *(num+precision/8);\n");
    indented_output_stream->Append("for (j = 8-precision%8; j < 8; ++j)\n");
-   indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"%c\", (((1LLU << (8 - j - 1)) & value) ? '1' : '0'));\n");
+   indented_output_stream->Append("buffer[k++] = (((1LLU << (8 - j - 1)) & value) ? '1' : '0');\n");
    indented_output_stream->Append("}\n");
    indented_output_stream->Append("for (i = 0; i < 8*(precision/8); i = i + 8)\n");
    indented_output_stream->Append("{\n");
    indented_output_stream->Append("value = *(num + (precision / 8) - (i / 8) - 1);\n");
    indented_output_stream->Append("for (j = 0; j < 8; ++j)\n");
-   indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"%c\", (((1LLU << (8 - j - 1)) & value) ? '1' : '0'));\n");
+   indented_output_stream->Append("buffer[k++] = (((1LLU << (8 - j - 1)) & value) ? '1' : '0');\n");
+   indented_output_stream->Append("if (k > sizeof(buffer) - 8)\n");
+   indented_output_stream->Append("{\n");
+   indented_output_stream->Append("fwrite(buffer, 1, k, __bambu_testbench_fp);\n");
+   indented_output_stream->Append("k = 0;\n");
+   indented_output_stream->Append("}\n");
+   indented_output_stream->Append("}\n");
+   indented_output_stream->Append("fwrite(buffer, 1, k, __bambu_testbench_fp);\n");
+   indented_output_stream->Append("}\n\n");
+   // pointer to memory initialization records conversion function
+   indented_output_stream->Append("void _Ptd2Mem_(FILE * __bambu_testbench_fp, unsigned char * num, unsigned int n_bytes)\n");
+   indented_output_stream->Append("{\n");
+   indented_output_stream->Append("static const char hex_digits[] = \"0123456789abcdef\";\n");
+   indented_output_stream->Append("unsigned int i, j, record_bytes;\n");
+   indented_output_stream->Append("char buffer[" + STR(2 * MEMORY_RECORD_BYTES + 3) + "];\n");
+   indented_output_stream->Append("for (i = 0; i < n_bytes; i = i + record_bytes)\n");
+   indented_output_stream->Append("{\n");
+   indented_output_stream->Append("record_bytes = n_bytes - i < " + STR(MEMORY_RECORD_BYTES) + " ? n_bytes - i : " + STR(MEMORY_RECORD_BYTES) + ";\n");
+   indented_output_stream->Append("buffer[0] = 'M';\n");
+   indented_output_stream->Append("buffer[1] = hex_digits[record_bytes - 1];\n");
+   indented_output_stream->Append("for (j = 0; j < record_bytes; ++j)\n");
+   indented_output_stream->Append("{\n");
+   indented_output_stream->Append("buffer[2 + 2 * j] = hex_digits[num[i + record_bytes - j - 1] >> 4];\n");
+   indented_output_stream->Append("buffer[3 + 2 * j] = hex_digits[num[i + record_bytes - j - 1] & 15];\n");
+   indented_output_stream->Append("}\n");
+   indented_output_stream->Append("buffer[2 + 2 * record_bytes] = '\\n';\n");
+   indented_output_stream->Append("fwrite(buffer, 1, 3 + 2 * record_bytes, __bambu_testbench_fp);\n");
    indented_output_stream->Append("}\n");
    indented_output_stream->Append("}\n\n");
    if(Param->isOption(OPT_discrepancy) and Param->getOption<bool>(OPT_discrepancy))
@@ -922,11 +954,7 @@ void HLSCWriter::WriteSimulatorInitMemory(const unsigned int function_id)
             {
                auto nZeroBytes = splitted.size() * (splitted.at(0).size() / 8);
                printed_bytes += nZeroBytes;
-               indented_output_stream->Append("for (__testbench_index = 0; "
-                                              "__testbench_index < " +
-                                              STR(nZeroBytes) + "; " +
-                                              "++__testbench_index)\n"
-                                              "   fprintf(__bambu_testbench_fp, \"m00000000\\n\");\n");
+               WriteZeroedBytes(nZeroBytes);
             }
             else
             {
@@ -1042,7 +1070,7 @@ void HLSCWriter::WriteSimulatorInitMemory(const unsigned int function_id)
                tail_padding = tail_padding + bits_offset;
                bits_offset = "";
                ++printed_bytes;
-               indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"m" + tail_padding + "\\n\");\n");
+               WriteMemoryBytes(tail_padding);
             }
             if(reserved_mem_bytes > printed_bytes)
             {
@@ -1100,7 +1128,8 @@ void HLSCWriter::WriteMainTestbench()
    indented_output_stream->Append("if (!__bambu_testbench_fp) {\n");
    indented_output_stream->Append("perror(\"can't open file: " + hls_c_backend_information->results_filename + "\");\n");
    indented_output_stream->Append("exit(1);\n");
-   indented_output_stream->Append("}\n\n");
+   indented_output_stream->Append("}\n");
+   indented_output_stream->Append("setvbuf(__bambu_testbench_fp, NULL, _IOFBF, 1 << 20);\n\n");
    // write additional initialization code needed by subclasses
    WriteExtraInitCode();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Written extra init code");
@@ -1171,11 +1200,14 @@ void HLSCWriter::WriteFile(const std::string& file_name)
 
 inline void HLSCWriter::WriteZeroedBytes(const size_t n_bytes)
 {
-   indented_output_stream->Append("for (__testbench_index = 0; "
-                                  "__testbench_index < " +
-                                  STR(n_bytes) + "; " +
-                                  "++__testbench_index)\n"
-                                  "   fprintf(__bambu_testbench_fp, \"m00000000\\n\");\n");
+   if(n_bytes)
+      indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"z" + STR(n_bytes) + "\\n\");\n");
+}
+
+void HLSCWriter::WriteMemoryBytes(const std::string& binary_value)
+{
+   for(const auto& record : TestbenchGenerationBaseStep::print_memory_bytes(binary_value))
+      indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"" + record + "\\n\");\n");
 }
 
 size_t HLSCWriter::WriteBinaryMemoryInit(const std::string& binary_string, const size_t data_bitsize, std::string& bits_offset)
@@ -1188,6 +1220,8 @@ size_t HLSCWriter::WriteBinaryMemoryInit(const std::string& binary_string, const
    }
    else
    {
+      /// the complete bytes, the first one being the least significant
+      std::string memory_bytes;
       std::string local_binary_string;
       size_t local_data_bitsize;
       if(bits_offset.size())
@@ -1195,7 +1229,7 @@ size_t HLSCWriter::WriteBinaryMemoryInit(const std::string& binary_string, const
          if(static_cast<int>(data_bitsize) - 8 + static_cast<int>(bits_offset.size()) >= 0)
          {
             local_data_bitsize = data_bitsize - (8 - bits_offset.size());
-            indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"m" + binary_string.substr(data_bitsize - (8 - bits_offset.size()), 8 - bits_offset.size()) + bits_offset + "\\n\");\n");
+            memory_bytes = binary_string.substr(data_bitsize - (8 - bits_offset.size()), 8 - bits_offset.size()) + bits_offset;
             local_binary_string = binary_string.substr(0, local_data_bitsize);
             bits_offset = "";
             printed_bytes++;
@@ -1215,7 +1249,7 @@ size_t HLSCWriter::WriteBinaryMemoryInit(const std::string& binary_string, const
       {
          if((static_cast<int>(local_data_bitsize) - 8 - static_cast<int>(base_index)) >= 0)
          {
-            indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"m" + local_binary_string.substr(local_data_bitsize - 8 - base_index, 8) + "\\n\");\n");
+            memory_bytes = local_binary_string.substr(local_data_bitsize - 8 - base_index, 8) + memory_bytes;
             printed_bytes++;
          }
          else
@@ -1223,6 +1257,7 @@ size_t HLSCWriter::WriteBinaryMemoryInit(const std::string& binary_string, const
             bits_offset = local_binary_string.substr(0, local_data_bitsize - base_index);
          }
       }
+      WriteMemoryBytes(memory_bytes);
    }
    return printed_bytes;
 }
@@ -1261,12 +1296,7 @@ void HLSCWriter::WriteParamInMemory(const BehavioralHelperConstRef behavioral_he
          if(input)
          {
             const auto byte_size = tree_helper::Size(type) / 8;
-            for(size_t byte = 0; byte < byte_size; byte++)
-            {
-               indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"m\");\n");
-               indented_output_stream->Append("_Ptd2Bin_(__bambu_testbench_fp, ((unsigned char *)&(" + param + ")) + " + STR(byte) + ", 8);\n");
-               indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"\\n\");\n");
-            }
+            indented_output_stream->Append("_Ptd2Mem_(__bambu_testbench_fp, (unsigned char *)&(" + param + "), " + STR(byte_size) + ");\n");
          }
          else
          {
@@ -1280,11 +1310,18 @@ void HLSCWriter::WriteParamInMemory(const BehavioralHelperConstRef behavioral_he
       {
          indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"//expected value for output: " + param + "\\n\");\n");
          const auto byte_size = tree_helper::Size(type) / 8;
-         for(size_t byte = 0; byte < byte_size; byte++)
+         if(input)
          {
-            indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"" + std::string(input ? "m" : "o") + "\");\n");
-            indented_output_stream->Append("_Ptd2Bin_(__bambu_testbench_fp, ((unsigned char *)&(" + param + ")) + " + STR(byte) + ", 8);\n");
-            indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"\\n\");\n");
+            indented_output_stream->Append("_Ptd2Mem_(__bambu_testbench_fp, (unsigned char *)&(" + param + "), " + STR(byte_size) + ");\n");
+         }
+         else
+         {
+            for(size_t byte = 0; byte < byte_size; byte++)
+            {
+               indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"o\");\n");
+               indented_output_stream->Append("_Ptd2Bin_(__bambu_testbench_fp, ((unsigned char *)&(" + param + ")) + " + STR(byte) + ", 8);\n");
+               indented_output_stream->Append("fprintf(__bambu_testbench_fp, \"\\n\");\n");
+            }
          }
          break;
       }
@@ -70,6 +70,14 @@ class HLSCWriter : public CWriter
     */
    inline void WriteZeroedBytes(const size_t n_bytes);
 
+   /**
+    * Write printf statements to write a sequence of bytes for the memory
+    * initialization of the HDL simulator
+    * @param [in] binary_value is the binary string of the bytes; the least
+    * significant byte is the one with the lowest address
+    */
+   void WriteMemoryBytes(const std::string& binary_value);
+
    /**
     * Takes a binary string and writes in the C file a series of statements
     * used to print the equivalent memory initialization data for the HDL
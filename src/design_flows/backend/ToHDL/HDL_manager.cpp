@@ -85,6 +85,9 @@
 /// HLS include
 #include "hls_manager.hpp"
 
+/// HLS/stg include
+#include "state_transition_graph_manager.hpp"
+
 /// STL include
 #include "custom_map.hpp"
 #include "custom_set.hpp"
@@ -967,6 +970,72 @@ void HDL_manager::write_behavioral(const language_writerRef writer, const struct
    }
 }
 
+FsmEncoding HDL_manager::select_fsm_encoding(const structural_objectRef& cir, const std::list<std::string>& list_of_states, std::vector<std::string>::const_iterator first, std::vector<std::string>::const_iterator end) const
+{
+   const auto fsm_encoding = parameters->getOption<std::string>(OPT_fsm_encoding);
+   if(fsm_encoding == "one-hot")
+      return FsmEncoding::ONE_HOT;
+   if(fsm_encoding == "gray")
+      return FsmEncoding::GRAY;
+   if(fsm_encoding == "binary")
+      return FsmEncoding::BINARY;
+   std::string vendor;
+   if(device->has_parameter("vendor"))
+   {
+      vendor = device->get_parameter<std::string>("vendor");
+      boost::algorithm::to_lower(vendor);
+   }
+   const auto n_states = list_of_states.size();
+   if(vendor == "xilinx" && n_states < 256)
+      return FsmEncoding::ONE_HOT;
+   /// the tools decoding the present state only know the legacy choice
+   const bool observed_state = cir->find_member(PRESENT_STATE_PORT_NAME, port_o_K, cir).get() != nullptr or (parameters->isOption(OPT_discrepancy) and parameters->getOption<bool>(OPT_discrepancy)) or
+                               (parameters->isOption(OPT_discrepancy_hw) and parameters->getOption<bool>(OPT_discrepancy_hw));
+   if(observed_state or n_states < 3)
+      return FsmEncoding::BINARY;
+
+   /// fan-in of each state and number of transitions to the state with the next identifier
+   typedef boost::tokenizer<boost::char_separator<char>> tokenizer;
+   boost::char_separator<char> state_sep(":", nullptr);
+   boost::char_separator<char> sep(" ", nullptr);
+   CustomMap<std::string, size_t> fan_in;
+   size_t n_transitions = 0;
+   size_t sequential_transitions = 0;
+   for(auto it = first; it != end; ++it)
+   {
+      tokenizer state_tokens(*it, state_sep);
+      auto transition = state_tokens.begin();
+      if(transition == state_tokens.end())
+         continue;
+      tokenizer source_tokens(*transition, sep);
+      const auto source = *source_tokens.begin();
+      for(++transition; transition != state_tokens.end(); ++transition)
+      {
+         tokenizer transition_tokens(*transition, sep);
+         /// the condition inputs are present only when the controller has inputs: the next state is always followed by the outputs
+         const std::vector<std::string> tokens(transition_tokens.begin(), transition_tokens.end());
+         THROW_ASSERT(tokens.size() >= 2, "Wrong fsm description: " + *transition);
+         const auto& target = tokens[tokens.size() - 2];
+         ++n_transitions;
+         if(target == source)
+            continue;
+         ++fan_in[target];
+         if(boost::lexical_cast<unsigned int>(target.substr(strlen(STATE_NAME_PREFIX))) == boost::lexical_cast<unsigned int>(source.substr(strlen(STATE_NAME_PREFIX))) + 1)
+            ++sequential_transitions;
+      }
+   }
+   size_t max_fan_in = 0;
+   for(const auto& state_fan_in : fan_in)
+      max_fan_in = std::max(max_fan_in, state_fan_in.second);
+   /// each next state bit of a one-hot machine is the OR of the incoming transitions
+   if(n_states <= 32 and max_fan_in <= 4)
+      return FsmEncoding::ONE_HOT;
+   /// consecutive states differ in a single bit of a Gray code
+   if(3 * sequential_transitions >= 2 * n_transitions)
+      return FsmEncoding::GRAY;
+   return FsmEncoding::BINARY;
+}
+
 void HDL_manager::write_fsm(const language_writerRef writer, const structural_objectRef& cir, const std::string& fsm_desc_i) const
 {
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Start writing the FSM...");
@@ -1015,19 +1084,7 @@ void HDL_manager::write_fsm(const language_writerRef writer, const structural_ob
    THROW_ASSERT(reset_state == *(list_of_states.begin()), "reset state and first state has to be the same " + reset_state + " : " + fsm_desc);
 
    /// write state declaration.
-   std::string vendor;
-   if(device->has_parameter("vendor"))
-   {
-      vendor = device->get_parameter<std::string>("vendor");
-      boost::algorithm::to_lower(vendor);
-   }
-   bool one_hot_encoding = false;
-   if(parameters->getOption<std::string>(OPT_fsm_encoding) == "one-hot")
-      one_hot_encoding = true;
-   else if(parameters->getOption<std::string>(OPT_fsm_encoding) == "auto" && vendor == "xilinx" && list_of_states.size() < 256)
-      one_hot_encoding = true;
-
-   writer->write_state_declaration(cir, list_of_states, reset_port, reset_state, one_hot_encoding);
+   writer->write_state_declaration(cir, list_of_states, reset_port, reset_state, select_fsm_encoding(cir, list_of_states, first, end));
 
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "write module_instantiation begin");
    // write module_instantiation begin
@@ -70,6 +70,7 @@ REF_FORWARD_DECL(flopoco_wrapper);
 REF_FORWARD_DECL(structural_manager);
 CONSTREF_FORWARD_DECL(technology_manager);
 CONSTREF_FORWARD_DECL(Parameter);
+enum class FsmEncoding;
 enum class HDLWriter_Language;
 //@}
 
@@ -146,6 +147,18 @@ class HDL_manager
     */
    bool is_fsm(const structural_objectRef& cir) const;
 
+   /**
+    * Selects the encoding of the states of a finite state machine according to --fsm-encoding.
+    * In auto mode the choice depends on the target device, on the number of states and on the transitions:
+    * one-hot is used for small machines with low fan-in, Gray for machines mostly moving between consecutive states.
+    * The legacy choice is kept when the present state is observed outside the controller (e.g., discrepancy analysis).
+    * @param cir is the module.
+    * @param list_of_states is the list of the states.
+    * @param first is the description of the first state.
+    * @param end is the end of the description of the states.
+    */
+   FsmEncoding select_fsm_encoding(const structural_objectRef& cir, const std::list<std::string>& list_of_states, std::vector<std::string>::const_iterator first, std::vector<std::string>::const_iterator end) const;
+
    /**
     * Writes a mealy/moore finite state machine behavioral description.
     * @param writer is the chosen language writer object.
@@ -87,6 +87,14 @@ enum class HDLWriter_Language
    VHDL
 };
 
+/// encoding of the states of the finite state machines
+enum class FsmEncoding
+{
+   BINARY = 0,
+   GRAY,
+   ONE_HOT
+};
+
 /**
  * HDL writer base class used to specify the interface of the different language writers
  */
@@ -101,6 +109,16 @@ class language_writer
       return res;
    }
 
+   /**
+    * Return the code of a state in the given encoding (one-hot codes are not handled)
+    * @param encoding is the encoding of the states
+    * @param val is the identifier of the state
+    */
+   inline unsigned int encode_state(FsmEncoding encoding, unsigned int val) const
+   {
+      return encoding == FsmEncoding::GRAY ? val ^ (val >> 1) : val;
+   }
+
    /// Represents the stream we are currently writing to
    const IndentedOutputStreamRef indented_output_stream;
 
@@ -263,8 +281,9 @@ class language_writer
    /**
     * write the declaration of all the states of the finite state machine.
     * @param list_of_states is the list of all the states.
+    * @param encoding is the encoding of the states
     */
-   virtual void write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string& reset_port, const std::string& reset_state, bool one_hot) = 0;
+   virtual void write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string& reset_port, const std::string& reset_state, FsmEncoding encoding) = 0;
    /**
     * write the present_state update process
     * @param reset_state is the reset state.
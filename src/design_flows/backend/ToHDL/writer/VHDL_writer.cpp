@@ -1125,8 +1125,9 @@ void VHDL_writer::write_tail(const structural_objectRef&)
 {
 }
 
-void VHDL_writer::write_state_declaration(const structural_objectRef&, const std::list<std::string>& list_of_states, const std::string&, const std::string&, bool one_hot)
+void VHDL_writer::write_state_declaration(const structural_objectRef&, const std::list<std::string>& list_of_states, const std::string&, const std::string&, FsmEncoding encoding)
 {
+   const bool one_hot = encoding == FsmEncoding::ONE_HOT;
    auto it_end = list_of_states.end();
    size_t n_states = list_of_states.size();
    unsigned int bitsnumber = language_writer::bitnumber(static_cast<unsigned int>(n_states - 1));
@@ -1140,14 +1141,14 @@ void VHDL_writer::write_state_declaration(const structural_objectRef&, const std
       bitsnumber = language_writer::bitnumber(max_value);
 
    write_comment("define the states of FSM model\n");
-   if(one_hot or ((parameters->isOption(OPT_generate_vcd) and parameters->getOption<bool>(OPT_generate_vcd)) or (parameters->isOption(OPT_discrepancy) and parameters->getOption<bool>(OPT_discrepancy))))
+   if(encoding != FsmEncoding::BINARY or ((parameters->isOption(OPT_generate_vcd) and parameters->getOption<bool>(OPT_generate_vcd)) or (parameters->isOption(OPT_discrepancy) and parameters->getOption<bool>(OPT_discrepancy))))
    {
       for(const auto& state : list_of_states)
       {
          if(one_hot)
             indented_output_stream->Append("constant " + state + ": std_logic_vector(" + STR(max_value) + " downto 0) := \"" + encode_one_hot(1 + max_value, boost::lexical_cast<unsigned int>(state.substr(strlen(STATE_NAME_PREFIX)))) + "\";\n");
          else
-            indented_output_stream->Append("constant " + state + ": std_logic_vector(" + STR(bitsnumber - 1) + " downto 0) := \"" + NumberToBinaryString(boost::lexical_cast<size_t>(state.substr(strlen(STATE_NAME_PREFIX))), bitsnumber) + "\";\n");
+            indented_output_stream->Append("constant " + state + ": std_logic_vector(" + STR(bitsnumber - 1) + " downto 0) := \"" + NumberToBinaryString(encode_state(encoding, boost::lexical_cast<unsigned int>(state.substr(strlen(STATE_NAME_PREFIX)))), bitsnumber) + "\";\n");
       }
       if(one_hot)
          indented_output_stream->Append("signal present_state, next_state : std_logic_vector(" + STR(max_value) + " downto 0);\n");
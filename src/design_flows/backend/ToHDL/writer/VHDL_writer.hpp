@@ -189,7 +189,7 @@ struct VHDL_writer : public language_writer
     * write the declaration of all the states of the finite state machine.
     * @param list_of_states is the list of all the states.
     */
-   void write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string& reset_port, const std::string& reset_state, bool one_hot) override;
+   void write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string& reset_port, const std::string& reset_state, FsmEncoding encoding) override;
    /**
     * write the present_state update process
     * @param reset_state is the reset state.
@@ -1005,8 +1005,9 @@ void verilog_writer::write_tail(const structural_objectRef&)
 {
 }
 
-void verilog_writer::write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string&, const std::string& /*reset_state*/, bool one_hot)
+void verilog_writer::write_state_declaration(const structural_objectRef& cir, const std::list<std::string>& list_of_states, const std::string&, const std::string& /*reset_state*/, FsmEncoding encoding)
 {
+   const bool one_hot = encoding == FsmEncoding::ONE_HOT;
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Starting state declaration...");
 
    auto it_end = list_of_states.end();
@@ -1030,7 +1031,7 @@ void verilog_writer::write_state_declaration(const structural_objectRef& cir, co
       if(one_hot)
          indented_output_stream->Append(*it + " = " + boost::lexical_cast<std::string>(max_value + 1) + "'b" + encode_one_hot(1 + max_value, boost::lexical_cast<unsigned int>(it->substr(strlen(STATE_NAME_PREFIX)))));
       else
-         indented_output_stream->Append(*it + " = " + boost::lexical_cast<std::string>(bitsnumber) + "'d" + boost::lexical_cast<std::string>(it->substr(strlen(STATE_NAME_PREFIX))));
+         indented_output_stream->Append(*it + " = " + boost::lexical_cast<std::string>(bitsnumber) + "'d" + STR(encode_state(encoding, boost::lexical_cast<unsigned int>(it->substr(strlen(STATE_NAME_PREFIX))))));
       count++;
       if(count == n_states)
          ;
@@ -433,7 +433,7 @@ void FunctionalUnitStep::AnalyzeFu(const technology_nodeRef f_unit)
                         tn = create_template_instance(fun_unit, fu_name, device, prec);
                         fu = GetPointer<functional_unit>(tn);
                         fu->fu_template_parameters = template_parameters;
-                        TM->get_library_manager(LM)->add(tn);
+                        TM->add(tn, LM);
                      }
                      else
                         fu = GetPointer<functional_unit>(tn);
@@ -48,6 +48,9 @@
 // include from src/
 #include "Parameter.hpp"
 
+// include from src/algorithms/graph_helpers/
+#include "cyclic_topological_sort.hpp"
+
 // include from src/behavior/
 #include "call_graph.hpp"
 #include "call_graph_manager.hpp"
@@ -73,8 +76,10 @@
 #include "tree_reindex.hpp"
 
 /// STD include
+#include <list>
 #include <string>
 #include <utility>
+#include <vector>
 
 BitValueIPA::BitValueIPA(const application_managerRef AM, const DesignFlowManagerConstRef dfm, const ParameterConstRef par)
     : ApplicationFrontendFlowStep(AM, BIT_VALUE_IPA, dfm, par), BitLatticeManipulator(AM->get_tree_manager(), parameters->get_class_debug_level(GET_CLASS(*this)))
@@ -169,9 +174,40 @@ DesignFlowStep_Status BitValueIPA::Exec()
          return DesignFlowStep_Status::UNCHANGED;
    }
 
+   /*
+    * The summary of a function (i.e., the bit values of its parameters and of its return value) depends only on its body and on the call points in its callers.
+    * Hence, it has to be recomputed only if the function or one of its callers has been modified since the last execution of this step
+    */
+   CustomUnorderedSet<unsigned int> changed_fun_ids;
+   for(const auto fu_id : reached_body_fun_ids)
+   {
+      const FunctionBehaviorConstRef FB = AppM->CGetFunctionBehavior(fu_id);
+      const auto bitvalue_ver_it = last_bitvalue_ver.find(fu_id);
+      const auto bb_ver_it = last_bb_ver.find(fu_id);
+      if(bitvalue_ver_it == last_bitvalue_ver.end() or bitvalue_ver_it->second != FB->GetBitValueVersion() or bb_ver_it == last_bb_ver.end() or bb_ver_it->second != FB->GetBBVersion())
+         changed_fun_ids.insert(fu_id);
+   }
+
+   /// the functions are analyzed top-down (callers before callees); possible cycles are broken by the depth first visit
+   std::list<vertex> sorted_fun_vertices;
+   cyclic_topological_sort(*subgraph, std::front_inserter(sorted_fun_vertices));
+   std::vector<unsigned int> analyzed_fun_ids;
+   for(const auto fu_cgv : sorted_fun_vertices)
+   {
+      const unsigned int fu_id = CGMan->get_function(fu_cgv);
+      bool to_be_analyzed = changed_fun_ids.find(fu_id) != changed_fun_ids.end();
+      InEdgeIterator ie_it, ie_end;
+      for(boost::tie(ie_it, ie_end) = boost::in_edges(fu_cgv, *subgraph); ie_it != ie_end and not to_be_analyzed; ie_it++)
+         to_be_analyzed = changed_fun_ids.find(CGMan->get_function(boost::source(*ie_it, *subgraph))) != changed_fun_ids.end();
+      if(to_be_analyzed)
+         analyzed_fun_ids.push_back(fu_id);
+      else
+         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Summary of function " + AppM->CGetFunctionBehavior(fu_id)->CGetBehavioralHelper()->get_function_name() + " is still valid");
+   }
+
    // ---- initialization phase ----
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Initialize data structures");
-   for(unsigned int fu_id : reached_body_fun_ids)
+   for(unsigned int fu_id : analyzed_fun_ids)
    {
       const std::string fu_name = AppM->CGetFunctionBehavior(fu_id)->CGetBehavioralHelper()->get_function_name();
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Analyzing function \"" + fu_name + "\": id = " + STR(fu_id));
@@ -262,7 +298,7 @@ DesignFlowStep_Status BitValueIPA::Exec()
 
    // ---- propagation phase ----
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Start BitValueIPA propagation");
-   for(unsigned int fu_id : reached_body_fun_ids)
+   for(unsigned int fu_id : analyzed_fun_ids)
    {
       const std::string fu_name = AppM->CGetFunctionBehavior(fu_id)->CGetBehavioralHelper()->get_function_name();
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Analyzing function \"" + fu_name + "\": id = " + STR(fu_id));
@@ -795,6 +831,7 @@ DesignFlowStep_Status BitValueIPA::Exec()
 
    // ---- update bivalues on IR ----
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Updating IR");
+   CustomOrderedSet<unsigned int> changed_summaries;
    for(const auto& b : best)
    {
       const unsigned int tn_id = b.first;
@@ -858,28 +895,32 @@ DesignFlowStep_Status BitValueIPA::Exec()
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---updated best id: " + STR(tn_id) + " bitstring: " + *old_bitvalue);
 
       if(restart)
+         changed_summaries.insert(restart_fun_id);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Updated IR");
+
+   /// only the functions whose summary changed and their direct callers have to be analyzed again by the intra procedural step
+   for(const auto restart_fun_id : changed_summaries)
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "restart function " + AppM->CGetFunctionBehavior(restart_fun_id)->CGetBehavioralHelper()->get_function_name());
+      fun_id_to_restart.insert(restart_fun_id);
+      const vertex fu_cgv = CGMan->GetVertex(restart_fun_id);
+      InEdgeIterator ie_it, ie_end;
+      boost::tie(ie_it, ie_end) = boost::in_edges(fu_cgv, *cg);
+      for(; ie_it != ie_end; ie_it++)
       {
-         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "restart function " + AppM->CGetFunctionBehavior(restart_fun_id)->CGetBehavioralHelper()->get_function_name());
-         fun_id_to_restart.insert(restart_fun_id);
-         const vertex fu_cgv = CGMan->GetVertex(restart_fun_id);
-         InEdgeIterator ie_it, ie_end;
-         boost::tie(ie_it, ie_end) = boost::in_edges(fu_cgv, *cg);
-         for(; ie_it != ie_end; ie_it++)
+         const unsigned int caller_id = CGMan->get_function(boost::source(*ie_it, *cg));
+         const auto tmp_it = reached_body_fun_ids.find(caller_id);
+         if(tmp_it == reached_body_fun_ids.cend())
+            continue;
+         const FunctionEdgeInfoConstRef call_edge_info = cg->CGetFunctionEdgeInfo(*ie_it);
+         if(not call_edge_info->direct_call_points.empty())
          {
-            const unsigned int caller_id = CGMan->get_function(boost::source(*ie_it, *cg));
-            const auto tmp_it = reached_body_fun_ids.find(caller_id);
-            if(tmp_it == reached_body_fun_ids.cend())
-               continue;
-            const FunctionEdgeInfoConstRef call_edge_info = cg->CGetFunctionEdgeInfo(*ie_it);
-            if(not call_edge_info->direct_call_points.empty())
-            {
-               INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "restart caller " + AppM->CGetFunctionBehavior(caller_id)->CGetBehavioralHelper()->get_function_name());
-               fun_id_to_restart.insert(caller_id);
-            }
+            INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "restart caller " + AppM->CGetFunctionBehavior(caller_id)->CGetBehavioralHelper()->get_function_name());
+            fun_id_to_restart.insert(caller_id);
          }
       }
    }
-   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Updated IR");
 
    BitLatticeManipulator::clear();
 
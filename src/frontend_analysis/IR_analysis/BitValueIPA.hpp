@@ -65,8 +65,10 @@ class BitValueIPA : public ApplicationFrontendFlowStep, public BitLatticeManipul
     */
    CustomOrderedSet<unsigned int> fun_id_to_restart;
 
+   /// the bit value version of each function at the last execution; functions whose version is unchanged (and whose callers are unchanged) keep their summary
    std::map<unsigned int, unsigned int> last_bitvalue_ver;
 
+   /// the basic block version of each function at the last execution
    std::map<unsigned int, unsigned int> last_bb_ver;
 
    const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
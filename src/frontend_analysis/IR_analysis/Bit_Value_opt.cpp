@@ -115,6 +115,11 @@ const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::Funct
          }
          else
             relationships.insert(std::make_pair(BIT_VALUE, SAME_FUNCTION));
+         /// the ranges of the variables are disabled with --panda-parameter=range-analysis=0
+         if(not parameters->IsParameter("range-analysis") or parameters->GetParameter<int>("range-analysis") != 0)
+         {
+            relationships.insert(std::make_pair(RANGE_ANALYSIS, SAME_FUNCTION));
+         }
          relationships.insert(std::make_pair(FUNCTION_CALL_TYPE_CLEANUP, SAME_FUNCTION));
          relationships.insert(std::make_pair(COMPLETE_CALL_GRAPH, WHOLE_APPLICATION));
          break;
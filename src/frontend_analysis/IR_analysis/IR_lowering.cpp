@@ -51,6 +51,7 @@
 
 #include "Parameter.hpp"                    // for Parameter
 #include "application_manager.hpp"          // for application_manager, app...
+#include "clb_model.hpp"                    // for clb_model
 #include "custom_map.hpp"                   // for unordered_map, operator!=
 #include "dbgPrintHelper.hpp"               // for DEBUG_LEVEL_VERY_PEDANTIC
 #include "design_flow_graph.hpp"            // for DesignFlowGraph, DesignF...
@@ -75,6 +76,7 @@
 #include "tree_manipulation.hpp"            // for tree_manipulation, Param...
 #include "tree_node.hpp"                    // for tree_nodeRef, gimple_assign
 #include "tree_reindex.hpp"
+#include <algorithm> // for find_if, max_element
 #include <cmath>   // for ceil
 #include <cstddef> // for size_t
 #include <limits>
@@ -93,11 +95,13 @@ const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::Funct
    {
       case(DEPENDENCE_RELATIONSHIP):
       {
+         relationships.insert(std::make_pair(ARRAY_PARTITIONING, SAME_FUNCTION));
          relationships.insert(std::make_pair(BLOCK_FIX, SAME_FUNCTION));
          relationships.insert(std::make_pair(SWITCH_FIX, SAME_FUNCTION));
          relationships.insert(std::make_pair(FIX_STRUCTS_PASSED_BY_VALUE, SAME_FUNCTION));
          relationships.insert(std::make_pair(REMOVE_CLOBBER_GA, SAME_FUNCTION));
          relationships.insert(std::make_pair(HWCALL_INJECTION, SAME_FUNCTION));
+         relationships.insert(std::make_pair(UNROLL_LOOPS, SAME_FUNCTION));
          break;
       }
       case(INVALIDATION_RELATIONSHIP):
@@ -154,6 +158,9 @@ void IR_lowering::ComputeRelationships(DesignFlowStepSet& relationship, const De
 
 /// the code for lowering of div, mult and rem comes from GCC sources (expmed.c)
 
+/// Number of adders worth a DSP when a multiple constant multiplication replaces the multipliers
+#define MCM_ADDERS_PER_DSP 4
+
 enum alg_code
 {
    alg_unknown,
@@ -1052,7 +1059,6 @@ tree_nodeRef IR_lowering::expand_sdiv_pow2(tree_nodeRef op0, unsigned long long
 tree_nodeRef IR_lowering::expand_MC(tree_nodeRef op0, integer_cst* ic_node, tree_nodeRef old_target, const tree_nodeRef stmt, const blocRef block, tree_nodeRef& type_expr, const std::string& srcp_default)
 {
    long long int ext_op1 = tree_helper::get_integer_cst_value(ic_node);
-   short int mult_plus_ratio = 3;
    unsigned int data_bitsize = tree_helper::Size(GET_NODE(op0));
    unsigned int typeSize = tree_helper::Size(type_expr);
    if(typeSize < 64)
@@ -1060,29 +1066,9 @@ tree_nodeRef IR_lowering::expand_MC(tree_nodeRef op0, integer_cst* ic_node, tree
       ext_op1 <<= 64 - typeSize;
       ext_op1 >>= 64 - typeSize;
    }
-#if HAVE_BAMBU_BUILT
-   if(GetPointer<HLS_manager>(AppM))
-   {
-      const HLS_targetRef HLS_T = GetPointer<HLS_manager>(AppM)->get_HLS_target();
-      const technology_managerRef TechManager = HLS_T->get_technology_manager();
-      unsigned int fu_prec = resize_to_1_8_16_32_64_128_256_512(data_bitsize);
-      if(fu_prec == 1)
-      {
-         fu_prec = 8;
-      }
-      technology_nodeRef mult_f_unit = TechManager->get_fu(MULTIPLIER_STD + std::string("_") + STR(fu_prec) + "_" + STR(fu_prec) + "_" + STR(fu_prec) + "_0", LIBRARY_STD_FU);
-      auto* mult_fu = GetPointer<functional_unit>(mult_f_unit);
-      technology_nodeRef mult_op_node = mult_fu->get_operation("mult_expr");
-      auto* mult_op = GetPointer<operation>(mult_op_node);
-      double mult_delay = mult_op->time_m->get_execution_time();
-      technology_nodeRef add_f_unit = TechManager->get_fu(ADDER_STD + std::string("_") + STR(fu_prec) + "_" + STR(fu_prec) + "_" + STR(fu_prec), LIBRARY_STD_FU);
-      auto* add_fu = GetPointer<functional_unit>(add_f_unit);
-      technology_nodeRef add_op_node = add_fu->get_operation("plus_expr");
-      auto* add_op = GetPointer<operation>(add_op_node);
-      double add_delay = add_op->time_m->get_execution_time();
-      mult_plus_ratio = static_cast<short int>(ceil(mult_delay / add_delay));
-   }
-#endif
+   double mult_delay, add_delay, mult_DSPs;
+   compute_mult_costs(data_bitsize, mult_delay, add_delay, mult_DSPs);
+   auto mult_plus_ratio = static_cast<short int>(ceil(mult_delay / add_delay));
 
    /// very special case op1 == 0
    if(ext_op1 == 0)
@@ -1145,6 +1131,371 @@ tree_nodeRef IR_lowering::expand_MC(tree_nodeRef op0, integer_cst* ic_node, tree
    }
 }
 
+void IR_lowering::compute_mult_costs(unsigned int
+#if HAVE_BAMBU_BUILT
+                                         data_bitsize
+#endif
+                                     , double& mult_delay, double& add_delay, double& mult_DSPs) const
+{
+   /// default ratio between the delay of a multiplier and the one of an adder
+   mult_delay = 3.0;
+   add_delay = 1.0;
+   mult_DSPs = 0.0;
+#if HAVE_BAMBU_BUILT
+   if(GetPointer<HLS_manager>(AppM))
+   {
+      const HLS_targetRef HLS_T = GetPointer<HLS_manager>(AppM)->get_HLS_target();
+      const technology_managerRef TechManager = HLS_T->get_technology_manager();
+      unsigned int fu_prec = resize_to_1_8_16_32_64_128_256_512(data_bitsize);
+      if(fu_prec == 1)
+      {
+         fu_prec = 8;
+      }
+      technology_nodeRef mult_f_unit = TechManager->get_fu(MULTIPLIER_STD + std::string("_") + STR(fu_prec) + "_" + STR(fu_prec) + "_" + STR(fu_prec) + "_0", LIBRARY_STD_FU);
+      auto* mult_fu = GetPointer<functional_unit>(mult_f_unit);
+      technology_nodeRef mult_op_node = mult_fu->get_operation("mult_expr");
+      auto* mult_op = GetPointer<operation>(mult_op_node);
+      mult_delay = mult_op->time_m->get_execution_time();
+      /// same information returned by AllocationInformation::get_DSPs, which is not available yet
+      if(mult_fu->area_m and GetPointer<clb_model>(mult_fu->area_m))
+      {
+         mult_DSPs = GetPointer<clb_model>(mult_fu->area_m)->get_resource_value(clb_model::DSP);
+      }
+      technology_nodeRef add_f_unit = TechManager->get_fu(ADDER_STD + std::string("_") + STR(fu_prec) + "_" + STR(fu_prec) + "_" + STR(fu_prec), LIBRARY_STD_FU);
+      auto* add_fu = GetPointer<functional_unit>(add_f_unit);
+      technology_nodeRef add_op_node = add_fu->get_operation("plus_expr");
+      auto* add_op = GetPointer<operation>(add_op_node);
+      add_delay = add_op->time_m->get_execution_time();
+   }
+#endif
+}
+
+/** This structure describes a vertex of an adder graph computing
+   the product of the multiplicand by an odd positive fundamental.
+   Vertex 0 is the multiplicand itself; the other ones are computed as
+   (first << shift) + second, (first << shift) - second or
+   second - (first << shift), depending on the sign fields.  */
+struct mcm_node
+{
+   unsigned long long int value; /** The fundamental.  */
+   size_t first;                 /** The vertex which is shifted.  */
+   size_t second;                /** The other vertex.  */
+   int shift;                    /** The left shift applied to first.  */
+   bool subtract;                /** True if the two terms are subtracted.  */
+   bool reversed;                /** True if the shifted term is the subtrahend.  */
+   unsigned int depth;           /** The number of adders on the longest path from the multiplicand.  */
+};
+
+/** Return the vertex computing VALUE with a single adder from the
+   vertices of GRAPH, choosing the one with the minimum depth.  The
+   fundamentals are bounded by 2^LIMIT_LOG.  Return false if VALUE is
+   not reachable with a single adder.  */
+static bool mcm_reach(const std::vector<struct mcm_node>& graph, unsigned long long int value, int limit_log, struct mcm_node& node)
+{
+   bool found = false;
+   for(size_t first = 0; first < graph.size(); ++first)
+   {
+      for(size_t second = 0; second < graph.size(); ++second)
+      {
+         const auto depth = std::max(graph[first].depth, graph[second].depth) + 1;
+         if(found and depth >= node.depth)
+         {
+            continue;
+         }
+         const auto first_value = graph[first].value;
+         const auto second_value = graph[second].value;
+         for(int shift = 1; shift <= limit_log and first_value <= (1ULL << limit_log) >> shift; ++shift)
+         {
+            const auto shifted = first_value << shift;
+            const bool is_add = shifted + second_value == value;
+            const bool is_sub = shifted > second_value and shifted - second_value == value;
+            const bool is_rev = second_value > shifted and second_value - shifted == value;
+            if(is_add or is_sub or is_rev)
+            {
+               node = {value, first, second, shift, not is_add, is_rev, depth};
+               found = true;
+               break;
+            }
+         }
+      }
+   }
+   return found;
+}
+
+/** Build an adder graph computing all the odd fundamentals in TARGETS
+   with the RAG-n algorithm: the targets reachable with a single adder
+   from the already computed fundamentals are added first; when none is,
+   the cheapest remaining target (the one with fewest nonzero digits in
+   its canonical signed digit form) is approached by adding the first of
+   its canonical signed digit partial sums not yet in the graph.
+   Return false if more than MAX_ADDERS adders would be needed.  */
+static bool synth_mcm(std::vector<unsigned long long int> targets, unsigned int data_bitsize, size_t max_adders, std::vector<struct mcm_node>& graph)
+{
+   const int limit_log = static_cast<int>(std::min(data_bitsize + 1, 62u));
+   graph.clear();
+   graph.push_back({1, 0, 0, 0, false, false, 0});
+   const auto in_graph = [&](unsigned long long int value) -> bool { return std::find_if(graph.begin(), graph.end(), [&](const struct mcm_node& n) { return n.value == value; }) != graph.end(); };
+   targets.erase(std::remove_if(targets.begin(), targets.end(), [&](unsigned long long int t) { return in_graph(t); }), targets.end());
+   while(not targets.empty())
+   {
+      if(graph.size() - 1 >= max_adders)
+      {
+         return false;
+      }
+      bool progress = false;
+      for(auto target = targets.begin(); target != targets.end();)
+      {
+         struct mcm_node node;
+         if(mcm_reach(graph, *target, limit_log, node))
+         {
+            graph.push_back(node);
+            target = targets.erase(target);
+            progress = true;
+         }
+         else
+         {
+            ++target;
+         }
+      }
+      if(progress)
+      {
+         continue;
+      }
+      /// canonical signed digit form of the remaining targets, from the least significant digit
+      std::vector<int> best_csd;
+      size_t best_nonzero = std::numeric_limits<size_t>::max();
+      for(const auto target : targets)
+      {
+         std::vector<int> csd;
+         size_t nonzero = 0;
+         unsigned long long int residual = target;
+         while(residual)
+         {
+            int digit = 0;
+            if(residual & 1)
+            {
+               digit = (residual & 3) == 3 ? -1 : 1;
+               residual = digit == 1 ? residual - 1 : residual + 1;
+               ++nonzero;
+            }
+            csd.push_back(digit);
+            residual >>= 1;
+         }
+         if(nonzero < best_nonzero)
+         {
+            best_nonzero = nonzero;
+            best_csd = csd;
+         }
+      }
+      /// partial sums starting from the most significant digit; each one is one adder away from the previous one
+      unsigned long long int partial = 0;
+      int gap = 0;
+      for(auto digit = best_csd.rbegin(); digit != best_csd.rend(); ++digit)
+      {
+         ++gap;
+         if(*digit == 0)
+         {
+            continue;
+         }
+         if(partial == 0)
+         {
+            partial = 1;
+         }
+         else
+         {
+            partial = *digit > 0 ? (partial << gap) + 1 : (partial << gap) - 1;
+            if(not in_graph(partial))
+            {
+               struct mcm_node node;
+               const auto reached = mcm_reach(graph, partial, limit_log, node);
+               THROW_ASSERT(reached, "partial sum " + STR(partial) + " not reachable");
+               if(not reached)
+               {
+                  return false;
+               }
+               graph.push_back(node);
+               break;
+            }
+         }
+         gap = 0;
+      }
+   }
+   return graph.size() - 1 <= max_adders;
+}
+
+void IR_lowering::expand_MCM(const blocRef block)
+{
+   if(parameters->IsParameter("mcm") and parameters->GetParameter<int>("mcm") == 0)
+   {
+      return;
+   }
+   /// A multiplication by a constant which is not a power of two
+   struct const_mult
+   {
+      tree_nodeRef stmt;
+      unsigned long long int fundamental;
+      int shift;
+      bool negative;
+   };
+   /// the multiplications grouped by multiplicand and type, in order of appearance
+   std::vector<std::pair<std::pair<unsigned int, unsigned int>, std::vector<const_mult>>> groups;
+   CustomUnorderedMap<std::pair<unsigned int, unsigned int>, size_t> group_positions;
+   for(const auto& stmt : block->CGetStmtList())
+   {
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+      if(not ga or GET_NODE(ga->op1)->get_kind() != mult_expr_K)
+      {
+         continue;
+      }
+      const auto me = GetPointer<const mult_expr>(GET_NODE(ga->op1));
+      if(GET_NODE(me->op0)->get_kind() != ssa_name_K or GET_NODE(me->op1)->get_kind() != integer_cst_K or tree_helper::is_real(TM, GET_INDEX_NODE(me->type)) or
+         tree_helper::get_type_index(TM, GET_INDEX_NODE(me->op0)) != GET_INDEX_NODE(me->type))
+      {
+         continue;
+      }
+      const auto type_size = tree_helper::Size(GET_NODE(me->type));
+      if(type_size > 64)
+      {
+         continue;
+      }
+      auto value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(me->op1)));
+      if(type_size < 64)
+      {
+         value <<= 64 - type_size;
+         value >>= 64 - type_size;
+      }
+      if(value == std::numeric_limits<long long int>::min())
+      {
+         continue;
+      }
+      const auto magnitude = static_cast<unsigned long long int>(value < 0 ? -value : value);
+      if(EXACT_POWER_OF_2_OR_ZERO_P(magnitude))
+      {
+         continue;
+      }
+      const auto shift = __builtin_ctzll(magnitude);
+      const auto key = std::make_pair(GET_INDEX_NODE(me->op0), GET_INDEX_NODE(me->type));
+      if(group_positions.find(key) == group_positions.end())
+      {
+         group_positions[key] = groups.size();
+         groups.push_back(std::make_pair(key, std::vector<const_mult>()));
+      }
+      groups[group_positions.at(key)].second.push_back(const_mult{stmt, magnitude >> shift, shift, value < 0});
+   }
+
+   for(const auto& group : groups)
+   {
+      const auto& mults = group.second;
+      if(mults.size() < 2 or reached_max_transformation_limit(mults.front().stmt))
+      {
+         continue;
+      }
+      const auto first_ga = GetPointer<const gimple_assign>(GET_NODE(mults.front().stmt));
+      const auto me = GetPointer<const mult_expr>(GET_NODE(first_ga->op1));
+      const auto op0 = me->op0;
+      const auto type = me->type;
+      const auto data_bitsize = tree_helper::Size(GET_NODE(op0));
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Multiple constant multiplication of " + STR(GET_NODE(op0)) + " (" + STR(mults.size()) + " multiplications)");
+
+      /*
+       * Cost model: each removed multiplier is worth as many adders as the ratio between the delay of the multiplier and the one of the adder,
+       * plus MCM_ADDERS_PER_DSP adders for each DSP it would use; the depth of the adder graph must fit the delay of the multiplier or the clock period
+       */
+      double mult_delay, add_delay, mult_DSPs;
+      compute_mult_costs(data_bitsize, mult_delay, add_delay, mult_DSPs);
+      const auto mult_plus_ratio = static_cast<size_t>(ceil(mult_delay / add_delay));
+      const auto adders_per_mult = mult_plus_ratio + static_cast<size_t>(ceil(MCM_ADDERS_PER_DSP * mult_DSPs));
+      auto max_depth = mult_plus_ratio;
+      if(parameters->isOption(OPT_clock_period))
+      {
+         max_depth = std::max(max_depth, static_cast<size_t>(parameters->getOption<double>(OPT_clock_period) / add_delay));
+      }
+      const size_t n_negations = static_cast<size_t>(std::count_if(mults.begin(), mults.end(), [](const const_mult& m) { return m.negative; }));
+      const auto budget = adders_per_mult * mults.size();
+      std::vector<unsigned long long int> targets;
+      for(const auto& mult : mults)
+      {
+         if(std::find(targets.begin(), targets.end(), mult.fundamental) == targets.end())
+         {
+            targets.push_back(mult.fundamental);
+         }
+      }
+      std::vector<struct mcm_node> graph;
+      if(n_negations >= budget or not synth_mcm(targets, data_bitsize, budget - n_negations, graph))
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Adder graph more expensive than " + STR(mults.size()) + " multipliers");
+         continue;
+      }
+      const auto depth = std::max_element(graph.begin(), graph.end(), [](const struct mcm_node& a, const struct mcm_node& b) { return a.depth < b.depth; })->depth + (n_negations ? 1u : 0u);
+      if(depth > max_depth)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Adder graph too deep: " + STR(depth) + " adders");
+         continue;
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Adder graph with " + STR(graph.size() - 1 + n_negations) + " adders and depth " + STR(depth));
+
+      /// the shared adder graph is computed before the first multiplication
+      const auto& insertion_point = mults.front().stmt;
+      const std::string srcp_default = first_ga->include_name + ":" + STR(first_ga->line_number) + ":" + STR(first_ga->column_number);
+      std::vector<tree_nodeRef> products(1, op0);
+      for(size_t index = 1; index < graph.size(); ++index)
+      {
+         const auto& node = graph[index];
+         const auto shift_node = TM->CreateUniqueIntegerCst(static_cast<long long int>(node.shift), GET_INDEX_NODE(type));
+         const auto shift_expr = tree_man->create_binary_operation(type, products[node.first], shift_node, srcp_default, lshift_expr_K);
+         const auto shift_ga = tree_man->CreateGimpleAssign(type, tree_nodeRef(), tree_nodeRef(), shift_expr, block->number, srcp_default);
+         block->PushBefore(shift_ga, insertion_point);
+         const auto shifted = GetPointer<gimple_assign>(GET_NODE(shift_ga))->op0;
+         tree_nodeRef sum_expr;
+         if(not node.subtract)
+         {
+            sum_expr = tree_man->create_binary_operation(type, shifted, products[node.second], srcp_default, plus_expr_K);
+         }
+         else if(node.reversed)
+         {
+            sum_expr = tree_man->create_binary_operation(type, products[node.second], shifted, srcp_default, minus_expr_K);
+         }
+         else
+         {
+            sum_expr = tree_man->create_binary_operation(type, shifted, products[node.second], srcp_default, minus_expr_K);
+         }
+         const auto sum_ga = tree_man->CreateGimpleAssign(type, tree_nodeRef(), tree_nodeRef(), sum_expr, block->number, srcp_default);
+         block->PushBefore(sum_ga, insertion_point);
+         products.push_back(GetPointer<gimple_assign>(GET_NODE(sum_ga))->op0);
+      }
+
+      /// each multiplication becomes a shift and possibly a negation of a fundamental
+      for(const auto& mult : mults)
+      {
+         auto ga = GetPointer<gimple_assign>(GET_NODE(mult.stmt));
+         const auto node = std::find_if(graph.begin(), graph.end(), [&](const struct mcm_node& n) { return n.value == mult.fundamental; });
+         THROW_ASSERT(node != graph.end(), "fundamental " + STR(mult.fundamental) + " not computed");
+         tree_nodeRef product = products[static_cast<size_t>(node - graph.begin())];
+         tree_nodeRef product_expr = product;
+         if(mult.shift)
+         {
+            const auto shift_node = TM->CreateUniqueIntegerCst(static_cast<long long int>(mult.shift), GET_INDEX_NODE(type));
+            product_expr = tree_man->create_binary_operation(type, product, shift_node, srcp_default, lshift_expr_K);
+         }
+         if(mult.negative)
+         {
+            if(mult.shift)
+            {
+               const auto shift_ga = tree_man->CreateGimpleAssign(type, tree_nodeRef(), tree_nodeRef(), product_expr, block->number, srcp_default);
+               block->PushBefore(shift_ga, mult.stmt);
+               product = GetPointer<gimple_assign>(GET_NODE(shift_ga))->op0;
+            }
+            product_expr = tree_man->create_unary_operation(type, product, srcp_default, negate_expr_K);
+         }
+         ga->op1 = product_expr;
+#ifndef NDEBUG
+         AppM->RegisterTransformation(GetName(), mult.stmt);
+#endif
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Multiple constant multiplication of " + STR(GET_NODE(op0)));
+   }
+}
+
 bool IR_lowering::expand_target_mem_ref(target_mem_ref461* tmr, const tree_nodeRef stmt, const blocRef block, const std::string& srcp_default, bool temp_addr)
 {
    tree_nodeRef accum;
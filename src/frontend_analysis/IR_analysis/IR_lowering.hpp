@@ -111,6 +111,22 @@ class IR_lowering : public FunctionFrontendFlowStep
 
    tree_nodeRef expand_MC(tree_nodeRef op0, integer_cst* ic_node, tree_nodeRef old_target, const tree_nodeRef stmt, const blocRef block, tree_nodeRef& type_expr, const std::string& srcp_default);
 
+   /**
+    * Retrieve from the target library the characterization of the multiplier and of the adder of a given precision
+    * @param data_bitsize is the precision of the operation
+    * @param mult_delay is where the delay of the multiplier is stored
+    * @param add_delay is where the delay of the adder is stored
+    * @param mult_DSPs is where the number of DSPs used by the multiplier is stored
+    */
+   void compute_mult_costs(unsigned int data_bitsize, double& mult_delay, double& add_delay, double& mult_DSPs) const;
+
+   /**
+    * Replace the multiplications of the same operand by different constants in a basic block with a single shared adder graph
+    * (multiple constant multiplication); the graph is built only when it is cheaper than the multipliers it replaces
+    * @param block is the basic block
+    */
+   void expand_MCM(const blocRef block);
+
    bool expand_target_mem_ref(target_mem_ref461* tmr, const tree_nodeRef stmt, const blocRef block, const std::string& srcp_default, bool temp_addr);
 
    tree_nodeRef expand_mult_highpart(tree_nodeRef op0, unsigned long long int ml, tree_nodeRef type_expr, int data_bitsize, const std::list<tree_nodeRef>::const_iterator it_los, const blocRef block, const std::string& srcp_default);
@@ -977,6 +977,8 @@ DesignFlowStep_Status IR_lowering::InternalExec()
    {
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Examining BB" + STR(block.first));
       const auto& list_of_stmt = block.second->CGetStmtList();
+      /// multiplications of the same operand by different constants share their partial products
+      expand_MCM(block.second);
       bool restart_analysis;
       do
       {
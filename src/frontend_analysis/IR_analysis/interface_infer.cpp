@@ -92,6 +92,11 @@
 #include "copyrights_strings.hpp"
 
 #include "language_writer.hpp"
+#include "math_function.hpp"
+
+#include "fileIO.hpp"
+
+#include <sstream>
 
 #define EPSILON 0.000000001
 #define ENCODE_FDNAME(argName_string, MODE, interfaceType) (argName_string + STR_CST_interface_parameter_keyword + (MODE) + interfaceType)
@@ -532,6 +537,144 @@ void interface_infer::create_Write_function(const std::string& argName_string, t
    AppM->GetCallGraphManager()->AddFunctionAndCallPoint(GET_INDEX_NODE(gn->scpe), GET_INDEX_NODE(function_decl_node), new_writecall->index, FB, FunctionEdgeInfo::CallType::direct_call);
 }
 
+void interface_infer::create_Flush_function(const std::string& argName_string, unsigned int destBB, tree_nodeRef refStmt, const std::string& fdName, tree_nodeRef argSSANode, tree_nodeRef aType, const tree_manipulationRef tree_man,
+                                            const tree_managerRef TM, bool commonRWSignature)
+{
+   auto fd = GetPointer<function_decl>(TM->get_tree_node_const(function_id));
+   THROW_ASSERT(fd && fd->body, "expected a body");
+   auto* sl = GetPointer<statement_list>(GET_NODE(fd->body));
+   std::string fname;
+   tree_helper::get_mangled_fname(fd, fname);
+   const auto boolean_type = tree_man->create_boolean_type();
+   const auto bit_size_type = tree_man->create_bit_size_type();
+
+   /// a flush is a write of zero bits: it shares the signature of the write operations
+   std::vector<tree_nodeRef> argsT;
+   if(commonRWSignature)
+      argsT.push_back(boolean_type);
+   argsT.push_back(bit_size_type);
+   argsT.push_back(bit_size_type);
+   argsT.push_back(aType);
+   const std::string srcp = fd->include_name + ":" + STR(fd->line_number) + ":" + STR(fd->column_number);
+   auto function_decl_node = tree_man->create_function_decl(fdName, fd->scpe, argsT, tree_man->create_void_type(), srcp, false);
+
+   std::vector<tree_nodeRef> args;
+   if(commonRWSignature)
+      args.push_back(tree_man->CreateIntegerCst(boolean_type, 1, TM->new_tree_node_id()));
+   args.push_back(tree_man->CreateIntegerCst(bit_size_type, 0, TM->new_tree_node_id()));
+   args.push_back(tree_man->CreateIntegerCst(bit_size_type, 0, TM->new_tree_node_id()));
+   args.push_back(argSSANode);
+   auto new_flushcall = tree_man->create_gimple_call(function_decl_node, args, srcp, destBB);
+   /// artificial calls cannot be moved: the flush is serialized with respect to the other operations of the basic block
+   GetPointer<gimple_node>(GET_NODE(new_flushcall))->artificial = true;
+
+   if(refStmt)
+      sl->list_of_bloc[destBB]->PushBefore(new_flushcall, refStmt);
+   else
+      sl->list_of_bloc[destBB]->PushFront(new_flushcall);
+   GetPointer<HLS_manager>(AppM)->design_interface_stores[fname][destBB][argName_string].push_back(GET_INDEX_NODE(new_flushcall));
+   BehavioralHelperRef helper = BehavioralHelperRef(new BehavioralHelper(AppM, GET_INDEX_NODE(function_decl_node), false, parameters));
+   FunctionBehaviorRef FB = FunctionBehaviorRef(new FunctionBehavior(AppM, helper, parameters));
+   AppM->GetCallGraphManager()->AddFunctionAndCallPoint(function_id, GET_INDEX_NODE(function_decl_node), new_flushcall->index, FB, FunctionEdgeInfo::CallType::direct_call);
+}
+
+/**
+ * Compute how much a value changes between two consecutive iterations of a loop
+ * @param sl is the statement list of the function
+ * @param value is the analyzed value
+ * @param loop_id is the loop
+ * @param depth bounds the recursion on the definition chain
+ * @return the per-iteration increment; zero is returned both for loop invariant values and for unrecognized patterns
+ */
+static long long int InductionStep(const statement_list* sl, const tree_nodeRef& value, unsigned int loop_id, unsigned int depth)
+{
+   if(depth > 8 || GET_NODE(value)->get_kind() != ssa_name_K)
+      return 0;
+   const auto def = GET_NODE(GetPointer<const ssa_name>(GET_NODE(value))->CGetDefStmt());
+   if(def->get_kind() == gimple_phi_K)
+   {
+      const auto gp = GetPointer<const gimple_phi>(def);
+      if(gp->virtual_flag || sl->list_of_bloc.find(gp->bb_index) == sl->list_of_bloc.end() || sl->list_of_bloc.find(gp->bb_index)->second->loop_id != loop_id)
+         return 0;
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         if(GET_NODE(def_edge.first)->get_kind() != ssa_name_K)
+            continue;
+         const auto inc = GetPointer<const gimple_assign>(GET_NODE(GetPointer<const ssa_name>(GET_NODE(def_edge.first))->CGetDefStmt()));
+         if(!inc)
+            continue;
+         const auto be = GetPointer<const binary_expr>(GET_NODE(inc->op1));
+         if(be && (be->get_kind() == plus_expr_K || be->get_kind() == pointer_plus_expr_K) && GET_INDEX_NODE(be->op0) == GET_INDEX_NODE(gp->res) && GET_NODE(be->op1)->get_kind() == integer_cst_K)
+            return tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(be->op1)));
+      }
+      return 0;
+   }
+   const auto ga = GetPointer<const gimple_assign>(def);
+   if(!ga)
+      return 0;
+   const auto rhs = GET_NODE(ga->op1);
+   switch(rhs->get_kind())
+   {
+      case ssa_name_K:
+         return InductionStep(sl, ga->op1, loop_id, depth + 1);
+      case nop_expr_K:
+      case convert_expr_K:
+      case view_convert_expr_K:
+         return InductionStep(sl, GetPointer<const unary_expr>(rhs)->op, loop_id, depth + 1);
+      case plus_expr_K:
+      case pointer_plus_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(rhs);
+         return InductionStep(sl, be->op0, loop_id, depth + 1) + InductionStep(sl, be->op1, loop_id, depth + 1);
+      }
+      case mult_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(rhs);
+         if(GET_NODE(be->op1)->get_kind() != integer_cst_K)
+            return 0;
+         return InductionStep(sl, be->op0, loop_id, depth + 1) * tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(be->op1)));
+      }
+      case lshift_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(rhs);
+         if(GET_NODE(be->op1)->get_kind() != integer_cst_K)
+            return 0;
+         return InductionStep(sl, be->op0, loop_id, depth + 1) * (1LL << tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(be->op1))));
+      }
+      default:
+         return 0;
+   }
+}
+
+unsigned int interface_infer::ComputeBurstLength(statement_list* sl, const std::list<tree_nodeRef>& readStmt, const std::list<tree_nodeRef>& writeStmt) const
+{
+   const auto is_sequential = [&](const tree_nodeRef& stmt, bool is_read) -> bool {
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+      THROW_ASSERT(ga, "unexpected condition");
+      const auto mr = GetPointer<const mem_ref>(GET_NODE(is_read ? ga->op1 : ga->op0));
+      THROW_ASSERT(mr, "unexpected condition");
+      const auto loop_id = sl->list_of_bloc.find(ga->bb_index)->second->loop_id;
+      const auto nbytes = static_cast<long long int>(tree_helper::Size(mr->type) / 8);
+      return loop_id != 0 && nbytes != 0 && InductionStep(sl, mr->op0, loop_id, 0) == nbytes;
+   };
+   bool sequential = false;
+   for(const auto& rs : readStmt)
+      sequential = sequential || is_sequential(rs, true);
+   for(const auto& ws : writeStmt)
+      sequential = sequential || is_sequential(ws, false);
+   if(!sequential)
+      return 1;
+   unsigned int burstLength = 16;
+   if(parameters->IsParameter("m-axi-burst-length"))
+      burstLength = parameters->GetParameter<unsigned int>("m-axi-burst-length");
+   /// the burst length has to be a power of two not larger than the AXI4 limit
+   if(burstLength < 2)
+      return 1;
+   if(burstLength > 256)
+      burstLength = 256;
+   return 1u << (31u - static_cast<unsigned>(__builtin_clz(burstLength)));
+}
+
 void interface_infer::create_resource_Read_simple(const std::vector<std::string>& operations, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, bool IO_port, unsigned n_resources)
 {
    const std::string ResourceName = ENCODE_FDNAME(argName_string, "_Read_", interfaceType);
@@ -919,6 +1062,249 @@ void interface_infer::create_resource_array(const std::vector<std::string>& oper
    }
 }
 
+void interface_infer::create_resource_m_axi(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth,
+                                            unsigned int burstLength)
+{
+   const std::string ResourceName = ENCODE_FDNAME(argName_string, "_ReadWrite_", interfaceType);
+   auto HLSMgr = GetPointer<HLS_manager>(AppM);
+   auto HLS_T = HLSMgr->get_HLS_target();
+   auto TechMan = HLS_T->get_technology_manager();
+   if(!TechMan->is_library_manager(INTERFACE_LIBRARY) || !TechMan->get_library_manager(INTERFACE_LIBRARY)->is_fu(ResourceName))
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Creating interface resource: " + INTERFACE_LIBRARY + ":" + ResourceName + " (burst length " + STR(burstLength) + ")");
+      if(inputBitWidth > 512)
+         THROW_ERROR("m_axi interface does not support elements wider than 512 bits: " + argName_string);
+      structural_objectRef interface_top;
+      structural_managerRef CM = structural_managerRef(new structural_manager(parameters));
+      structural_type_descriptorRef module_type = structural_type_descriptorRef(new structural_type_descriptor(ResourceName));
+      CM->set_top_info(ResourceName, module_type);
+      interface_top = CM->get_circ();
+      /// add description and license
+      GetPointer<module>(interface_top)->set_description("Interface module for function: " + ResourceName);
+      GetPointer<module>(interface_top)->set_copyright(GENERATED_COPYRIGHT);
+      GetPointer<module>(interface_top)->set_authors("Component automatically generated by bambu");
+      GetPointer<module>(interface_top)->set_license(GENERATED_LICENSE);
+      GetPointer<module>(interface_top)->set_multi_unit_multiplicity(1);
+
+      /// the data bus is at least 32 bits wide, so that a bus word is always addressed by a byte offset of two or more bits
+      unsigned int dataBusBitWidth = std::max(32u, resize_to_1_8_16_32_64_128_256_512(inputBitWidth));
+      unsigned int address_bitsize = HLSMgr->get_address_bitsize();
+      structural_type_descriptorRef address_type = structural_type_descriptorRef(new structural_type_descriptor("bool", address_bitsize));
+      structural_type_descriptorRef data_type = structural_type_descriptorRef(new structural_type_descriptor("bool", dataBusBitWidth));
+      structural_type_descriptorRef strobe_type = structural_type_descriptorRef(new structural_type_descriptor("bool", dataBusBitWidth / 8));
+      structural_type_descriptorRef len_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 8));
+      structural_type_descriptorRef axsize_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 3));
+      structural_type_descriptorRef resp_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 2));
+      structural_type_descriptorRef size1 = structural_type_descriptorRef(new structural_type_descriptor("bool", 1));
+      structural_type_descriptorRef bool_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 0));
+      CM->add_port(CLOCK_PORT_NAME, port_o::IN, interface_top, bool_type);
+      CM->add_port(RESET_PORT_NAME, port_o::IN, interface_top, bool_type);
+      CM->add_port_vector(START_PORT_NAME, port_o::IN, 1, interface_top, bool_type);
+
+      CM->add_port_vector("in1", port_o::IN, 1, interface_top, size1);
+      CM->add_port_vector("in2", port_o::IN, 1, interface_top, size1);
+      CM->add_port_vector("in3", port_o::IN, 1, interface_top, size1);
+      auto addrPort = CM->add_port_vector("in4", port_o::IN, 1, interface_top, address_type);
+      GetPointer<port_o>(addrPort)->set_is_addr_bus(true);
+      GetPointer<port_o>(addrPort)->set_is_var_args(true); /// required to activate the module generation
+
+      const auto add_axi_port = [&](const std::string& name, port_o::port_direction dir, structural_type_descriptorRef type, port_o::port_interface pi) {
+         auto axiPort = CM->add_port("_" + argName_string + "_" + name, dir, interface_top, type);
+         GetPointer<port_o>(axiPort)->set_port_interface(pi);
+         return axiPort;
+      };
+      /// input ports: the order is relied upon by the ReadWrite_m_axi generator
+      add_axi_port("awready", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("wready", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_W);
+      add_axi_port("bvalid", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_B);
+      add_axi_port("bresp", port_o::IN, resp_type, port_o::port_interface::PI_M_AXI_B);
+      add_axi_port("arready", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_AR);
+      add_axi_port("rvalid", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_R);
+      add_axi_port("rdata", port_o::IN, data_type, port_o::port_interface::PI_M_AXI_R);
+      add_axi_port("rresp", port_o::IN, resp_type, port_o::port_interface::PI_M_AXI_R);
+      add_axi_port("rlast", port_o::IN, bool_type, port_o::port_interface::PI_M_AXI_R);
+
+      CM->add_port_vector(DONE_PORT_NAME, port_o::OUT, 1, interface_top, bool_type);
+      CM->add_port_vector("out1", port_o::OUT, 1, interface_top, size1);
+      add_axi_port("awvalid", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("awaddr", port_o::OUT, address_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("awlen", port_o::OUT, len_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("awsize", port_o::OUT, axsize_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("awburst", port_o::OUT, resp_type, port_o::port_interface::PI_M_AXI_AW);
+      add_axi_port("wvalid", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_W);
+      add_axi_port("wdata", port_o::OUT, data_type, port_o::port_interface::PI_M_AXI_W);
+      add_axi_port("wstrb", port_o::OUT, strobe_type, port_o::port_interface::PI_M_AXI_W);
+      add_axi_port("wlast", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_W);
+      add_axi_port("bready", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_B);
+      add_axi_port("arvalid", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_AR);
+      auto araddrPort = add_axi_port("araddr", port_o::OUT, address_type, port_o::port_interface::PI_M_AXI_AR);
+      /// the alignment of the read address port carries the burst length to the generator
+      GetPointer<port_o>(araddrPort)->set_port_alignment(burstLength);
+      add_axi_port("arlen", port_o::OUT, len_type, port_o::port_interface::PI_M_AXI_AR);
+      add_axi_port("arsize", port_o::OUT, axsize_type, port_o::port_interface::PI_M_AXI_AR);
+      add_axi_port("arburst", port_o::OUT, resp_type, port_o::port_interface::PI_M_AXI_AR);
+      add_axi_port("rready", port_o::OUT, bool_type, port_o::port_interface::PI_M_AXI_R);
+
+      CM->add_NP_functionality(interface_top, NP_functionality::LIBRARY, "in1 in2 in3 out1");
+      CM->add_NP_functionality(interface_top, NP_functionality::VERILOG_GENERATOR, "ReadWrite_" + interfaceType + ".cpp");
+      TechMan->add_resource(INTERFACE_LIBRARY, ResourceName, CM);
+      for(auto fdName : operationsR)
+         TechMan->add_operation(INTERFACE_LIBRARY, ResourceName, fdName);
+      for(auto fdName : operationsW)
+         TechMan->add_operation(INTERFACE_LIBRARY, ResourceName, fdName);
+      auto* fu = GetPointer<functional_unit>(TechMan->get_fu(ResourceName, INTERFACE_LIBRARY));
+      const target_deviceRef device = HLS_T->get_target_device();
+      fu->area_m = area_model::create_model(device->get_type(), parameters);
+      fu->area_m->set_area_value(0);
+
+      /// the latency of the bus is unknown: all the operations complete when done_port is asserted
+      for(const auto& operations : {operationsR, operationsW})
+      {
+         for(auto fdName : operations)
+         {
+            auto* op = GetPointer<operation>(fu->get_operation(fdName));
+            op->time_m = time_model::create_model(device->get_type(), parameters);
+            op->bounded = false;
+            op->time_m->set_execution_time(HLS_T->get_technology_manager()->CGetSetupHoldTime() + EPSILON, 0);
+         }
+      }
+      /// add constraint on resource
+      HLSMgr->design_interface_constraints[function_id][INTERFACE_LIBRARY][ResourceName] = 1;
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Interface resource created: ");
+   }
+}
+
+unsigned int interface_infer::ComputeAxisFifoDepth(const std::string& argName_string) const
+{
+   unsigned int fifoDepth = 2;
+   if(parameters->IsParameter("axis-fifo-depth"))
+      fifoDepth = parameters->GetParameter<unsigned int>("axis-fifo-depth");
+   if(parameters->IsParameter("axis-fifo-depth-file"))
+   {
+      /// each line is "<parameter> <depth>" as written by the simulation of a previous run
+      const auto depthFileName = parameters->GetParameter<std::string>("axis-fifo-depth-file");
+      const auto depthFile = fileIO_istream_open(depthFileName);
+      std::string line;
+      while(getline(*depthFile, line))
+      {
+         std::istringstream lineStream(line);
+         std::string parName;
+         unsigned int parDepth;
+         if(!(lineStream >> parName >> parDepth) || parName[0] == '#')
+            continue;
+         if(parName == argName_string)
+         {
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---FIFO depth of " + argName_string + " read from " + depthFileName + ": " + STR(parDepth));
+            fifoDepth = parDepth;
+         }
+      }
+   }
+   if(fifoDepth < 1)
+      fifoDepth = 1;
+   if(fifoDepth > 1024)
+      fifoDepth = 1024;
+   /// round up to a power of two: the generator wraps the FIFO pointers without comparisons
+   return 1u << ceil_log2(fifoDepth);
+}
+
+void interface_infer::create_resource_axis(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth,
+                                           unsigned int fifoDepth)
+{
+   THROW_ASSERT(operationsR.empty() != operationsW.empty(), "an axis parameter is either read or written");
+   const bool isRead = !operationsR.empty();
+   const std::string ResourceName = ENCODE_FDNAME(argName_string, (isRead ? "_Read_" : "_Write_"), interfaceType);
+   auto HLSMgr = GetPointer<HLS_manager>(AppM);
+   auto HLS_T = HLSMgr->get_HLS_target();
+   auto TechMan = HLS_T->get_technology_manager();
+   if(!TechMan->is_library_manager(INTERFACE_LIBRARY) || !TechMan->get_library_manager(INTERFACE_LIBRARY)->is_fu(ResourceName))
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Creating interface resource: " + INTERFACE_LIBRARY + ":" + ResourceName + (isRead ? "" : " (FIFO depth " + STR(fifoDepth) + ")"));
+      structural_objectRef interface_top;
+      structural_managerRef CM = structural_managerRef(new structural_manager(parameters));
+      structural_type_descriptorRef module_type = structural_type_descriptorRef(new structural_type_descriptor(ResourceName));
+      CM->set_top_info(ResourceName, module_type);
+      interface_top = CM->get_circ();
+      /// add description and license
+      GetPointer<module>(interface_top)->set_description("Interface module for function: " + ResourceName);
+      GetPointer<module>(interface_top)->set_copyright(GENERATED_COPYRIGHT);
+      GetPointer<module>(interface_top)->set_authors("Component automatically generated by bambu");
+      GetPointer<module>(interface_top)->set_license(GENERATED_LICENSE);
+      GetPointer<module>(interface_top)->set_multi_unit_multiplicity(1);
+
+      /// TDATA is a multiple of eight bits
+      unsigned int tdataBitWidth = inputBitWidth % 8 ? 8 * (inputBitWidth / 8) + 8 : inputBitWidth;
+      unsigned int address_bitsize = HLSMgr->get_address_bitsize();
+      structural_type_descriptorRef address_type = structural_type_descriptorRef(new structural_type_descriptor("bool", address_bitsize));
+      structural_type_descriptorRef tdata_type = structural_type_descriptorRef(new structural_type_descriptor("bool", tdataBitWidth));
+      structural_type_descriptorRef size1 = structural_type_descriptorRef(new structural_type_descriptor("bool", 1));
+      structural_type_descriptorRef bool_type = structural_type_descriptorRef(new structural_type_descriptor("bool", 0));
+      CM->add_port(CLOCK_PORT_NAME, port_o::IN, interface_top, bool_type);
+      CM->add_port(RESET_PORT_NAME, port_o::IN, interface_top, bool_type);
+      CM->add_port_vector(START_PORT_NAME, port_o::IN, 1, interface_top, bool_type);
+
+      const auto add_axis_port = [&](const std::string& name, port_o::port_direction dir, structural_type_descriptorRef type) {
+         auto axisPort = CM->add_port("_" + argName_string + "_" + name, dir, interface_top, type);
+         GetPointer<port_o>(axisPort)->set_port_interface(isRead ? port_o::port_interface::PI_S_AXIS : port_o::port_interface::PI_M_AXIS);
+         return axisPort;
+      };
+      /// the order of the ports is relied upon by the Read_axis and Write_axis generators
+      structural_objectRef addrPort;
+      if(isRead)
+      {
+         addrPort = CM->add_port_vector("in1", port_o::IN, 1, interface_top, address_type);
+         add_axis_port("TDATA", port_o::IN, tdata_type);
+         add_axis_port("TVALID", port_o::IN, bool_type);
+      }
+      else
+      {
+         CM->add_port_vector("in1", port_o::IN, 1, interface_top, size1);
+         CM->add_port_vector("in2", port_o::IN, 1, interface_top, size1);
+         addrPort = CM->add_port_vector("in3", port_o::IN, 1, interface_top, address_type);
+         add_axis_port("TREADY", port_o::IN, bool_type);
+      }
+      GetPointer<port_o>(addrPort)->set_is_addr_bus(true);
+      GetPointer<port_o>(addrPort)->set_is_var_args(true); /// required to activate the module generation
+
+      CM->add_port_vector(DONE_PORT_NAME, port_o::OUT, 1, interface_top, bool_type);
+      if(isRead)
+      {
+         CM->add_port_vector("out1", port_o::OUT, 1, interface_top, size1);
+         add_axis_port("TREADY", port_o::OUT, bool_type);
+      }
+      else
+      {
+         auto tdataPort = add_axis_port("TDATA", port_o::OUT, tdata_type);
+         /// the alignment of the data port carries the FIFO depth to the generator
+         GetPointer<port_o>(tdataPort)->set_port_alignment(fifoDepth);
+         add_axis_port("TVALID", port_o::OUT, bool_type);
+         add_axis_port("TLAST", port_o::OUT, bool_type);
+      }
+
+      CM->add_NP_functionality(interface_top, NP_functionality::LIBRARY, isRead ? "out1" : "in1 in2");
+      CM->add_NP_functionality(interface_top, NP_functionality::VERILOG_GENERATOR, (isRead ? "Read_" : "Write_") + interfaceType + ".cpp");
+      TechMan->add_resource(INTERFACE_LIBRARY, ResourceName, CM);
+      const auto& operations = isRead ? operationsR : operationsW;
+      for(auto fdName : operations)
+         TechMan->add_operation(INTERFACE_LIBRARY, ResourceName, fdName);
+      auto* fu = GetPointer<functional_unit>(TechMan->get_fu(ResourceName, INTERFACE_LIBRARY));
+      const target_deviceRef device = HLS_T->get_target_device();
+      fu->area_m = area_model::create_model(device->get_type(), parameters);
+      fu->area_m->set_area_value(0);
+
+      /// operations complete when the other side of the stream is ready
+      for(auto fdName : operations)
+      {
+         auto* op = GetPointer<operation>(fu->get_operation(fdName));
+         op->time_m = time_model::create_model(device->get_type(), parameters);
+         op->bounded = false;
+         op->time_m->set_execution_time(HLS_T->get_technology_manager()->CGetSetupHoldTime() + EPSILON, 0);
+      }
+      /// add constraint on resource
+      HLSMgr->design_interface_constraints[function_id][INTERFACE_LIBRARY][ResourceName] = 1;
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Interface resource created: ");
+   }
+}
+
 void interface_infer::ComputeResourcesAlignment(unsigned& n_resources, unsigned& alignment, unsigned int inputBitWidth, bool is_acType, bool is_signed, bool is_fixed)
 {
    n_resources = 1;
@@ -1204,7 +1590,7 @@ DesignFlowStep_Status interface_infer::InternalExec()
                      bool unkwown_pattern = false;
                      std::list<tree_nodeRef> writeStmt;
                      std::list<tree_nodeRef> readStmt;
-                     bool commonRWSignature = interfaceType == "array";
+                     bool commonRWSignature = interfaceType == "array" || interfaceType == "m_axi";
 
                      classifyArg(sl, argSSANode, canBeMovedToBB2, isRead, isWrite, unkwown_pattern, writeStmt, readStmt);
 
@@ -1240,6 +1626,10 @@ DesignFlowStep_Status interface_infer::InternalExec()
                         {
                            THROW_ERROR("parameter " + argName_string + " cannot have interface " + interfaceType + " because it is read only");
                         }
+                        else if(interfaceType == "axis")
+                        {
+                           THROW_ERROR("parameter " + argName_string + " cannot have interface " + interfaceType + " because it is both read and written");
+                        }
                      }
                      else if(isRead)
                      {
@@ -1278,7 +1668,137 @@ DesignFlowStep_Status interface_infer::InternalExec()
                      }
                      else
                         THROW_ERROR("pattern not yet supported: unused arg");
-                     if(canBeMovedToBB2 && isRead && !isWrite)
+                     if(interfaceType == "m_axi")
+                     {
+                        /// every access goes through the same adapter in program order: no load is anticipated to the entry block
+                        auto burstLength = ComputeBurstLength(sl, readStmt, writeStmt);
+                        std::vector<std::string> operationsR, operationsW;
+                        unsigned int IdIndex = 0;
+                        std::string fdName = ENCODE_FDNAME(argName_string, "_Read_", interfaceType);
+                        for(auto rs : readStmt)
+                        {
+                           std::list<tree_nodeRef> usedStmt_defs;
+                           auto rs_ga = GetPointer<gimple_assign>(GET_NODE(rs));
+                           usedStmt_defs.push_back(rs_ga->op0);
+                           std::string instanceFname = fdName + STR(IdIndex);
+                           operationsR.push_back(instanceFname);
+                           create_Read_function(rs, argName_string, rs, rs_ga->bb_index, instanceFname, argSSANode, aType, GetPointer<mem_ref>(GET_NODE(rs_ga->op1))->type, usedStmt_defs, tree_man, TM, commonRWSignature);
+                           addGimpleNOPxVirtual(rs, TM);
+                           ++IdIndex;
+                        }
+                        IdIndex = 0;
+                        fdName = ENCODE_FDNAME(argName_string, "_Write_", interfaceType);
+                        for(auto ws : writeStmt)
+                        {
+                           auto ws_ga = GetPointer<gimple_assign>(GET_NODE(ws));
+                           std::string instanceFname = fdName + STR(IdIndex);
+                           operationsW.push_back(instanceFname);
+                           create_Write_function(argName_string, ws, instanceFname, ws_ga->op1, aType, GetPointer<mem_ref>(GET_NODE(ws_ga->op0))->type, tree_man, TM, commonRWSignature);
+                           ++IdIndex;
+                        }
+                        /// the buffers of the adapter are invalidated when the function starts: memory may have been changed in between two calls
+                        unsigned int entryBB = bloc::ENTRY_BLOCK_ID;
+                        for(auto bb_succ : sl->list_of_bloc[bloc::ENTRY_BLOCK_ID]->list_of_succ)
+                        {
+                           if(bb_succ == bloc::EXIT_BLOCK_ID)
+                              continue;
+                           if(entryBB == bloc::ENTRY_BLOCK_ID)
+                              entryBB = bb_succ;
+                           else
+                              THROW_ERROR("unexpected pattern");
+                        }
+                        THROW_ASSERT(entryBB != bloc::ENTRY_BLOCK_ID, "unexpected condition");
+                        IdIndex = 0;
+                        fdName = ENCODE_FDNAME(argName_string, "_Flush_", interfaceType);
+                        operationsW.push_back(fdName + STR(IdIndex));
+                        create_Flush_function(argName_string, entryBB, tree_nodeRef(), fdName + STR(IdIndex), argSSANode, aType, tree_man, TM, commonRWSignature);
+                        ++IdIndex;
+                        if(isWrite)
+                        {
+                           /// posted writes have to reach the memory before the function returns
+                           std::list<tree_nodeRef> returnStmts;
+                           for(const auto& bb : sl->list_of_bloc)
+                           {
+                              for(const auto& stmt : bb.second->CGetStmtList())
+                              {
+                                 if(GET_NODE(stmt)->get_kind() == gimple_return_K)
+                                    returnStmts.push_back(stmt);
+                              }
+                           }
+                           for(const auto& ret : returnStmts)
+                           {
+                              std::string instanceFname = fdName + STR(IdIndex);
+                              operationsW.push_back(instanceFname);
+                              create_Flush_function(argName_string, GetPointer<gimple_node>(GET_NODE(ret))->bb_index, ret, instanceFname, argSSANode, aType, tree_man, TM, commonRWSignature);
+                              ++IdIndex;
+                           }
+                        }
+                        create_resource_m_axi(operationsR, operationsW, argName_string, interfaceType, inputBitWidth, burstLength);
+                        modified = true;
+                     }
+                     else if(interfaceType == "axis")
+                     {
+                        /// each access pops or pushes one beat of the stream: no load is anticipated to the entry block
+                        std::vector<std::string> operationsR, operationsW;
+                        unsigned int IdIndex = 0;
+                        std::string fdName = ENCODE_FDNAME(argName_string, "_Read_", interfaceType);
+                        for(auto rs : readStmt)
+                        {
+                           std::list<tree_nodeRef> usedStmt_defs;
+                           auto rs_ga = GetPointer<gimple_assign>(GET_NODE(rs));
+                           usedStmt_defs.push_back(rs_ga->op0);
+                           std::string instanceFname = fdName + STR(IdIndex);
+                           operationsR.push_back(instanceFname);
+                           create_Read_function(rs, argName_string, rs, rs_ga->bb_index, instanceFname, argSSANode, aType, GetPointer<mem_ref>(GET_NODE(rs_ga->op1))->type, usedStmt_defs, tree_man, TM, commonRWSignature);
+                           addGimpleNOPxVirtual(rs, TM);
+                           ++IdIndex;
+                        }
+                        IdIndex = 0;
+                        fdName = ENCODE_FDNAME(argName_string, "_Write_", interfaceType);
+                        for(auto ws : writeStmt)
+                        {
+                           auto ws_ga = GetPointer<gimple_assign>(GET_NODE(ws));
+                           std::string instanceFname = fdName + STR(IdIndex);
+                           operationsW.push_back(instanceFname);
+                           create_Write_function(argName_string, ws, instanceFname, ws_ga->op1, aType, GetPointer<mem_ref>(GET_NODE(ws_ga->op0))->type, tree_man, TM, commonRWSignature);
+                           ++IdIndex;
+                        }
+                        if(isWrite)
+                        {
+                           /// the end of the packet: the last beat is sent with TLAST before the function returns
+                           std::list<tree_nodeRef> returnStmts;
+                           for(const auto& bb : sl->list_of_bloc)
+                           {
+                              for(const auto& stmt : bb.second->CGetStmtList())
+                              {
+                                 if(GET_NODE(stmt)->get_kind() == gimple_return_K)
+                                    returnStmts.push_back(stmt);
+                              }
+                           }
+                           fdName = ENCODE_FDNAME(argName_string, "_Flush_", interfaceType);
+                           IdIndex = 0;
+                           for(const auto& ret : returnStmts)
+                           {
+                              std::string instanceFname = fdName + STR(IdIndex);
+                              operationsW.push_back(instanceFname);
+                              create_Flush_function(argName_string, GetPointer<gimple_node>(GET_NODE(ret))->bb_index, ret, instanceFname, argSSANode, aType, tree_man, TM, commonRWSignature);
+                              ++IdIndex;
+                           }
+                        }
+                        /// beats have to be transferred in program order: the accesses sharing a basic block are not moved
+                        for(const auto& bb2par2stmts : (isRead ? HLSMgr->design_interface_loads : HLSMgr->design_interface_stores)[fname])
+                        {
+                           const auto par2stmts = bb2par2stmts.second.find(argName_string);
+                           if(par2stmts != bb2par2stmts.second.end() && par2stmts->second.size() > 1)
+                           {
+                              for(auto stmt : par2stmts->second)
+                                 GetPointer<gimple_node>(TM->get_tree_node_const(stmt))->artificial = true;
+                           }
+                        }
+                        create_resource_axis(operationsR, operationsW, argName_string, interfaceType, inputBitWidth, isWrite ? ComputeAxisFifoDepth(argName_string) : 0);
+                        modified = true;
+                     }
+                     else if(canBeMovedToBB2 && isRead && !isWrite)
                      {
                         unsigned int destBB = bloc::ENTRY_BLOCK_ID;
                         for(auto bb_succ : sl->list_of_bloc[bloc::ENTRY_BLOCK_ID]->list_of_succ)
@@ -81,8 +81,38 @@ class interface_infer : public FunctionFrontendFlowStep
 
    void create_resource_Read_simple(const std::vector<std::string>& operations, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, bool IO_port, unsigned n_resources);
    void create_resource_Write_simple(const std::vector<std::string>& operations, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, bool IO_port, bool isDiffSize, unsigned n_resources);
+   /**
+    * Create the call to a flush operation, i.e., a write of zero bits.
+    * For m_axi parameters posted writes are sent to the memory and the read buffer is invalidated; for axis parameters the last
+    * written beat is tagged with TLAST and the operation completes once the stream has been drained.
+    * @param argName_string is the name of the parameter
+    * @param destBB is the basic block where the call is inserted
+    * @param refStmt is the statement the flush has to precede; when null the call is the first statement of destBB
+    * @param fdName is the name of the flush function
+    * @param argSSANode is the ssa name associated with the parameter
+    * @param aType is the type of the parameter
+    * @param commonRWSignature is true when the write operations of the parameter start with the read/write selector
+    */
+   void create_Flush_function(const std::string& argName_string, unsigned int destBB, tree_nodeRef refStmt, const std::string& fdName, tree_nodeRef argSSANode, tree_nodeRef aType, const tree_manipulationRef tree_man, const tree_managerRef TM,
+                              bool commonRWSignature);
+
+   /**
+    * Return the burst length to be used by the m_axi adapter of a parameter: a value greater than one is returned when at least one
+    * access is performed inside a loop on an address advancing by exactly one element per iteration.
+    * The length is set with --panda-parameter=m-axi-burst-length=<n> (default 16) and rounded down to a power of two not larger than 256.
+    */
+   unsigned int ComputeBurstLength(statement_list* sl, const std::list<tree_nodeRef>& readStmt, const std::list<tree_nodeRef>& writeStmt) const;
+
    void create_resource_array(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, unsigned int arraySize,
                               unsigned n_resources, unsigned alignment);
+   /**
+    * Return the depth of the FIFO buffering the stream produced through an axis parameter.
+    * The value comes from the file passed with --panda-parameter=axis-fifo-depth-file=<file> (as written by a previous simulation), then from --panda-parameter=axis-fifo-depth=<n>; the default is 2.
+    */
+   unsigned int ComputeAxisFifoDepth(const std::string& argName_string) const;
+
+   void create_resource_m_axi(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, unsigned int burstLength);
+   void create_resource_axis(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, unsigned int fifoDepth);
    void create_resource(const std::vector<std::string>& operationsR, const std::vector<std::string>& operationsW, const std::string& argName_string, const std::string& interfaceType, unsigned int inputBitWidth, bool isDiffSize, const std::string& fname,
                         unsigned n_resources, unsigned alignment);
 
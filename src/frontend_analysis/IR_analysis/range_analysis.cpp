@@ -0,0 +1,1042 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file range_analysis.cpp
+ * @brief Interval analysis of the integer ssa variables used to narrow their bit values
+ *
+ */
+
+/// Header include
+#include "range_analysis.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// behavior include
+#include "application_manager.hpp"
+#include "function_behavior.hpp"
+
+/// tree includes
+#include "dbgPrintHelper.hpp"      // for DEBUG_LEVEL_
+#include "string_manipulation.hpp" // for GET_CLASS
+#include "tree_basic_block.hpp"
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
+#include "tree_node.hpp"
+#include "tree_reindex.hpp"
+
+/// STD include
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <string>
+
+/// Number of enlargements of the range of a phi after which it is widened to the bounds of its type
+#define RANGE_WIDENING_THRESHOLD 3
+
+/// Maximum number of narrowing iterations
+#define RANGE_NARROWING_ITERATIONS 4
+
+/// Maximum number of evaluations per variable before the analysis is abandoned
+#define RANGE_MAX_EVALUATIONS 64
+
+/**
+ * Return the comparison equivalent to a given one once the operands have been swapped
+ */
+static enum kind SwapComparison(enum kind cmp)
+{
+   switch(cmp)
+   {
+      case lt_expr_K:
+         return gt_expr_K;
+      case le_expr_K:
+         return ge_expr_K;
+      case gt_expr_K:
+         return lt_expr_K;
+      case ge_expr_K:
+         return le_expr_K;
+      default:
+         return cmp;
+   }
+}
+
+/**
+ * Return the negation of a comparison
+ */
+static enum kind NegateComparison(enum kind cmp)
+{
+   switch(cmp)
+   {
+      case lt_expr_K:
+         return ge_expr_K;
+      case le_expr_K:
+         return gt_expr_K;
+      case gt_expr_K:
+         return le_expr_K;
+      case ge_expr_K:
+         return lt_expr_K;
+      case eq_expr_K:
+         return ne_expr_K;
+      case ne_expr_K:
+         return eq_expr_K;
+      default:
+         THROW_UNREACHABLE("Unexpected comparison " + tree_node::GetString(cmp));
+         return cmp;
+   }
+}
+
+/**
+ * Restrict a range with a condition holding on the variable
+ * @param lo is the lower bound of the range
+ * @param hi is the upper bound of the range
+ * @param cmp is the comparison between the variable and the value
+ * @param value is the constant compared with the variable
+ * @return false if the resulting range is empty
+ */
+static bool ApplyCondition(long long int& lo, long long int& hi, enum kind cmp, long long int value)
+{
+   switch(cmp)
+   {
+      case lt_expr_K:
+      {
+         if(value == std::numeric_limits<long long int>::min())
+         {
+            return false;
+         }
+         hi = std::min(hi, value - 1);
+         break;
+      }
+      case le_expr_K:
+      {
+         hi = std::min(hi, value);
+         break;
+      }
+      case gt_expr_K:
+      {
+         if(value == std::numeric_limits<long long int>::max())
+         {
+            return false;
+         }
+         lo = std::max(lo, value + 1);
+         break;
+      }
+      case ge_expr_K:
+      {
+         lo = std::max(lo, value);
+         break;
+      }
+      case eq_expr_K:
+      {
+         lo = std::max(lo, value);
+         hi = std::min(hi, value);
+         break;
+      }
+      case ne_expr_K:
+      {
+         if(lo == value and hi == value)
+         {
+            return false;
+         }
+         if(lo == value)
+         {
+            lo++;
+         }
+         else if(hi == value)
+         {
+            hi--;
+         }
+         break;
+      }
+      default:
+      {
+         THROW_UNREACHABLE("Unexpected comparison " + tree_node::GetString(cmp));
+      }
+   }
+   return lo <= hi;
+}
+
+/**
+ * Return the minimum number of bits needed to store a value
+ * @param value is the value
+ * @param is_signed is true if the value is stored in two's complement
+ */
+static unsigned int RequiredBits(long long int value, bool is_signed)
+{
+   if(not is_signed)
+   {
+      return value == 0 ? 1u : static_cast<unsigned int>(64 - __builtin_clzll(static_cast<unsigned long long int>(value)));
+   }
+   const auto magnitude = value >= 0 ? static_cast<unsigned long long int>(value) : ~static_cast<unsigned long long int>(value);
+   return magnitude == 0 ? 1u : static_cast<unsigned int>(65 - __builtin_clzll(magnitude));
+}
+
+RangeAnalysis::RangeAnalysis(const ParameterConstRef _parameters, const application_managerRef _AppM, unsigned int _function_id, const DesignFlowManagerConstRef _design_flow_manager)
+    : FunctionFrontendFlowStep(_AppM, _function_id, RANGE_ANALYSIS, _design_flow_manager, _parameters), BitLatticeManipulator(_AppM->get_tree_manager(), parameters->get_class_debug_level(GET_CLASS(*this))), sl(nullptr)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this), DEBUG_LEVEL_NONE);
+}
+
+RangeAnalysis::~RangeAnalysis() = default;
+
+const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>> RangeAnalysis::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> relationships;
+   switch(relationship_type)
+   {
+      case(DEPENDENCE_RELATIONSHIP):
+      {
+         if(parameters->isOption(OPT_bitvalue_ipa) and parameters->getOption<bool>(OPT_bitvalue_ipa))
+         {
+            relationships.insert(std::make_pair(BIT_VALUE_IPA, WHOLE_APPLICATION));
+         }
+         else
+         {
+            relationships.insert(std::make_pair(BIT_VALUE, SAME_FUNCTION));
+         }
+         relationships.insert(std::make_pair(USE_COUNTING, SAME_FUNCTION));
+         break;
+      }
+      case(INVALIDATION_RELATIONSHIP):
+      case(PRECEDENCE_RELATIONSHIP):
+      {
+         break;
+      }
+      default:
+      {
+         THROW_UNREACHABLE("");
+      }
+   }
+   return relationships;
+}
+
+bool RangeAnalysis::IsHandled(const tree_nodeConstRef& tn) const
+{
+   const auto type = tree_helper::CGetType(tn);
+   const auto type_kind = type->get_kind();
+   if(type_kind != integer_type_K and type_kind != enumeral_type_K and type_kind != boolean_type_K)
+   {
+      return false;
+   }
+   const auto size = tree_helper::Size(type);
+   return size > 0 and (tree_helper::is_int(TM, type->index) ? size <= 64 : size < 64);
+}
+
+RangeAnalysis::Range RangeAnalysis::TypeRange(const tree_nodeConstRef& tn) const
+{
+   const auto type = tree_helper::CGetType(tn);
+   const auto size = tree_helper::Size(type);
+   if(tree_helper::is_int(TM, type->index))
+   {
+      if(size == 64)
+      {
+         return Range{std::numeric_limits<long long int>::min(), std::numeric_limits<long long int>::max()};
+      }
+      return Range{-(1LL << (size - 1)), (1LL << (size - 1)) - 1};
+   }
+   return Range{0, static_cast<long long int>((1ULL << size) - 1)};
+}
+
+RangeAnalysis::Range RangeAnalysis::InitialRange(const tree_nodeConstRef& ssa) const
+{
+   auto range = TypeRange(ssa);
+   const auto sn = GetPointer<const ssa_name>(ssa);
+   const auto& bit_values = sn->bit_values;
+   const bool is_signed = tree_helper::is_int(TM, sn->index);
+   if(not bit_values.empty() and bit_values.size() <= (is_signed ? 64u : 63u))
+   {
+      /// the lowest and the highest values compatible with the bit values
+      const auto width = bit_values.size();
+      unsigned long long int min_bits = 0;
+      unsigned long long int max_bits = 0;
+      for(size_t i = 0; i < width; ++i)
+      {
+         const auto bit = bit_values.at(i);
+         const bool is_sign = is_signed and i == 0;
+         const bool min_bit = bit == '1' or (is_sign and bit != '0');
+         const bool max_bit = bit == '1' or (not is_sign and bit != '0');
+         min_bits = (min_bits << 1) | (min_bit ? 1ULL : 0ULL);
+         max_bits = (max_bits << 1) | (max_bit ? 1ULL : 0ULL);
+      }
+      const auto to_value = [&](unsigned long long int bits) -> long long int {
+         if(is_signed and width < 64 and (bits >> (width - 1)) & 1ULL)
+         {
+            return static_cast<long long int>(bits | (~0ULL << width));
+         }
+         return static_cast<long long int>(bits);
+      };
+      range.lo = std::max(range.lo, to_value(min_bits));
+      range.hi = std::min(range.hi, to_value(max_bits));
+   }
+   const auto iv_bound = iv_bounds.find(sn->index);
+   if(iv_bound != iv_bounds.end())
+   {
+      range.lo = std::max(range.lo, iv_bound->second.lo);
+      range.hi = std::min(range.hi, iv_bound->second.hi);
+   }
+   return range;
+}
+
+bool RangeAnalysis::ExtractCondition(unsigned int bb_index, bool true_edge, Condition& condition) const
+{
+   const auto block_it = sl->list_of_bloc.find(bb_index);
+   if(block_it == sl->list_of_bloc.end())
+   {
+      return false;
+   }
+   const auto& block = block_it->second;
+   if(block->true_edge == block->false_edge or block->CGetStmtList().empty())
+   {
+      return false;
+   }
+   const auto gc = GetPointer<const gimple_cond>(GET_NODE(block->CGetStmtList().back()));
+   if(not gc)
+   {
+      return false;
+   }
+   tree_nodeConstRef comparison = GET_NODE(gc->op0);
+   if(comparison->get_kind() == ssa_name_K)
+   {
+      const auto def = GetPointer<const ssa_name>(comparison)->CGetDefStmt();
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(def));
+      if(not ga)
+      {
+         return false;
+      }
+      comparison = GET_NODE(ga->op1);
+   }
+   auto cmp = comparison->get_kind();
+   if(cmp != lt_expr_K and cmp != le_expr_K and cmp != gt_expr_K and cmp != ge_expr_K and cmp != eq_expr_K and cmp != ne_expr_K)
+   {
+      return false;
+   }
+   const auto be = GetPointer<const binary_expr>(comparison);
+   auto var = GET_NODE(be->op0);
+   auto cst = GET_NODE(be->op1);
+   if(var->get_kind() == integer_cst_K and cst->get_kind() == ssa_name_K)
+   {
+      std::swap(var, cst);
+      cmp = SwapComparison(cmp);
+   }
+   if(var->get_kind() != ssa_name_K or cst->get_kind() != integer_cst_K or not IsHandled(var) or not IsHandled(cst))
+   {
+      return false;
+   }
+   condition.ssa_index = var->index;
+   condition.cmp = true_edge ? cmp : NegateComparison(cmp);
+   condition.value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(cst));
+   return true;
+}
+
+const std::vector<RangeAnalysis::Condition>& RangeAnalysis::GetBBConditions(unsigned int bb_index)
+{
+   const auto memo = bb_conditions.find(bb_index);
+   if(memo != bb_conditions.end())
+   {
+      return memo->second;
+   }
+   /// guard against cycles of blocks with a single predecessor
+   bb_conditions[bb_index];
+   std::vector<Condition> conditions;
+   const auto block_it = sl->list_of_bloc.find(bb_index);
+   if(block_it != sl->list_of_bloc.end() and block_it->second->list_of_pred.size() == 1)
+   {
+      const auto pred = block_it->second->list_of_pred.front();
+      if(pred != bb_index and sl->list_of_bloc.find(pred) != sl->list_of_bloc.end())
+      {
+         conditions = GetEdgeConditions(pred, bb_index);
+      }
+   }
+   auto& ret = bb_conditions[bb_index];
+   ret = conditions;
+   return ret;
+}
+
+std::vector<RangeAnalysis::Condition> RangeAnalysis::GetEdgeConditions(unsigned int from_bb, unsigned int to_bb)
+{
+   auto conditions = GetBBConditions(from_bb);
+   const auto& block = sl->list_of_bloc.at(from_bb);
+   Condition condition;
+   if((to_bb == block->true_edge or to_bb == block->false_edge) and ExtractCondition(from_bb, to_bb == block->true_edge, condition))
+   {
+      conditions.push_back(condition);
+   }
+   return conditions;
+}
+
+RangeAnalysis::Status RangeAnalysis::GetOperandRange(const tree_nodeConstRef& op, const std::vector<Condition>& conditions, Range& range) const
+{
+   if((op->get_kind() != ssa_name_K and op->get_kind() != integer_cst_K) or not IsHandled(op))
+   {
+      return Status::UNKNOWN;
+   }
+   if(op->get_kind() == integer_cst_K)
+   {
+      range.lo = range.hi = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(op));
+      return Status::KNOWN;
+   }
+   const auto computed = ranges.find(op->index);
+   if(computed != ranges.end())
+   {
+      range = computed->second;
+   }
+   else if(analyzed.find(op->index) != analyzed.end())
+   {
+      return Status::UNREACHED;
+   }
+   else
+   {
+      range = InitialRange(op);
+   }
+   for(const auto& condition : conditions)
+   {
+      if(condition.ssa_index == op->index and not ApplyCondition(range.lo, range.hi, condition.cmp, condition.value))
+      {
+         return Status::UNREACHED;
+      }
+   }
+   return Status::KNOWN;
+}
+
+RangeAnalysis::Status RangeAnalysis::EvaluateExpression(const tree_nodeConstRef& expr, const std::vector<Condition>& conditions, const Range& type_range, Range& range) const
+{
+   const auto expr_kind = expr->get_kind();
+   switch(expr_kind)
+   {
+      case ssa_name_K:
+      case integer_cst_K:
+      {
+         const auto status = GetOperandRange(expr, conditions, range);
+         if(status != Status::KNOWN)
+         {
+            return status;
+         }
+         /// a copy between types of different signedness or width reinterprets the bits: the range of the operand is not valid for the result
+         const auto operand_type_range = TypeRange(expr);
+         if(operand_type_range.lo != type_range.lo or operand_type_range.hi != type_range.hi or range.lo < type_range.lo or range.hi > type_range.hi)
+         {
+            range = type_range;
+         }
+         return Status::KNOWN;
+      }
+      case lt_expr_K:
+      case le_expr_K:
+      case gt_expr_K:
+      case ge_expr_K:
+      case eq_expr_K:
+      case ne_expr_K:
+      case truth_and_expr_K:
+      case truth_or_expr_K:
+      case truth_xor_expr_K:
+      case truth_not_expr_K:
+      case extract_bit_expr_K:
+      {
+         range = Range{0, 1};
+         return Status::KNOWN;
+      }
+      case cond_expr_K:
+      {
+         const auto ce = GetPointer<const cond_expr>(expr);
+         Range first, second;
+         const auto first_status = EvaluateExpression(GET_NODE(ce->op1), conditions, type_range, first);
+         const auto second_status = EvaluateExpression(GET_NODE(ce->op2), conditions, type_range, second);
+         if(first_status == Status::UNKNOWN or second_status == Status::UNKNOWN)
+         {
+            return Status::UNKNOWN;
+         }
+         if(first_status == Status::UNREACHED or second_status == Status::UNREACHED)
+         {
+            return Status::UNREACHED;
+         }
+         range = Range{std::min(first.lo, second.lo), std::max(first.hi, second.hi)};
+         return Status::KNOWN;
+      }
+      case nop_expr_K:
+      case convert_expr_K:
+      case negate_expr_K:
+      case abs_expr_K:
+      case bit_not_expr_K:
+      {
+         const auto ue = GetPointer<const unary_expr>(expr);
+         Range op;
+         const auto status = GetOperandRange(GET_NODE(ue->op), conditions, op);
+         if(status != Status::KNOWN)
+         {
+            return status;
+         }
+         long long int lo = op.lo;
+         long long int hi = op.hi;
+         bool overflow = false;
+         if(expr_kind == negate_expr_K)
+         {
+            overflow = __builtin_sub_overflow(0LL, op.hi, &lo) or __builtin_sub_overflow(0LL, op.lo, &hi);
+         }
+         else if(expr_kind == abs_expr_K)
+         {
+            if(op.lo >= 0)
+            {
+               lo = op.lo;
+               hi = op.hi;
+            }
+            else if(op.hi <= 0)
+            {
+               overflow = __builtin_sub_overflow(0LL, op.hi, &lo) or __builtin_sub_overflow(0LL, op.lo, &hi);
+            }
+            else
+            {
+               lo = 0;
+               overflow = __builtin_sub_overflow(0LL, op.lo, &hi);
+               hi = std::max(hi, op.hi);
+            }
+         }
+         else if(expr_kind == bit_not_expr_K)
+         {
+            if(type_range.lo == 0)
+            {
+               /// one's complement on an unsigned type is max - x
+               lo = type_range.hi - op.hi;
+               hi = type_range.hi - op.lo;
+            }
+            else
+            {
+               lo = ~op.hi;
+               hi = ~op.lo;
+            }
+         }
+         /// the values which do not fit the type wrap around
+         if(overflow or lo < type_range.lo or hi > type_range.hi)
+         {
+            range = type_range;
+         }
+         else
+         {
+            range = Range{lo, hi};
+         }
+         return Status::KNOWN;
+      }
+      case plus_expr_K:
+      case minus_expr_K:
+      case mult_expr_K:
+      case trunc_div_expr_K:
+      case exact_div_expr_K:
+      case trunc_mod_expr_K:
+      case bit_and_expr_K:
+      case bit_ior_expr_K:
+      case bit_xor_expr_K:
+      case rshift_expr_K:
+      case lshift_expr_K:
+      case min_expr_K:
+      case max_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(expr);
+         Range op0, op1;
+         const auto status0 = GetOperandRange(GET_NODE(be->op0), conditions, op0);
+         const auto status1 = GetOperandRange(GET_NODE(be->op1), conditions, op1);
+         if(status0 == Status::UNREACHED or status1 == Status::UNREACHED)
+         {
+            return Status::UNREACHED;
+         }
+         if(status0 == Status::UNKNOWN or status1 == Status::UNKNOWN)
+         {
+            return Status::UNKNOWN;
+         }
+         long long int lo = type_range.lo;
+         long long int hi = type_range.hi;
+         bool overflow = false;
+         switch(expr_kind)
+         {
+            case plus_expr_K:
+            {
+               overflow = __builtin_add_overflow(op0.lo, op1.lo, &lo) or __builtin_add_overflow(op0.hi, op1.hi, &hi);
+               break;
+            }
+            case minus_expr_K:
+            {
+               overflow = __builtin_sub_overflow(op0.lo, op1.hi, &lo) or __builtin_sub_overflow(op0.hi, op1.lo, &hi);
+               break;
+            }
+            case mult_expr_K:
+            {
+               long long int products[4];
+               overflow = __builtin_mul_overflow(op0.lo, op1.lo, &products[0]) or __builtin_mul_overflow(op0.lo, op1.hi, &products[1]) or __builtin_mul_overflow(op0.hi, op1.lo, &products[2]) or
+                          __builtin_mul_overflow(op0.hi, op1.hi, &products[3]);
+               if(not overflow)
+               {
+                  lo = *std::min_element(products, products + 4);
+                  hi = *std::max_element(products, products + 4);
+               }
+               break;
+            }
+            case trunc_div_expr_K:
+            case exact_div_expr_K:
+            {
+               /// truncated division by a positive constant is monotone
+               if(op1.lo == op1.hi and op1.lo > 0)
+               {
+                  lo = op0.lo / op1.lo;
+                  hi = op0.hi / op1.lo;
+               }
+               break;
+            }
+            case trunc_mod_expr_K:
+            {
+               if(op1.lo == op1.hi and op1.lo > 0)
+               {
+                  lo = op0.lo >= 0 ? 0 : -(op1.lo - 1);
+                  hi = op0.hi <= 0 ? 0 : op1.lo - 1;
+                  if(op0.lo >= 0)
+                  {
+                     hi = std::min(hi, op0.hi);
+                  }
+               }
+               break;
+            }
+            case bit_and_expr_K:
+            {
+               if(op0.lo >= 0 and op1.lo >= 0)
+               {
+                  lo = 0;
+                  hi = std::min(op0.hi, op1.hi);
+               }
+               else if(op0.lo >= 0)
+               {
+                  lo = 0;
+                  hi = op0.hi;
+               }
+               else if(op1.lo >= 0)
+               {
+                  lo = 0;
+                  hi = op1.hi;
+               }
+               break;
+            }
+            case bit_ior_expr_K:
+            case bit_xor_expr_K:
+            {
+               if(op0.lo >= 0 and op1.lo >= 0)
+               {
+                  const auto bits = std::max(RequiredBits(op0.hi, false), RequiredBits(op1.hi, false));
+                  lo = expr_kind == bit_ior_expr_K ? std::max(op0.lo, op1.lo) : 0;
+                  hi = bits >= 63 ? std::numeric_limits<long long int>::max() : static_cast<long long int>((1ULL << bits) - 1);
+               }
+               break;
+            }
+            case rshift_expr_K:
+            {
+               if(op1.lo >= 0 and op1.hi < 64)
+               {
+                  /// arithmetic shift is monotone in the shifted value and moves the result toward zero with larger amounts
+                  lo = std::min(op0.lo >> op1.lo, op0.lo >> op1.hi);
+                  hi = std::max(op0.hi >> op1.lo, op0.hi >> op1.hi);
+               }
+               break;
+            }
+            case lshift_expr_K:
+            {
+               if(op1.lo == op1.hi and op1.lo >= 0 and op1.lo < 63)
+               {
+                  const auto factor = 1LL << op1.lo;
+                  overflow = __builtin_mul_overflow(op0.lo, factor, &lo) or __builtin_mul_overflow(op0.hi, factor, &hi);
+               }
+               break;
+            }
+            case min_expr_K:
+            {
+               lo = std::min(op0.lo, op1.lo);
+               hi = std::min(op0.hi, op1.hi);
+               break;
+            }
+            case max_expr_K:
+            {
+               lo = std::max(op0.lo, op1.lo);
+               hi = std::max(op0.hi, op1.hi);
+               break;
+            }
+            default:
+            {
+               THROW_UNREACHABLE("");
+            }
+         }
+         /// the values which do not fit the type wrap around
+         if(overflow or lo < type_range.lo or hi > type_range.hi)
+         {
+            range = type_range;
+         }
+         else
+         {
+            range = Range{lo, hi};
+         }
+         return Status::KNOWN;
+      }
+      default:
+      {
+         return Status::UNKNOWN;
+      }
+   }
+   return Status::UNKNOWN;
+}
+
+bool RangeAnalysis::Evaluate(const tree_nodeConstRef& ssa, Range& range)
+{
+   const auto initial = InitialRange(ssa);
+   const auto def = GET_NODE(GetPointer<const ssa_name>(ssa)->CGetDefStmt());
+   Status status = Status::UNKNOWN;
+   if(def->get_kind() == gimple_phi_K)
+   {
+      const auto gp = GetPointer<const gimple_phi>(def);
+      bool reached = false;
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         Range incoming;
+         const auto incoming_status = GetOperandRange(GET_NODE(def_edge.first), GetEdgeConditions(def_edge.second, gp->bb_index), incoming);
+         if(incoming_status == Status::UNKNOWN)
+         {
+            reached = true;
+            status = Status::UNKNOWN;
+            break;
+         }
+         if(incoming_status == Status::KNOWN)
+         {
+            range = reached ? Range{std::min(range.lo, incoming.lo), std::max(range.hi, incoming.hi)} : incoming;
+            reached = true;
+            status = Status::KNOWN;
+         }
+      }
+      if(not reached)
+      {
+         return false;
+      }
+   }
+   else if(def->get_kind() == gimple_assign_K)
+   {
+      const auto ga = GetPointer<const gimple_assign>(def);
+      status = EvaluateExpression(GET_NODE(ga->op1), GetBBConditions(ga->bb_index), TypeRange(ssa), range);
+      if(status == Status::UNREACHED)
+      {
+         return false;
+      }
+   }
+   if(status == Status::UNKNOWN)
+   {
+      range = initial;
+      return true;
+   }
+   range.lo = std::max(range.lo, initial.lo);
+   range.hi = std::min(range.hi, initial.hi);
+   return range.lo <= range.hi;
+}
+
+void RangeAnalysis::ComputeInductionBounds()
+{
+   for(const auto& block : sl->list_of_bloc)
+   {
+      for(const auto& phi : block.second->CGetPhiList())
+      {
+         const auto gp = GetPointer<const gimple_phi>(GET_NODE(phi));
+         const auto iv = GET_NODE(gp->res);
+         if(gp->virtual_flag or gp->CGetDefEdgesList().size() != 2 or not IsHandled(iv))
+         {
+            continue;
+         }
+         /// look for iv = phi(start, next) with next = iv +/- step
+         const auto& first = gp->CGetDefEdgesList().front();
+         const auto& second = gp->CGetDefEdgesList().back();
+         const bool first_is_start = GET_NODE(first.first)->get_kind() == integer_cst_K;
+         const auto& start_edge = first_is_start ? first : second;
+         const auto& back_edge = first_is_start ? second : first;
+         const auto next = GET_NODE(back_edge.first);
+         if(GET_NODE(start_edge.first)->get_kind() != integer_cst_K or next->get_kind() != ssa_name_K or not IsHandled(next))
+         {
+            continue;
+         }
+         const auto next_def = GetPointer<const gimple_assign>(GET_NODE(GetPointer<const ssa_name>(next)->CGetDefStmt()));
+         if(not next_def or (GET_NODE(next_def->op1)->get_kind() != plus_expr_K and GET_NODE(next_def->op1)->get_kind() != minus_expr_K))
+         {
+            continue;
+         }
+         const auto increment = GetPointer<const binary_expr>(GET_NODE(next_def->op1));
+         if(GET_INDEX_NODE(increment->op0) != iv->index or GET_NODE(increment->op1)->get_kind() != integer_cst_K)
+         {
+            continue;
+         }
+         auto step = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(increment->op1)));
+         if(increment->get_kind() == minus_expr_K)
+         {
+            step = -step;
+         }
+         const auto start = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(start_edge.first)));
+         if(step == 0 or step == std::numeric_limits<long long int>::min())
+         {
+            continue;
+         }
+         /*
+          * If the back edge is taken only when the induction variable (or its next value) is different from a bound reached exactly
+          * by the sequence of values, the variables never overstep the bound
+          */
+         for(const auto& condition : GetEdgeConditions(back_edge.second, gp->bb_index))
+         {
+            if(condition.cmp != ne_expr_K or (condition.ssa_index != iv->index and condition.ssa_index != next->index))
+            {
+               continue;
+            }
+            const auto bound = condition.value;
+            long long int distance;
+            if(__builtin_sub_overflow(bound, start, &distance) or distance % step != 0 or distance / step < 1)
+            {
+               continue;
+            }
+            Range iv_range, next_range;
+            bool next_bounded = true;
+            if(condition.ssa_index == next->index)
+            {
+               /// iv in [start, bound - step], next in [start + step, bound]
+               iv_range = step > 0 ? Range{start, bound - step} : Range{bound - step, start};
+               next_range = step > 0 ? Range{start + step, bound} : Range{bound, start + step};
+            }
+            else
+            {
+               /// iv in [start, bound], next in [start + step, bound + step]
+               iv_range = step > 0 ? Range{start, bound} : Range{bound, start};
+               long long int last;
+               next_bounded = not __builtin_add_overflow(bound, step, &last);
+               next_range = step > 0 ? Range{start + step, last} : Range{last, start + step};
+            }
+            const auto next_type_range = TypeRange(next);
+            if(next_range.lo < next_type_range.lo or next_range.hi > next_type_range.hi)
+            {
+               next_bounded = false;
+            }
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Induction variable " + STR(iv) + " in [" + STR(iv_range.lo) + "," + STR(iv_range.hi) + "]");
+            iv_bounds[iv->index] = iv_range;
+            if(next_bounded)
+            {
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Induction variable " + STR(next) + " in [" + STR(next_range.lo) + "," + STR(next_range.hi) + "]");
+               iv_bounds[next->index] = next_range;
+            }
+            break;
+         }
+      }
+   }
+}
+
+bool RangeAnalysis::NarrowBitValues(const tree_nodeRef& ssa, const Range& range)
+{
+   auto sn = GetPointer<ssa_name>(ssa);
+   const auto type_size = tree_helper::Size(tree_helper::CGetType(ssa));
+   if(type_size <= 1 or tree_helper::is_bool(TM, sn->index))
+   {
+      return false;
+   }
+   const bool is_signed = tree_helper::is_int(TM, sn->index);
+   std::deque<bit_lattice> range_bitstring;
+   if(range.lo == range.hi)
+   {
+      range_bitstring = create_bitstring_from_constant(range.lo, type_size, is_signed);
+   }
+   else
+   {
+      range_bitstring = create_u_bitstring(std::max(RequiredBits(range.lo, is_signed), RequiredBits(range.hi, is_signed)));
+      if(is_signed and range.lo >= 0)
+      {
+         range_bitstring.front() = bit_lattice::ZERO;
+      }
+      else if(is_signed and range.hi < 0)
+      {
+         range_bitstring.front() = bit_lattice::ONE;
+      }
+   }
+   const auto old_bitstring = sn->bit_values.empty() ? create_u_bitstring(type_size) : string_to_bitstring(sn->bit_values);
+   const auto new_bitstring = sup(old_bitstring, range_bitstring, sn->index);
+   /// a new X means that the range and the bit values disagree: keep the bit values
+   if(std::count(new_bitstring.begin(), new_bitstring.end(), bit_lattice::X) > std::count(old_bitstring.begin(), old_bitstring.end(), bit_lattice::X))
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Range of " + STR(ssa) + " disagrees with bit values " + sn->bit_values);
+      return false;
+   }
+   const auto new_bit_values = bitstring_to_string(new_bitstring);
+   if(new_bit_values == sn->bit_values or (not sn->bit_values.empty() and new_bit_values.size() > sn->bit_values.size()))
+   {
+      return false;
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---" + STR(ssa) + " in [" + STR(range.lo) + "," + STR(range.hi) + "]: " + sn->bit_values + " -> " + new_bit_values);
+   sn->bit_values = new_bit_values;
+   return true;
+}
+
+DesignFlowStep_Status RangeAnalysis::InternalExec()
+{
+   const auto fd = GetPointer<const function_decl>(TM->CGetTreeNode(function_id));
+   sl = GetPointer<const statement_list>(GET_CONST_NODE(fd->body));
+   analyzed.clear();
+   ranges.clear();
+   phi_updates.clear();
+   bb_conditions.clear();
+   iv_bounds.clear();
+
+   /// the integer ssa variables defined in the function
+   std::vector<tree_nodeRef> variables;
+   for(const auto& block : sl->list_of_bloc)
+   {
+      for(const auto& phi : block.second->CGetPhiList())
+      {
+         const auto gp = GetPointer<const gimple_phi>(GET_NODE(phi));
+         if(not gp->virtual_flag and IsHandled(GET_NODE(gp->res)))
+         {
+            variables.push_back(GET_NODE(gp->res));
+         }
+      }
+      for(const auto& stmt : block.second->CGetStmtList())
+      {
+         const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+         if(ga and GET_NODE(ga->op0)->get_kind() == ssa_name_K and IsHandled(GET_NODE(ga->op0)))
+         {
+            variables.push_back(GET_NODE(ga->op0));
+         }
+      }
+   }
+   for(const auto& variable : variables)
+   {
+      analyzed.insert(variable->index);
+   }
+   ComputeInductionBounds();
+
+   /// ascending iterations with widening
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Computing ranges of " + STR(variables.size()) + " variables");
+   std::deque<tree_nodeRef> worklist(variables.begin(), variables.end());
+   auto in_worklist = analyzed;
+   size_t evaluations = 0;
+   while(not worklist.empty())
+   {
+      if(++evaluations > RANGE_MAX_EVALUATIONS * variables.size())
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Too many iterations: analysis abandoned");
+         return DesignFlowStep_Status::UNCHANGED;
+      }
+      const auto variable = worklist.front();
+      worklist.pop_front();
+      in_worklist.erase(variable->index);
+      Range range;
+      if(not Evaluate(variable, range))
+      {
+         continue;
+      }
+      const auto current = ranges.find(variable->index);
+      if(current != ranges.end())
+      {
+         Range joined{std::min(current->second.lo, range.lo), std::max(current->second.hi, range.hi)};
+         if(joined.lo == current->second.lo and joined.hi == current->second.hi)
+         {
+            continue;
+         }
+         if(GET_NODE(GetPointer<const ssa_name>(variable)->CGetDefStmt())->get_kind() == gimple_phi_K and ++phi_updates[variable->index] > RANGE_WIDENING_THRESHOLD)
+         {
+            const auto initial = InitialRange(variable);
+            if(joined.lo < current->second.lo)
+            {
+               joined.lo = initial.lo;
+            }
+            if(joined.hi > current->second.hi)
+            {
+               joined.hi = initial.hi;
+            }
+         }
+         current->second = joined;
+      }
+      else
+      {
+         ranges[variable->index] = range;
+      }
+      for(const auto& use : GetPointer<const ssa_name>(variable)->CGetUseStmts())
+      {
+         const auto user = GET_NODE(use.first);
+         tree_nodeRef defined;
+         if(user->get_kind() == gimple_phi_K)
+         {
+            defined = GET_NODE(GetPointer<const gimple_phi>(user)->res);
+         }
+         else if(user->get_kind() == gimple_assign_K)
+         {
+            defined = GET_NODE(GetPointer<const gimple_assign>(user)->op0);
+         }
+         if(defined and analyzed.find(defined->index) != analyzed.end() and in_worklist.insert(defined->index).second)
+         {
+            worklist.push_back(defined);
+         }
+      }
+   }
+
+   /// descending iterations starting from the post fixed point
+   for(unsigned int iteration = 0; iteration < RANGE_NARROWING_ITERATIONS; ++iteration)
+   {
+      bool narrowed = false;
+      for(const auto& variable : variables)
+      {
+         const auto current = ranges.find(variable->index);
+         Range range;
+         if(current == ranges.end() or not Evaluate(variable, range))
+         {
+            continue;
+         }
+         if(range.lo >= current->second.lo and range.hi <= current->second.hi and (range.lo != current->second.lo or range.hi != current->second.hi))
+         {
+            current->second = range;
+            narrowed = true;
+         }
+      }
+      if(not narrowed)
+      {
+         break;
+      }
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Computed ranges");
+
+   bool changed = false;
+   for(const auto& variable : variables)
+   {
+      const auto range = ranges.find(variable->index);
+      if(range != ranges.end() and NarrowBitValues(variable, range->second))
+      {
+         changed = true;
+      }
+   }
+   sl = nullptr;
+   if(changed)
+   {
+      bitvalue_version = function_behavior->UpdateBitValueVersion();
+   }
+   return changed ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
+}
+
+bool RangeAnalysis::HasToBeExecuted() const
+{
+   return (bitvalue_version != function_behavior->GetBitValueVersion()) or FunctionFrontendFlowStep::HasToBeExecuted();
+}
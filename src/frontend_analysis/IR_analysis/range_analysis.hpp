@@ -0,0 +1,232 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file range_analysis.hpp
+ * @brief Interval analysis of the integer ssa variables used to narrow their bit values
+ *
+ */
+#ifndef RANGE_ANALYSIS_HPP
+#define RANGE_ANALYSIS_HPP
+
+/// Superclass include
+#include "bit_lattice.hpp"
+#include "function_frontend_flow_step.hpp"
+
+/// tree include
+#include "tree_common.hpp"
+
+/// utility includes
+#include "custom_map.hpp"
+#include "custom_set.hpp"
+#include "refcount.hpp"
+
+/// STD include
+#include <vector>
+
+REF_FORWARD_DECL(tree_node);
+CONSTREF_FORWARD_DECL(tree_node);
+class statement_list;
+
+/**
+ * Value range analysis of the integer ssa variables of a function.
+ * The interval of each variable is computed by abstract interpretation: the phis that keep growing are widened to the bounds of their type
+ * and the result is then refined by some narrowing iterations.
+ * The comparisons against constants which control the branches restrict the compared variables in the blocks reached only through the branch;
+ * the inequality exit tests of counted loops (e.g., i != 100 with unitary increment) are turned into bounds of the induction variables.
+ * The intervals are translated into bit values, so that Bit_Value_opt and the allocation see the narrowed widths.
+ * The analysis can be disabled with --panda-parameter=range-analysis=0.
+ */
+class RangeAnalysis : public FunctionFrontendFlowStep, public BitLatticeManipulator
+{
+ private:
+   /// A closed interval of integer values
+   struct Range
+   {
+      /// the lower bound
+      long long int lo;
+
+      /// the upper bound
+      long long int hi;
+   };
+
+   /// A comparison between an ssa variable and a constant which holds on a control flow edge
+   struct Condition
+   {
+      /// the index of the ssa variable
+      unsigned int ssa_index;
+
+      /// the kind of comparison (lt_expr_K, le_expr_K, gt_expr_K, ge_expr_K, eq_expr_K or ne_expr_K)
+      enum kind cmp;
+
+      /// the constant
+      long long int value;
+   };
+
+   /// The result of the evaluation of an operand
+   enum class Status
+   {
+      UNREACHED, /// the operand has not been computed yet
+      KNOWN,     /// the range of the operand is known
+      UNKNOWN    /// the operand cannot be described by a range
+   };
+
+   /// The statement list of the function
+   const statement_list* sl;
+
+   /// The ssa variables whose range is computed by the analysis
+   CustomUnorderedSet<unsigned int> analyzed;
+
+   /// The current range of each ssa variable
+   CustomUnorderedMap<unsigned int, Range> ranges;
+
+   /// The number of times the range of each phi has been enlarged
+   CustomUnorderedMap<unsigned int, unsigned int> phi_updates;
+
+   /// The conditions holding at the beginning of each basic block
+   CustomUnorderedMap<unsigned int, std::vector<Condition>> bb_conditions;
+
+   /// The bounds of the induction variables of the counted loops
+   CustomUnorderedMap<unsigned int, Range> iv_bounds;
+
+   /**
+    * Check if a variable or a constant is an integer which can be described by a range
+    * @param tn is the tree node
+    */
+   bool IsHandled(const tree_nodeConstRef& tn) const;
+
+   /**
+    * Return the range of the values of the type of a tree node
+    * @param tn is the tree node
+    */
+   Range TypeRange(const tree_nodeConstRef& tn) const;
+
+   /**
+    * Return the range of an ssa variable implied by its type and by its current bit values
+    * @param ssa is the ssa variable
+    */
+   Range InitialRange(const tree_nodeConstRef& ssa) const;
+
+   /**
+    * Extract the comparison against a constant controlling one of the outgoing edges of a basic block
+    * @param bb_index is the index of the basic block
+    * @param true_edge is true if the condition of the true edge has to be extracted, false for the false edge
+    * @param condition is where the condition is stored
+    * @return true if the basic block ends with a comparison against a constant
+    */
+   bool ExtractCondition(unsigned int bb_index, bool true_edge, Condition& condition) const;
+
+   /**
+    * Return the conditions holding at the beginning of a basic block
+    * @param bb_index is the index of the basic block
+    */
+   const std::vector<Condition>& GetBBConditions(unsigned int bb_index);
+
+   /**
+    * Return the conditions holding on a control flow edge
+    * @param from_bb is the source of the edge
+    * @param to_bb is the target of the edge
+    */
+   std::vector<Condition> GetEdgeConditions(unsigned int from_bb, unsigned int to_bb);
+
+   /**
+    * Compute the range of an operand restricted by a set of conditions
+    * @param op is the operand
+    * @param conditions are the conditions holding where the operand is used
+    * @param range is where the range is stored
+    */
+   Status GetOperandRange(const tree_nodeConstRef& op, const std::vector<Condition>& conditions, Range& range) const;
+
+   /**
+    * Compute the range of the right part of an assignment
+    * @param expr is the expression
+    * @param conditions are the conditions holding where the expression is computed
+    * @param type_range is the range of the type of the result
+    * @param range is where the range is stored
+    */
+   Status EvaluateExpression(const tree_nodeConstRef& expr, const std::vector<Condition>& conditions, const Range& type_range, Range& range) const;
+
+   /**
+    * Compute the range of an ssa variable from its definition and the current ranges
+    * @param ssa is the ssa variable
+    * @param range is where the range is stored
+    * @return false if the definition cannot be executed with the current ranges
+    */
+   bool Evaluate(const tree_nodeConstRef& ssa, Range& range);
+
+   /**
+    * Compute the bounds of the induction variables of the loops exiting with an inequality test
+    */
+   void ComputeInductionBounds();
+
+   /**
+    * Narrow the bit values of an ssa variable according to its range
+    * @param ssa is the ssa variable
+    * @param range is its range
+    * @return true if the bit values have been changed
+    */
+   bool NarrowBitValues(const tree_nodeRef& ssa, const Range& range);
+
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor.
+    * @param Param is the set of the parameters
+    * @param AppM is the application manager
+    * @param function_id is the function index
+    * @param design_flow_manager is the design flow manager
+    */
+   RangeAnalysis(const ParameterConstRef Param, const application_managerRef AppM, unsigned int function_id, const DesignFlowManagerConstRef design_flow_manager);
+
+   /**
+    * Destructor
+    */
+   ~RangeAnalysis() override;
+
+   /**
+    * Compute the ranges of the variables and narrow their bit values
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+
+   /**
+    * Check if this step has actually to be executed
+    * @return true if the step has to be executed
+    */
+   bool HasToBeExecuted() const override;
+};
+#endif
@@ -0,0 +1,764 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file unroll_loops.cpp
+ * @brief Step that fully or partially unrolls the innermost loops of a function
+ *
+ */
+
+/// Header include
+#include "unroll_loops.hpp"
+
+/// Autoheader include
+#include "config_HAVE_BAMBU_BUILT.hpp"
+#include "config_HAVE_FROM_PRAGMA_BUILT.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// behavior include
+#include "application_manager.hpp"
+#include "function_behavior.hpp"
+
+/// design_flows includes
+#include "design_flow_graph.hpp"
+#include "design_flow_manager.hpp"
+
+#if HAVE_BAMBU_BUILT
+/// HLS includes
+#include "hls_manager.hpp"
+#include "hls_target.hpp"
+
+/// technology includes
+#include "area_model.hpp"
+#include "clb_model.hpp"
+#include "technology_flow_step.hpp"
+#include "technology_flow_step_factory.hpp"
+#include "technology_manager.hpp"
+#include "technology_node.hpp"
+
+/// utility include
+#include "math_function.hpp"
+#endif
+
+/// STD include
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/// tree includes
+#include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_
+#include "ext_tree_node.hpp"
+#include "string_manipulation.hpp" // for GET_CLASS
+#include "tree_basic_block.hpp"
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
+#include "tree_manipulation.hpp"
+#include "tree_node.hpp"
+#include "tree_node_dup.hpp"
+#include "tree_reindex.hpp"
+
+/// Maximum depth explored when evaluating an expression of the loop body
+#define EVALUATE_MAX_DEPTH 32
+
+/// Maximum number of iterations simulated to compute the trip count of a loop
+#define MAX_SIMULATED_ITERATIONS 65536
+
+UnrollLoops::UnrollLoops(const application_managerRef _AppM, unsigned int _function_id, const DesignFlowManagerConstRef _design_flow_manager, const ParameterConstRef _parameters)
+    : FunctionFrontendFlowStep(_AppM, _function_id, UNROLL_LOOPS, _design_flow_manager, _parameters)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this), DEBUG_LEVEL_NONE);
+}
+
+UnrollLoops::~UnrollLoops() = default;
+
+const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>> UnrollLoops::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> relationships;
+   switch(relationship_type)
+   {
+      case(DEPENDENCE_RELATIONSHIP):
+      {
+         relationships.insert(std::make_pair(BLOCK_FIX, SAME_FUNCTION));
+         relationships.insert(std::make_pair(SWITCH_FIX, SAME_FUNCTION));
+         relationships.insert(std::make_pair(REMOVE_CLOBBER_GA, SAME_FUNCTION));
+         relationships.insert(std::make_pair(USE_COUNTING, SAME_FUNCTION));
+#if HAVE_FROM_PRAGMA_BUILT
+         if(parameters->getOption<bool>(OPT_parse_pragma))
+         {
+            relationships.insert(std::make_pair(PRAGMA_ANALYSIS, WHOLE_APPLICATION));
+         }
+#endif
+         break;
+      }
+      case(INVALIDATION_RELATIONSHIP):
+      case(PRECEDENCE_RELATIONSHIP):
+      {
+         break;
+      }
+      default:
+      {
+         THROW_UNREACHABLE("");
+      }
+   }
+   return relationships;
+}
+
+void UnrollLoops::ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type)
+{
+#if HAVE_BAMBU_BUILT
+   /// the area of the loop bodies is taken from the characterization of the target
+   if(relationship_type == DEPENDENCE_RELATIONSHIP and parameters->IsParameter("unroll-area-budget"))
+   {
+      const DesignFlowGraphConstRef design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
+      const auto* technology_flow_step_factory = GetPointer<const TechnologyFlowStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("Technology"));
+      const std::string technology_flow_signature = TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::LOAD_TECHNOLOGY);
+      const vertex technology_flow_step = design_flow_manager.lock()->GetDesignFlowStep(technology_flow_signature);
+      const DesignFlowStepRef technology_design_flow_step =
+          technology_flow_step ? design_flow_graph->CGetDesignFlowStepInfo(technology_flow_step)->design_flow_step : technology_flow_step_factory->CreateTechnologyFlowStep(TechnologyFlowStep_Type::LOAD_TECHNOLOGY);
+      relationship.insert(technology_design_flow_step);
+   }
+#endif
+   FunctionFrontendFlowStep::ComputeRelationships(relationship, relationship_type);
+}
+
+void UnrollLoops::Initialize()
+{
+   FunctionFrontendFlowStep::Initialize();
+   TM = AppM->get_tree_manager();
+   tree_man = tree_manipulationRef(new tree_manipulation(TM, parameters));
+   sl = GetPointer<statement_list>(GET_NODE(GetPointer<const function_decl>(TM->get_tree_node_const(function_id))->body));
+}
+
+bool UnrollLoops::HasToBeExecuted() const
+{
+   /// the loops are unrolled only once, otherwise partially unrolled loops would be unrolled again
+   if(bb_version != 0)
+   {
+      return false;
+   }
+#if HAVE_FROM_PRAGMA_BUILT
+   if(parameters->getOption<bool>(OPT_parse_pragma))
+   {
+      return true;
+   }
+#endif
+   return parameters->IsParameter("unroll-area-budget");
+}
+
+bool UnrollLoops::Evaluate(const tree_nodeRef& tn, unsigned int header, const CustomUnorderedMap<unsigned int, long long int>& values, long long int& value, unsigned int depth) const
+{
+   if(depth > EVALUATE_MAX_DEPTH)
+   {
+      return false;
+   }
+   const auto curr_tn = GET_NODE(tn);
+   if(curr_tn->get_kind() == integer_cst_K)
+   {
+      value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(curr_tn));
+      return true;
+   }
+   if(curr_tn->get_kind() == ssa_name_K)
+   {
+      if(values.find(tn->index) != values.end())
+      {
+         value = values.find(tn->index)->second;
+         return true;
+      }
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(GetPointer<const ssa_name>(curr_tn)->CGetDefStmt()));
+      if(not ga or ga->bb_index != header or ga->predicate)
+      {
+         return false;
+      }
+      return Evaluate(ga->op1, header, values, value, depth + 1);
+   }
+   const auto type = tree_helper::CGetType(curr_tn);
+   const bool is_unsigned = tree_helper::is_unsigned(TM, type->index) or tree_helper::is_bool(TM, type->index);
+   if(not is_unsigned and not tree_helper::is_int(TM, type->index))
+   {
+      return false;
+   }
+   switch(curr_tn->get_kind())
+   {
+      case nop_expr_K:
+      case convert_expr_K:
+      case view_convert_expr_K:
+      {
+         if(not Evaluate(GetPointer<const unary_expr>(curr_tn)->op, header, values, value, depth + 1))
+         {
+            return false;
+         }
+         break;
+      }
+      case plus_expr_K:
+      case minus_expr_K:
+      case mult_expr_K:
+      case lshift_expr_K:
+      case rshift_expr_K:
+      case bit_and_expr_K:
+      case bit_ior_expr_K:
+      case bit_xor_expr_K:
+      case eq_expr_K:
+      case ne_expr_K:
+      case lt_expr_K:
+      case le_expr_K:
+      case gt_expr_K:
+      case ge_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(curr_tn);
+         long long int op0, op1;
+         if(not Evaluate(be->op0, header, values, op0, depth + 1) or not Evaluate(be->op1, header, values, op1, depth + 1))
+         {
+            return false;
+         }
+         const auto op_type = tree_helper::CGetType(GET_NODE(be->op0));
+         const bool unsigned_compare = tree_helper::is_unsigned(TM, op_type->index) or tree_helper::is_bool(TM, op_type->index);
+         const auto u_op0 = static_cast<unsigned long long int>(op0);
+         const auto u_op1 = static_cast<unsigned long long int>(op1);
+         switch(curr_tn->get_kind())
+         {
+            case plus_expr_K:
+               value = static_cast<long long int>(u_op0 + u_op1);
+               break;
+            case minus_expr_K:
+               value = static_cast<long long int>(u_op0 - u_op1);
+               break;
+            case mult_expr_K:
+               value = static_cast<long long int>(u_op0 * u_op1);
+               break;
+            case lshift_expr_K:
+               if(op1 < 0 or op1 > 63)
+               {
+                  return false;
+               }
+               value = static_cast<long long int>(u_op0 << op1);
+               break;
+            case rshift_expr_K:
+               if(op1 < 0 or op1 > 63)
+               {
+                  return false;
+               }
+               value = unsigned_compare ? static_cast<long long int>(u_op0 >> op1) : op0 >> op1;
+               break;
+            case bit_and_expr_K:
+               value = op0 & op1;
+               break;
+            case bit_ior_expr_K:
+               value = op0 | op1;
+               break;
+            case bit_xor_expr_K:
+               value = op0 ^ op1;
+               break;
+            case eq_expr_K:
+               value = op0 == op1;
+               break;
+            case ne_expr_K:
+               value = op0 != op1;
+               break;
+            case lt_expr_K:
+               value = unsigned_compare ? u_op0 < u_op1 : op0 < op1;
+               break;
+            case le_expr_K:
+               value = unsigned_compare ? u_op0 <= u_op1 : op0 <= op1;
+               break;
+            case gt_expr_K:
+               value = unsigned_compare ? u_op0 > u_op1 : op0 > op1;
+               break;
+            case ge_expr_K:
+               value = unsigned_compare ? u_op0 >= u_op1 : op0 >= op1;
+               break;
+            default:
+               THROW_UNREACHABLE("");
+         }
+         break;
+      }
+      default:
+      {
+         return false;
+      }
+   }
+   /// wrap the value according to the type of the expression
+   const auto size = tree_helper::size(TM, type->index);
+   if(size < 64)
+   {
+      const auto mask = (1ULL << size) - 1;
+      auto wrapped = static_cast<unsigned long long int>(value) & mask;
+      if(not is_unsigned and size > 0 and (wrapped >> (size - 1)) & 1)
+      {
+         wrapped |= ~mask;
+      }
+      value = static_cast<long long int>(wrapped);
+   }
+   return true;
+}
+
+bool UnrollLoops::ComputeTripCount(const blocRef& header, unsigned int latch, unsigned long long int& trip_count) const
+{
+   const auto gc = GetPointer<const gimple_cond>(GET_NODE(header->CGetStmtList().back()));
+   THROW_ASSERT(gc, "");
+   /// the values of the phis at the beginning of the current iteration
+   CustomUnorderedMap<unsigned int, long long int> values;
+   for(const auto& phi : header->CGetPhiList())
+   {
+      const auto gp = GetPointer<const gimple_phi>(GET_NODE(phi));
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         if(def_edge.second != latch and GET_NODE(def_edge.first)->get_kind() == integer_cst_K)
+         {
+            values[gp->res->index] = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(def_edge.first)));
+         }
+      }
+   }
+   for(unsigned long long int iteration = 1; iteration <= MAX_SIMULATED_ITERATIONS; iteration++)
+   {
+      long long int condition;
+      if(not Evaluate(gc->op0, header->number, values, condition, 0))
+      {
+         return false;
+      }
+      const auto next = condition ? header->true_edge : header->false_edge;
+      if(next != header->number and next != latch)
+      {
+         trip_count = iteration;
+         return true;
+      }
+      CustomUnorderedMap<unsigned int, long long int> next_values;
+      for(const auto& phi : header->CGetPhiList())
+      {
+         const auto gp = GetPointer<const gimple_phi>(GET_NODE(phi));
+         if(values.find(gp->res->index) == values.end())
+         {
+            continue;
+         }
+         for(const auto& def_edge : gp->CGetDefEdgesList())
+         {
+            long long int next_value;
+            if(def_edge.second == latch and Evaluate(def_edge.first, header->number, values, next_value, 0))
+            {
+               next_values[gp->res->index] = next_value;
+            }
+         }
+      }
+      values = next_values;
+   }
+   return false;
+}
+
+bool UnrollLoops::GetPragmaFactor(const blocRef& header, unsigned long long int& factor) const
+{
+   /// look for the pragma in the basic blocks preceding the loop, starting from the nearest one
+   const auto is_unroll_pragma = [&](const tree_nodeRef& tn) -> bool {
+      const auto gp = GetPointer<const gimple_pragma>(GET_NODE(tn));
+      if(not gp)
+      {
+         return false;
+      }
+      const auto tokens = SplitString(gp->line, " \t=()");
+      const auto unroll = std::find(tokens.begin(), tokens.end(), "unroll");
+      if(unroll == tokens.end())
+      {
+         return false;
+      }
+      factor = 0;
+      for(auto token = std::next(unroll); token != tokens.end(); token++)
+      {
+         if(not token->empty() and std::all_of(token->begin(), token->end(), [](char c) { return std::isdigit(c); }))
+         {
+            factor = std::stoull(*token);
+            break;
+         }
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Found pragma " + gp->line);
+      return true;
+   };
+   auto current = std::find_if(header->list_of_pred.begin(), header->list_of_pred.end(), [&](unsigned int pred) { return pred != header->number and sl->list_of_bloc.at(pred)->list_of_pred != std::vector<unsigned int>(1, header->number); });
+   if(current == header->list_of_pred.end())
+   {
+      return false;
+   }
+   auto current_index = *current;
+   while(current_index != BB_ENTRY)
+   {
+      const auto& block = sl->list_of_bloc.at(current_index);
+      const auto& stmts = block->CGetStmtList();
+      for(auto stmt = stmts.rbegin(); stmt != stmts.rend(); stmt++)
+      {
+         if(is_unroll_pragma(*stmt))
+         {
+            return true;
+         }
+         const auto gn = GetPointer<const gimple_node>(GET_NODE(*stmt));
+         if(gn and std::any_of(gn->pragmas.begin(), gn->pragmas.end(), is_unroll_pragma))
+         {
+            return true;
+         }
+      }
+      if(block->list_of_pred.size() != 1)
+      {
+         break;
+      }
+      current_index = block->list_of_pred.front();
+   }
+   return false;
+}
+
+double UnrollLoops::GetBodyArea(const blocRef& header) const
+{
+   double area = 0.0;
+#if HAVE_BAMBU_BUILT
+   const auto HLSMgr = GetPointer<const HLS_manager>(AppM);
+   const auto TechManager = HLSMgr and HLSMgr->get_HLS_target() ? HLSMgr->get_HLS_target()->get_technology_manager() : technology_managerRef();
+#endif
+   for(const auto& stmt : header->CGetStmtList())
+   {
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+      if(not ga or GET_NODE(ga->op0)->get_kind() != ssa_name_K)
+      {
+         continue;
+      }
+      const auto right_part = GET_NODE(ga->op1);
+      const auto rhs_kind = right_part->get_kind();
+      /// copies, constants and casts are implemented by wires
+      if(rhs_kind == ssa_name_K or rhs_kind == integer_cst_K or rhs_kind == nop_expr_K or rhs_kind == convert_expr_K or rhs_kind == view_convert_expr_K)
+      {
+         continue;
+      }
+      auto data_bitsize = tree_helper::Size(GET_NODE(ga->op0));
+      const auto be = GetPointer<const binary_expr>(right_part);
+      const auto ue = GetPointer<const unary_expr>(right_part);
+      if(be)
+      {
+         data_bitsize = std::max(data_bitsize, std::max(tree_helper::Size(GET_NODE(be->op0)), tree_helper::Size(GET_NODE(be->op1))));
+      }
+      else if(ue)
+      {
+         data_bitsize = std::max(data_bitsize, tree_helper::Size(GET_NODE(ue->op)));
+      }
+      /// when the target library does not characterize the operation, a LUT per bit of the computed value is assumed
+      double op_area = static_cast<double>(data_bitsize);
+#if HAVE_BAMBU_BUILT
+      if(TechManager and (be or ue))
+      {
+         const auto fu_prec = STR(resize_to_1_8_16_32_64_128_256_512(data_bitsize));
+         const auto fu_name = right_part->get_kind_text() + "_FU_" + fu_prec + "_" + fu_prec + (be ? "_" + fu_prec : "");
+         auto f_unit = TechManager->get_fu(fu_name, LIBRARY_STD_FU);
+         /// pipelined units are characterized per number of stages: the combinational one is considered
+         if(not f_unit)
+         {
+            f_unit = TechManager->get_fu(fu_name + "_0", LIBRARY_STD_FU);
+         }
+         const auto fu = GetPointer<const functional_unit>(f_unit);
+         if(fu and fu->area_m)
+         {
+            /// same metric as AllocationInformation::get_area, which is not available yet
+            op_area = GetPointer<const clb_model>(fu->area_m) ? GetPointer<const clb_model>(fu->area_m)->get_resource_value(clb_model::SLICE_LUTS) : 0.0;
+            if(op_area == 0.0)
+            {
+               op_area = fu->area_m->get_area_value();
+            }
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Area of " + STR(stmt) + " from " + fu_name + " is " + STR(op_area));
+         }
+      }
+#endif
+      area += op_area;
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Area of the body of BB" + STR(header->number) + " is " + STR(area));
+   return area;
+}
+
+void UnrollLoops::Unroll(const blocRef& header, unsigned int latch, unsigned long long int factor, bool full)
+{
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->" + std::string(full ? "Fully unrolling" : "Unrolling by " + STR(factor)) + " loop BB" + STR(header->number));
+   const auto phis = header->CGetPhiList();
+   const std::vector<tree_nodeRef> body(header->CGetStmtList().begin(), std::prev(header->CGetStmtList().end()));
+   const auto cond = header->CGetStmtList().back();
+
+   /// the ssa defined inside the loop
+   CustomOrderedSet<unsigned int> loop_defined;
+   for(const auto& phi : phis)
+   {
+      loop_defined.insert(GetPointer<const gimple_phi>(GET_NODE(phi))->res->index);
+   }
+   for(const auto& stmt : body)
+   {
+      const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+      if(GET_NODE(ga->op0)->get_kind() == ssa_name_K)
+      {
+         loop_defined.insert(ga->op0->index);
+      }
+      if(ga->vdef)
+      {
+         loop_defined.insert(ga->vdef->index);
+      }
+   }
+   const auto back_value = [&](const tree_nodeRef& phi) -> tree_nodeRef {
+      for(const auto& def_edge : GetPointer<const gimple_phi>(GET_NODE(phi))->CGetDefEdgesList())
+      {
+         if(def_edge.second == latch)
+         {
+            return def_edge.first;
+         }
+      }
+      THROW_UNREACHABLE("Feedback value of " + STR(phi) + " not found");
+      return tree_nodeRef();
+   };
+
+   /// the remapping of the ssa of the last created copy of the body
+   CustomUnorderedMapStable<unsigned int, unsigned int> previous;
+   const auto resolve = [](const CustomUnorderedMapStable<unsigned int, unsigned int>& remap, unsigned int index) -> unsigned int { return remap.find(index) != remap.end() ? remap.find(index)->second : index; };
+   for(unsigned long long int copy = 1; copy < factor; copy++)
+   {
+      CustomUnorderedMapStable<unsigned int, unsigned int> remap;
+      /// the phis of this copy are the values computed by the previous one
+      for(const auto& phi : phis)
+      {
+         remap[GetPointer<const gimple_phi>(GET_NODE(phi))->res->index] = resolve(previous, back_value(phi)->index);
+      }
+      tree_node_dup tnd(remap, TM);
+      for(const auto& stmt : body)
+      {
+         const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+         if(GET_NODE(ga->op0)->get_kind() == ssa_name_K)
+         {
+            const auto sn = GetPointer<const ssa_name>(GET_NODE(ga->op0));
+            remap[ga->op0->index] = tree_man->create_ssa_name(tree_nodeRef(), sn->type, sn->min, sn->max)->index;
+         }
+         if(ga->vdef)
+         {
+            const auto new_vdef = tree_man->create_ssa_name(tree_nodeRef(), GetPointer<const ssa_name>(GET_NODE(ga->vdef))->type, tree_nodeRef(), tree_nodeRef());
+            GetPointer<ssa_name>(GET_NODE(new_vdef))->virtual_flag = true;
+            remap[ga->vdef->index] = new_vdef->index;
+         }
+         const auto new_stmt = TM->GetTreeReindex(tnd.create_tree_node(GET_NODE(stmt)));
+         header->PushBack(new_stmt);
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Created " + STR(new_stmt));
+      }
+      previous = remap;
+   }
+
+   /// the loop is left after the last copy: the uses outside the loop refer to its values
+   for(const auto defined : loop_defined)
+   {
+      const auto new_index = resolve(previous, defined);
+      if(new_index == defined)
+      {
+         continue;
+      }
+      const auto sn = GetPointer<const ssa_name>(TM->get_tree_node_const(defined));
+      std::vector<tree_nodeRef> outside_uses;
+      for(const auto& use : sn->CGetUseStmts())
+      {
+         const auto use_bb = GetPointer<const gimple_node>(GET_NODE(use.first))->bb_index;
+         if(use_bb != header->number and use_bb != latch)
+         {
+            outside_uses.push_back(use.first);
+         }
+      }
+      for(const auto& use : outside_uses)
+      {
+         TM->ReplaceTreeNode(use, TM->GetTreeReindex(defined), TM->GetTreeReindex(new_index));
+      }
+   }
+
+   if(not full)
+   {
+      /// the exit condition is checked only in the last copy
+      for(const auto& use : tree_helper::ComputeSsaUses(cond))
+      {
+         const auto new_index = resolve(previous, use.first->index);
+         if(new_index != use.first->index)
+         {
+            TM->ReplaceTreeNode(cond, use.first, TM->GetTreeReindex(new_index));
+         }
+      }
+      for(const auto& phi : phis)
+      {
+         const auto gp = GetPointer<gimple_phi>(GET_NODE(phi));
+         gimple_phi::DefEdgeList def_edge_list;
+         for(const auto& def_edge : gp->CGetDefEdgesList())
+         {
+            def_edge_list.push_back(def_edge.second == latch ? gimple_phi::DefEdge(TM->GetTreeReindex(resolve(previous, def_edge.first->index)), latch) : def_edge);
+         }
+         gp->SetDefEdgeList(TM, def_edge_list);
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Unrolled loop BB" + STR(header->number));
+      return;
+   }
+
+   /// remove the feedback edge
+   const auto continue_bb = latch == header->number ? header->number : latch;
+   const auto exit_bb = header->true_edge == continue_bb ? header->false_edge : header->true_edge;
+   header->RemoveStmt(cond);
+   header->list_of_succ.clear();
+   header->list_of_succ.push_back(exit_bb);
+   header->true_edge = 0;
+   header->false_edge = 0;
+   header->list_of_pred.erase(std::find(header->list_of_pred.begin(), header->list_of_pred.end(), latch));
+   if(latch != header->number)
+   {
+      sl->list_of_bloc.erase(latch);
+   }
+   /// the phis have now a single incoming value
+   for(const auto& phi : phis)
+   {
+      const auto gp = GetPointer<const gimple_phi>(GET_NODE(phi));
+      tree_nodeRef init;
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         if(def_edge.second != latch)
+         {
+            init = def_edge.first;
+         }
+      }
+      THROW_ASSERT(init, "");
+      std::vector<tree_nodeRef> uses;
+      for(const auto& use : GetPointer<const ssa_name>(GET_NODE(gp->res))->CGetUseStmts())
+      {
+         uses.push_back(use.first);
+      }
+      for(const auto& use : uses)
+      {
+         TM->ReplaceTreeNode(use, gp->res, init);
+      }
+      header->RemovePhi(phi);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Fully unrolled loop BB" + STR(header->number));
+}
+
+DesignFlowStep_Status UnrollLoops::InternalExec()
+{
+   const bool has_budget = parameters->IsParameter("unroll-area-budget");
+   const auto budget = has_budget ? parameters->GetParameter<double>("unroll-area-budget") : 0.0;
+   bool modified = false;
+
+   /// collect the loops composed of a single basic block (plus an optional empty latch)
+   std::vector<std::pair<blocRef, unsigned int>> candidates;
+   for(const auto& block : sl->list_of_bloc)
+   {
+      const auto& header = block.second;
+      if(header->number == BB_ENTRY or header->number == BB_EXIT or header->list_of_pred.size() != 2 or header->CGetStmtList().empty() or GET_NODE(header->CGetStmtList().back())->get_kind() != gimple_cond_K)
+      {
+         continue;
+      }
+      unsigned int latch = 0;
+      for(const auto succ : header->list_of_succ)
+      {
+         if(succ == header->number)
+         {
+            latch = succ;
+         }
+         else if(succ != BB_EXIT)
+         {
+            const auto& succ_block = sl->list_of_bloc.at(succ);
+            if(succ_block->CGetStmtList().empty() and succ_block->CGetPhiList().empty() and succ_block->list_of_pred == std::vector<unsigned int>(1, header->number) and
+               succ_block->list_of_succ == std::vector<unsigned int>(1, header->number))
+            {
+               latch = succ;
+            }
+         }
+      }
+      if(latch == 0 or std::find(header->list_of_pred.begin(), header->list_of_pred.end(), latch) == header->list_of_pred.end())
+      {
+         continue;
+      }
+      /// calls are not duplicated since their call points would have to be added to the call graph
+      const auto is_duplicable = [](const tree_nodeRef& stmt) -> bool {
+         const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+         return ga and GET_NODE(ga->op1)->get_kind() != call_expr_K and GET_NODE(ga->op1)->get_kind() != aggr_init_expr_K;
+      };
+      const auto& stmts = header->CGetStmtList();
+      if(std::all_of(stmts.begin(), std::prev(stmts.end()), is_duplicable))
+      {
+         candidates.push_back(std::make_pair(header, latch));
+      }
+   }
+
+   for(const auto& candidate : candidates)
+   {
+      const auto& header = candidate.first;
+      const auto latch = candidate.second;
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing loop BB" + STR(header->number));
+      unsigned long long int requested = 0;
+      const bool has_pragma = GetPragmaFactor(header, requested);
+      if(not has_pragma and not has_budget)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--No unrolling requested");
+         continue;
+      }
+      unsigned long long int trip_count = 0;
+      if(not ComputeTripCount(header, latch, trip_count))
+      {
+         if(has_pragma)
+         {
+            THROW_WARNING("Loop at BB" + STR(header->number) + " not unrolled since its trip count is not known at compile time");
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Unknown trip count");
+         continue;
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Trip count is " + STR(trip_count));
+      unsigned long long int factor = 1;
+      if(has_pragma)
+      {
+         factor = requested == 0 ? trip_count : std::min(requested, trip_count);
+      }
+      else
+      {
+         const auto area = GetBodyArea(header);
+         factor = area > 0.0 ? std::min(trip_count, static_cast<unsigned long long int>(budget / area)) : trip_count;
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Loop at BB" + STR(header->number) + ": body area " + STR(area) + ", budget " + STR(budget) + ", trip count " + STR(trip_count) + ", maximum factor " + STR(factor));
+      }
+      /// partial unrolling requires a factor dividing the trip count
+      while(factor > 1 and trip_count % factor != 0)
+      {
+         factor--;
+      }
+      if(has_pragma and requested != 0 and factor != std::min(requested, trip_count))
+      {
+         THROW_WARNING("Loop at BB" + STR(header->number) + " unrolled by " + STR(factor) + " instead of " + STR(requested) + " since the factor has to divide the trip count " + STR(trip_count));
+      }
+      const bool full = factor == trip_count;
+      if(factor < 2 and not full)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Not unrolled");
+         continue;
+      }
+      Unroll(header, latch, factor, full);
+      modified = true;
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Unrolled");
+   }
+   if(modified)
+   {
+      function_behavior->UpdateBBVersion();
+   }
+   return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
+}
@@ -0,0 +1,169 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file unroll_loops.hpp
+ * @brief Step that fully or partially unrolls the innermost loops of a function
+ *
+ */
+#ifndef UNROLL_LOOPS_HPP
+#define UNROLL_LOOPS_HPP
+
+/// Superclass include
+#include "function_frontend_flow_step.hpp"
+
+/// utility includes
+#include "custom_map.hpp"
+#include "refcount.hpp"
+
+/**
+ * @name forward declarations
+ */
+//@{
+REF_FORWARD_DECL(bloc);
+class statement_list;
+REF_FORWARD_DECL(tree_manager);
+REF_FORWARD_DECL(tree_manipulation);
+REF_FORWARD_DECL(tree_node);
+//@}
+
+/**
+ * Unroll the loops whose body is a single basic block ending with the exit condition.
+ * The unrolling factor is given by a preceding "#pragma unroll [N]" (parsed when --pragma-parse is passed)
+ * or, when --panda-parameter=unroll-area-budget=<area> is given, it is the largest factor whose unrolled body fits the budget.
+ * The budget is expressed in the area unit of the target characterization (LUTs on FPGAs): the area of an operation is the one of
+ * the functional unit of the technology library implementing it, or a LUT per bit of its result when the library does not characterize it.
+ * Partial unrolling is applied only with factors which divide the trip count computed at compile time,
+ * so that the exit condition has to be checked only in the last copy of the body.
+ */
+class UnrollLoops : public FunctionFrontendFlowStep
+{
+ private:
+   /// The tree manager
+   tree_managerRef TM;
+
+   /// The tree manipulation
+   tree_manipulationRef tree_man;
+
+   /// The statement list
+   statement_list* sl{nullptr};
+
+   /**
+    * Evaluate an expression of the loop body given the values of the phis of the header
+    * @param tn is the expression
+    * @param header is the index of the loop header
+    * @param values are the values of the phis
+    * @param value is where the value is stored
+    * @param depth is the current depth of the recursion
+    * @return true if the expression can be evaluated
+    */
+   bool Evaluate(const tree_nodeRef& tn, unsigned int header, const CustomUnorderedMap<unsigned int, long long int>& values, long long int& value, unsigned int depth) const;
+
+   /**
+    * Compute the number of iterations of a loop by simulating its induction variables
+    * @param header is the loop header
+    * @param latch is the index of the basic block source of the feedback edge
+    * @param trip_count is where the number of iterations is stored
+    * @return true if the number of iterations is known at compile time
+    */
+   bool ComputeTripCount(const blocRef& header, unsigned int latch, unsigned long long int& trip_count) const;
+
+   /**
+    * Look for an unroll pragma associated with a loop
+    * @param header is the loop header
+    * @param factor is where the requested factor is stored (0 means full unrolling)
+    * @return true if a pragma has been found
+    */
+   bool GetPragmaFactor(const blocRef& header, unsigned long long int& factor) const;
+
+   /**
+    * Estimate the area of the loop body from the functional units of the technology library implementing its operations
+    * @param header is the loop header
+    * @return the area in the unit of the target characterization
+    */
+   double GetBodyArea(const blocRef& header) const;
+
+   /**
+    * Unroll a loop
+    * @param header is the loop header
+    * @param latch is the index of the basic block source of the feedback edge
+    * @param factor is the unrolling factor
+    * @param full is true if the loop has to be completely removed
+    */
+   void Unroll(const blocRef& header, unsigned int latch, unsigned long long int factor, bool full);
+
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor.
+    * @param AppM is the application manager
+    * @param function_id is the identifier of the function
+    * @param design_flow_manager is the design flow manager
+    * @param parameters is the set of the parameters
+    */
+   UnrollLoops(const application_managerRef AppM, unsigned int function_id, const DesignFlowManagerConstRef design_flow_manager, const ParameterConstRef parameters);
+
+   /**
+    *  Destructor
+    */
+   ~UnrollLoops() override;
+
+   /**
+    * Compute the relationships of a step with other steps
+    * @param relationship is where relationships will be stored
+    * @param relationship_type is the type of relationship to be computed
+    */
+   void ComputeRelationships(DesignFlowStepSet& relationship, const DesignFlowStep::RelationshipType relationship_type) override;
+
+   /**
+    * Initialize the step (i.e., like a constructor, but executed just before exec
+    */
+   void Initialize() override;
+
+   /**
+    * Unroll the loops of the function
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+
+   /**
+    * Check if this step has actually to be executed
+    * @return true if the step has to be executed
+    */
+   bool HasToBeExecuted() const override;
+};
+#endif
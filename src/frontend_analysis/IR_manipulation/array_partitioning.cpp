@@ -0,0 +1,798 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file array_partitioning.cpp
+ * @brief Step that splits local arrays into several independent banks
+ *
+ */
+
+/// Header include
+#include "array_partitioning.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// behavior include
+#include "application_manager.hpp"
+#include "function_behavior.hpp"
+
+/// HLS/memory include
+#include "memory_allocation.hpp"
+
+/// tree includes
+#include "dbgPrintHelper.hpp"      // for DEBUG_LEVEL_
+#include "string_manipulation.hpp" // for GET_CLASS
+#include "token_interface.hpp"
+#include "tree_basic_block.hpp"
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
+#include "tree_manipulation.hpp"
+#include "tree_node.hpp"
+#include "tree_reindex.hpp"
+
+/// STD include
+#include <algorithm>
+#include <map>
+#include <string>
+
+/// Maximum depth explored when computing the residue of an index
+#define RESIDUE_MAX_DEPTH 32
+
+/**
+ * Check if a tree node refers to a variable; unknown nodes are conservatively considered as referring it
+ * @param tn is the tree node to be analyzed
+ * @param var_index is the index of the variable
+ */
+static bool ContainsVar(const tree_nodeRef& tn, const unsigned int var_index)
+{
+   if(not tn)
+   {
+      return false;
+   }
+   if(GET_INDEX_NODE(tn) == var_index)
+   {
+      return true;
+   }
+   const auto curr_tn = GET_NODE(tn);
+   switch(curr_tn->get_kind())
+   {
+      case gimple_assign_K:
+      {
+         const auto ga = GetPointer<const gimple_assign>(curr_tn);
+         return ContainsVar(ga->op0, var_index) or ContainsVar(ga->op1, var_index) or ContainsVar(ga->predicate, var_index);
+      }
+      case gimple_cond_K:
+      {
+         return ContainsVar(GetPointer<const gimple_cond>(curr_tn)->op0, var_index);
+      }
+      case gimple_return_K:
+      {
+         return ContainsVar(GetPointer<const gimple_return>(curr_tn)->op, var_index);
+      }
+      case gimple_switch_K:
+      {
+         return ContainsVar(GetPointer<const gimple_switch>(curr_tn)->op0, var_index);
+      }
+      case gimple_call_K:
+      {
+         const auto gc = GetPointer<const gimple_call>(curr_tn);
+         return ContainsVar(gc->fn, var_index) or std::any_of(gc->args.begin(), gc->args.end(), [&](const tree_nodeRef& arg) { return ContainsVar(arg, var_index); });
+      }
+      case call_expr_K:
+      case aggr_init_expr_K:
+      {
+         const auto ce = GetPointer<const call_expr>(curr_tn);
+         return ContainsVar(ce->fn, var_index) or std::any_of(ce->args.begin(), ce->args.end(), [&](const tree_nodeRef& arg) { return ContainsVar(arg, var_index); });
+      }
+      case constructor_K:
+      {
+         const auto co = GetPointer<const constructor>(curr_tn);
+         return std::any_of(co->list_of_idx_valu.begin(), co->list_of_idx_valu.end(), [&](const std::pair<tree_nodeRef, tree_nodeRef>& iv) { return ContainsVar(iv.first, var_index) or ContainsVar(iv.second, var_index); });
+      }
+      case CASE_UNARY_EXPRESSION:
+      {
+         return ContainsVar(GetPointer<const unary_expr>(curr_tn)->op, var_index);
+      }
+      case CASE_BINARY_EXPRESSION:
+      {
+         const auto be = GetPointer<const binary_expr>(curr_tn);
+         return ContainsVar(be->op0, var_index) or ContainsVar(be->op1, var_index);
+      }
+      case CASE_TERNARY_EXPRESSION:
+      {
+         const auto te = GetPointer<const ternary_expr>(curr_tn);
+         return ContainsVar(te->op0, var_index) or ContainsVar(te->op1, var_index) or ContainsVar(te->op2, var_index);
+      }
+      case CASE_QUATERNARY_EXPRESSION:
+      {
+         const auto qe = GetPointer<const quaternary_expr>(curr_tn);
+         return ContainsVar(qe->op0, var_index) or ContainsVar(qe->op1, var_index) or ContainsVar(qe->op2, var_index) or ContainsVar(qe->op3, var_index);
+      }
+      case CASE_CST_NODES:
+      case CASE_DECL_NODES:
+      case ssa_name_K:
+      case gimple_goto_K:
+      case gimple_label_K:
+      case gimple_nop_K:
+      case gimple_phi_K:
+      case gimple_pragma_K:
+      case gimple_predict_K:
+      {
+         return false;
+      }
+      case target_mem_ref_K:
+      case target_mem_ref461_K:
+      case gimple_asm_K:
+      default:
+      {
+         return true;
+      }
+   }
+   return true;
+}
+
+ArrayPartitioning::ArrayPartitioning(const application_managerRef _AppM, unsigned int _function_id, const DesignFlowManagerConstRef _design_flow_manager, const ParameterConstRef _parameters)
+    : FunctionFrontendFlowStep(_AppM, _function_id, ARRAY_PARTITIONING, _design_flow_manager, _parameters)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+ArrayPartitioning::~ArrayPartitioning() = default;
+
+const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>> ArrayPartitioning::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> relationships;
+   switch(relationship_type)
+   {
+      case(DEPENDENCE_RELATIONSHIP):
+      {
+         relationships.insert(std::make_pair(BLOCK_FIX, SAME_FUNCTION));
+         relationships.insert(std::make_pair(SWITCH_FIX, SAME_FUNCTION));
+         relationships.insert(std::make_pair(REMOVE_CLOBBER_GA, SAME_FUNCTION));
+         relationships.insert(std::make_pair(USE_COUNTING, SAME_FUNCTION));
+         break;
+      }
+      case(INVALIDATION_RELATIONSHIP):
+      {
+         break;
+      }
+      case(PRECEDENCE_RELATIONSHIP):
+      {
+         relationships.insert(std::make_pair(REBUILD_INITIALIZATION, SAME_FUNCTION));
+         relationships.insert(std::make_pair(UNROLL_LOOPS, SAME_FUNCTION));
+         break;
+      }
+      default:
+      {
+         THROW_UNREACHABLE("");
+      }
+   }
+   return relationships;
+}
+
+void ArrayPartitioning::Initialize()
+{
+   FunctionFrontendFlowStep::Initialize();
+   TM = AppM->get_tree_manager();
+   tree_man = tree_manipulationConstRef(new tree_manipulation(TM, parameters));
+}
+
+bool ArrayPartitioning::ComputeResidue(const tree_nodeRef& index, long long int factor, long long int& residue, CustomUnorderedMap<unsigned int, long long int>& assumed, unsigned int depth) const
+{
+   if(depth > RESIDUE_MAX_DEPTH)
+   {
+      return false;
+   }
+   const auto curr_tn = GET_NODE(index);
+   if(curr_tn->get_kind() == integer_cst_K)
+   {
+      const auto value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(curr_tn));
+      residue = ((value % factor) + factor) % factor;
+      return true;
+   }
+   if(curr_tn->get_kind() != ssa_name_K)
+   {
+      return false;
+   }
+   /// residue already assumed for a phi under analysis; a negative value means that it is still unknown
+   if(assumed.find(index->index) != assumed.end())
+   {
+      residue = assumed.find(index->index)->second;
+      return residue >= 0;
+   }
+   const auto sn = GetPointer<const ssa_name>(curr_tn);
+   const auto def_stmt = GET_NODE(sn->CGetDefStmt());
+   if(def_stmt->get_kind() == gimple_phi_K)
+   {
+      /// optimistic analysis: the residue of the phi is the one of its acyclic definitions and it has to be confirmed by all the definitions
+      const auto gp = GetPointer<const gimple_phi>(def_stmt);
+      assumed[index->index] = -1;
+      bool found = false;
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         long long int def_residue;
+         if(ComputeResidue(def_edge.first, factor, def_residue, assumed, depth + 1))
+         {
+            if(found and def_residue != residue)
+            {
+               assumed.erase(index->index);
+               return false;
+            }
+            found = true;
+            residue = def_residue;
+         }
+      }
+      if(not found)
+      {
+         assumed.erase(index->index);
+         return false;
+      }
+      assumed[index->index] = residue;
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         long long int def_residue;
+         if(not ComputeResidue(def_edge.first, factor, def_residue, assumed, depth + 1) or def_residue != residue)
+         {
+            assumed.erase(index->index);
+            return false;
+         }
+      }
+      assumed.erase(index->index);
+      return true;
+   }
+   const auto ga = GetPointer<const gimple_assign>(def_stmt);
+   if(not ga or ga->predicate)
+   {
+      return false;
+   }
+   const auto rhs = GET_NODE(ga->op1);
+   switch(rhs->get_kind())
+   {
+      case integer_cst_K:
+      case ssa_name_K:
+      {
+         return ComputeResidue(ga->op1, factor, residue, assumed, depth + 1);
+      }
+      case nop_expr_K:
+      case convert_expr_K:
+      case view_convert_expr_K:
+      {
+         /// conversions preserve the residue only when the modulus is a power of two
+         if((factor & (factor - 1)) != 0)
+         {
+            return false;
+         }
+         return ComputeResidue(GetPointer<const unary_expr>(rhs)->op, factor, residue, assumed, depth + 1);
+      }
+      case plus_expr_K:
+      case minus_expr_K:
+      case mult_expr_K:
+      case lshift_expr_K:
+      {
+         const auto be = GetPointer<const binary_expr>(rhs);
+         if(rhs->get_kind() == lshift_expr_K)
+         {
+            if(GET_NODE(be->op1)->get_kind() != integer_cst_K)
+            {
+               return false;
+            }
+            long long int op0_residue;
+            if(not ComputeResidue(be->op0, factor, op0_residue, assumed, depth + 1))
+            {
+               return false;
+            }
+            const auto shift = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(be->op1)));
+            residue = op0_residue;
+            for(long long int bit = 0; bit < shift and residue != 0; bit++)
+            {
+               residue = (residue * 2) % factor;
+            }
+            return true;
+         }
+         long long int op0_residue, op1_residue;
+         const bool op0_known = ComputeResidue(be->op0, factor, op0_residue, assumed, depth + 1);
+         const bool op1_known = ComputeResidue(be->op1, factor, op1_residue, assumed, depth + 1);
+         if(rhs->get_kind() == mult_expr_K and ((op0_known and op0_residue == 0) or (op1_known and op1_residue == 0)))
+         {
+            residue = 0;
+            return true;
+         }
+         if(not op0_known or not op1_known)
+         {
+            return false;
+         }
+         if(rhs->get_kind() == plus_expr_K)
+         {
+            residue = (op0_residue + op1_residue) % factor;
+         }
+         else if(rhs->get_kind() == minus_expr_K)
+         {
+            residue = (op0_residue - op1_residue + factor) % factor;
+         }
+         else
+         {
+            residue = (op0_residue * op1_residue) % factor;
+         }
+         return true;
+      }
+      default:
+      {
+         return false;
+      }
+   }
+   return false;
+}
+
+bool ArrayPartitioning::CollectAccesses(const tree_nodeRef& var, std::vector<ArrayAccess>& accesses) const
+{
+   const auto fd = GetPointer<const function_decl>(TM->get_tree_node_const(function_id));
+   const auto sl = GetPointer<const statement_list>(GET_NODE(fd->body));
+   /// check if an operand of an assignment is a supported access to var
+   const auto is_access = [&](const tree_nodeRef& op) -> bool {
+      if(GET_NODE(op)->get_kind() != array_ref_K)
+      {
+         return false;
+      }
+      const auto ar = GetPointer<const array_ref>(GET_NODE(op));
+      if(GET_INDEX_NODE(ar->op0) != var->index)
+      {
+         return false;
+      }
+      const auto index_kind = GET_NODE(ar->op1)->get_kind();
+      return (index_kind == integer_cst_K or index_kind == ssa_name_K) and not ar->op2 and not ar->op3;
+   };
+   for(const auto& block : sl->list_of_bloc)
+   {
+      for(const auto& stmt : block.second->CGetStmtList())
+      {
+         const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+         if(ga and is_access(ga->op0) and not ContainsVar(ga->op1, var->index) and not ContainsVar(ga->predicate, var->index))
+         {
+            accesses.push_back(ArrayAccess{stmt, ga->op0, true, block.first});
+         }
+         else if(ga and is_access(ga->op1) and not ContainsVar(ga->op0, var->index) and not ContainsVar(ga->predicate, var->index))
+         {
+            accesses.push_back(ArrayAccess{stmt, ga->op1, false, block.first});
+         }
+         else if(ContainsVar(stmt, var->index))
+         {
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---" + STR(var) + " is used in " + STR(stmt));
+            return false;
+         }
+      }
+   }
+   return not accesses.empty();
+}
+
+unsigned long long int ArrayPartitioning::ComputeAutomaticFactor(const std::vector<ArrayAccess>& accesses, unsigned long long int n_elements) const
+{
+   const auto channels_type = parameters->getOption<MemoryAllocation_ChannelsType>(OPT_channels_type);
+   const unsigned long long int ports = ((channels_type == MemoryAllocation_ChannelsType::MEM_ACC_NN or channels_type == MemoryAllocation_ChannelsType::MEM_ACC_CS) and parameters->isOption(OPT_channels_number)) ? parameters->getOption<unsigned int>(OPT_channels_number) : 1;
+   const unsigned long long int max_banks = parameters->IsParameter("array-partition-max-banks") ? parameters->GetParameter<unsigned long long int>("array-partition-max-banks") : 8;
+
+   /// check if there is any contention on the memory ports
+   CustomUnorderedMap<unsigned int, unsigned long long int> bb_accesses;
+   for(const auto& access : accesses)
+   {
+      bb_accesses[access.bb_index]++;
+   }
+   if(std::none_of(bb_accesses.begin(), bb_accesses.end(), [&](const std::pair<const unsigned int, unsigned long long int>& bb_access) { return bb_access.second > ports; }))
+   {
+      return 1;
+   }
+
+   /// look for the smallest cyclic factor which removes the contention and whose banks are known at compile time
+   for(unsigned long long int factor = 2; factor <= max_banks and factor <= n_elements; factor *= 2)
+   {
+      std::map<std::pair<unsigned int, long long int>, unsigned long long int> bank_accesses;
+      bool known = true;
+      for(const auto& access : accesses)
+      {
+         long long int residue;
+         CustomUnorderedMap<unsigned int, long long int> assumed;
+         if(not ComputeResidue(GetPointer<const array_ref>(GET_NODE(access.array_ref))->op1, static_cast<long long int>(factor), residue, assumed, 0))
+         {
+            known = false;
+            break;
+         }
+         bank_accesses[std::make_pair(access.bb_index, residue)]++;
+      }
+      if(not known)
+      {
+         break;
+      }
+      if(std::none_of(bank_accesses.begin(), bank_accesses.end(), [&](const std::pair<const std::pair<unsigned int, long long int>, unsigned long long int>& bank_access) { return bank_access.second > ports; }))
+      {
+         return factor;
+      }
+   }
+   /// a partial reduction of the contention is not worth the selection logic of the banks
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---No cyclic factor up to " + STR(max_banks) + " removes the contention");
+   return 1;
+}
+
+tree_nodeRef ArrayPartitioning::CreateIndexOperation(const tree_nodeRef& index, long long int constant, enum kind op_kind, const blocRef& block, const tree_nodeRef& stmt, const std::string& srcp) const
+{
+   const auto type = GetPointer<const ssa_name>(GET_NODE(index))->type;
+   const auto expr = tree_man->create_binary_operation(type, index, TM->CreateUniqueIntegerCst(constant, type->index), srcp, op_kind);
+   const auto new_ga = tree_man->CreateGimpleAssign(type, tree_nodeRef(), tree_nodeRef(), expr, block->number, srcp);
+   block->PushBefore(new_ga, stmt);
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Created " + STR(new_ga));
+   return GetPointer<const gimple_assign>(GET_NODE(new_ga))->op0;
+}
+
+bool ArrayPartitioning::Partition(const tree_nodeRef& var, const std::vector<ArrayAccess>& accesses, PartitionType partition_type, unsigned long long int n_banks)
+{
+   const auto vd = GetPointer<const var_decl>(GET_NODE(var));
+   const auto array_type_index = tree_helper::get_type_index(TM, var->index);
+   const unsigned long long int n_elements = tree_helper::get_array_num_elements(TM, array_type_index);
+   const auto element_type = TM->GetTreeReindex(tree_helper::GetElements(TM, array_type_index));
+   if(partition_type == PartitionType::COMPLETE)
+   {
+      n_banks = n_elements;
+   }
+   n_banks = std::min(n_banks, n_elements);
+   if(n_banks < 2)
+   {
+      return false;
+   }
+   /// number of elements of each bank
+   const auto bank_size = (n_elements + n_banks - 1) / n_banks;
+   if(partition_type == PartitionType::BLOCK)
+   {
+      n_banks = (n_elements + bank_size - 1) / bank_size;
+   }
+   const bool cyclic = partition_type != PartitionType::BLOCK;
+   const auto bank_of = [&](long long int element) -> long long int { return cyclic ? element % static_cast<long long int>(n_banks) : element / static_cast<long long int>(bank_size); };
+   const auto offset_of = [&](long long int element) -> long long int { return cyclic ? element / static_cast<long long int>(n_banks) : element % static_cast<long long int>(bank_size); };
+
+   /// compute the bank accessed by each access, when known at compile time
+   std::vector<long long int> banks;
+   for(const auto& access : accesses)
+   {
+      const auto index = GetPointer<const array_ref>(GET_NODE(access.array_ref))->op1;
+      long long int bank = -1;
+      if(GET_NODE(index)->get_kind() == integer_cst_K)
+      {
+         const auto value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(index)));
+         if(value < 0 or static_cast<unsigned long long int>(value) >= n_elements)
+         {
+            THROW_WARNING("Array " + STR(var) + " is accessed out of bounds: it will not be partitioned");
+            return false;
+         }
+         bank = bank_of(value);
+      }
+      else if(cyclic)
+      {
+         CustomUnorderedMap<unsigned int, long long int> assumed;
+         long long int residue;
+         if(ComputeResidue(index, static_cast<long long int>(n_banks), residue, assumed, 0))
+         {
+            bank = residue;
+         }
+      }
+      if(bank < 0 and access.is_store)
+      {
+         THROW_WARNING("Bank written by " + STR(access.stmt) + " is not known at compile time: " + STR(var) + " will not be partitioned");
+         return false;
+      }
+      banks.push_back(bank);
+   }
+
+   /// split the initialization
+   std::vector<std::map<long long int, tree_nodeRef>> bank_inits(n_banks);
+   if(vd->init)
+   {
+      const auto co = GetPointer<const constructor>(GET_NODE(vd->init));
+      if(not co)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Unsupported initialization " + STR(vd->init));
+         return false;
+      }
+      long long int position = 0;
+      for(const auto& idx_valu : co->list_of_idx_valu)
+      {
+         if(idx_valu.first)
+         {
+            if(GET_NODE(idx_valu.first)->get_kind() != integer_cst_K)
+            {
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Unsupported initialization " + STR(vd->init));
+               return false;
+            }
+            position = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(idx_valu.first)));
+         }
+         if(position < 0 or static_cast<unsigned long long int>(position) >= n_elements)
+         {
+            return false;
+         }
+         bank_inits[static_cast<size_t>(bank_of(position))][offset_of(position)] = idx_valu.second;
+         position++;
+      }
+   }
+
+   /// create the banks
+   const std::string var_name = vd->name ? GetPointer<const identifier_node>(GET_NODE(vd->name))->strg : "array_" + STR(var->index);
+   const std::string var_srcp = vd->include_name + ":" + STR(vd->line_number) + ":" + STR(vd->column_number);
+   const auto bank_type = tree_man->CreateArrayType(element_type, bank_size);
+   const auto size_type = tree_man->create_size_type();
+   std::vector<tree_nodeRef> bank_vars;
+   for(unsigned long long int bank = 0; bank < n_banks; bank++)
+   {
+      tree_nodeRef init;
+      if(vd->init)
+      {
+         std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> constructor_schema;
+         constructor_schema[TOK(TOK_TYPE)] = STR(bank_type->index);
+         const auto constructor_id = TM->new_tree_node_id();
+         TM->create_tree_node(constructor_id, constructor_K, constructor_schema);
+         auto co = GetPointer<constructor>(TM->get_tree_node_const(constructor_id));
+         for(const auto& offset_value : bank_inits[bank])
+         {
+            co->add_idx_valu(TM->CreateUniqueIntegerCst(offset_value.first, size_type->index), offset_value.second);
+         }
+         init = TM->GetTreeReindex(constructor_id);
+      }
+      const auto bank_var = tree_man->create_var_decl(tree_man->create_identifier_node(var_name + "_bank" + STR(bank)), bank_type, vd->scpe, GetPointer<const type_node>(GET_NODE(bank_type))->size, vd->smt_ann, init, var_srcp, vd->algn, vd->used, true, -1,
+                                                      vd->static_static_flag, false, vd->static_flag, false, vd->readonly_flag);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Created bank " + STR(bank_var));
+      bank_vars.push_back(bank_var);
+   }
+
+   /// create an array_ref on a bank
+   const auto create_array_ref = [&](const tree_nodeRef& bank_var, const tree_nodeRef& offset, const std::string& srcp) -> tree_nodeRef {
+      std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> array_ref_schema;
+      array_ref_schema[TOK(TOK_TYPE)] = STR(element_type->index);
+      array_ref_schema[TOK(TOK_OP0)] = STR(bank_var->index);
+      array_ref_schema[TOK(TOK_OP1)] = STR(offset->index);
+      array_ref_schema[TOK(TOK_SRCP)] = srcp;
+      const auto array_ref_id = TM->new_tree_node_id();
+      TM->create_tree_node(array_ref_id, array_ref_K, array_ref_schema);
+      return TM->GetTreeReindex(array_ref_id);
+   };
+
+   const auto fd = GetPointer<const function_decl>(TM->get_tree_node_const(function_id));
+   const auto sl = GetPointer<const statement_list>(GET_NODE(fd->body));
+   const bool power_of_two = (n_banks & (n_banks - 1)) == 0 and cyclic;
+   const auto log_banks = static_cast<long long int>(__builtin_ctzll(n_banks));
+   for(size_t access_index = 0; access_index < accesses.size(); access_index++)
+   {
+      const auto& access = accesses[access_index];
+      const auto ar = GetPointer<const array_ref>(GET_NODE(access.array_ref));
+      const auto gn = GetPointer<const gimple_node>(GET_NODE(access.stmt));
+      const std::string srcp = gn->include_name + ":" + STR(gn->line_number) + ":" + STR(gn->column_number);
+      const auto block = sl->list_of_bloc.find(access.bb_index)->second;
+      const auto bank = banks[access_index];
+      tree_nodeRef offset;
+      if(GET_NODE(ar->op1)->get_kind() == integer_cst_K)
+      {
+         const auto value = tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(ar->op1)));
+         offset = TM->CreateUniqueIntegerCst(offset_of(value), tree_helper::CGetType(GET_NODE(ar->op1))->index);
+      }
+      else if(cyclic)
+      {
+         offset = power_of_two ? CreateIndexOperation(ar->op1, log_banks, rshift_expr_K, block, access.stmt, srcp) : CreateIndexOperation(ar->op1, static_cast<long long int>(n_banks), trunc_div_expr_K, block, access.stmt, srcp);
+      }
+      else
+      {
+         offset = CreateIndexOperation(ar->op1, static_cast<long long int>(bank_size), trunc_mod_expr_K, block, access.stmt, srcp);
+      }
+      if(bank >= 0)
+      {
+         TM->ReplaceTreeNode(access.stmt, access.array_ref, create_array_ref(bank_vars[static_cast<size_t>(bank)], offset, srcp));
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Rewritten " + STR(access.stmt));
+         continue;
+      }
+      /// load from a bank not known at compile time: read all the banks and select the right value
+      THROW_ASSERT(not access.is_store, "");
+      tree_nodeRef bank_index;
+      if(power_of_two)
+      {
+         bank_index = CreateIndexOperation(ar->op1, static_cast<long long int>(n_banks - 1), bit_and_expr_K, block, access.stmt, srcp);
+      }
+      else if(cyclic)
+      {
+         bank_index = CreateIndexOperation(ar->op1, static_cast<long long int>(n_banks), trunc_mod_expr_K, block, access.stmt, srcp);
+      }
+      else
+      {
+         bank_index = CreateIndexOperation(ar->op1, static_cast<long long int>(bank_size), trunc_div_expr_K, block, access.stmt, srcp);
+      }
+      std::vector<tree_nodeRef> values;
+      for(const auto& bank_var : bank_vars)
+      {
+         const auto load = tree_man->CreateGimpleAssign(element_type, tree_nodeRef(), tree_nodeRef(), create_array_ref(bank_var, offset, srcp), block->number, srcp);
+         for(const auto& vuse : gn->vuses)
+         {
+            GetPointer<gimple_node>(GET_NODE(load))->AddVuse(vuse);
+         }
+         block->PushBefore(load, access.stmt);
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Created " + STR(load));
+         values.push_back(GetPointer<const gimple_assign>(GET_NODE(load))->op0);
+      }
+      const auto boolean_type = tree_man->create_boolean_type();
+      const auto bank_index_type = GetPointer<const ssa_name>(GET_NODE(bank_index))->type;
+      auto selected = values.back();
+      for(auto bank_var_index = static_cast<long long int>(values.size()) - 2; bank_var_index >= 0; bank_var_index--)
+      {
+         const auto eq = tree_man->create_binary_operation(boolean_type, bank_index, TM->CreateUniqueIntegerCst(bank_var_index, bank_index_type->index), srcp, eq_expr_K);
+         const auto eq_ga = tree_man->CreateGimpleAssign(boolean_type, TM->CreateUniqueIntegerCst(0, boolean_type->index), TM->CreateUniqueIntegerCst(1, boolean_type->index), eq, block->number, srcp);
+         block->PushBefore(eq_ga, access.stmt);
+         const auto cond = tree_man->create_ternary_operation(element_type, GetPointer<const gimple_assign>(GET_NODE(eq_ga))->op0, values[static_cast<size_t>(bank_var_index)], selected, srcp, cond_expr_K);
+         const auto cond_ga = tree_man->CreateGimpleAssign(element_type, tree_nodeRef(), tree_nodeRef(), cond, block->number, srcp);
+         block->PushBefore(cond_ga, access.stmt);
+         selected = GetPointer<const gimple_assign>(GET_NODE(cond_ga))->op0;
+      }
+      TM->ReplaceTreeNode(access.stmt, access.array_ref, selected);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Rewritten " + STR(access.stmt));
+   }
+   return true;
+}
+
+DesignFlowStep_Status ArrayPartitioning::InternalExec()
+{
+   /// the explicitly requested partitionings
+   std::map<std::string, std::pair<PartitionType, unsigned long long int>> requests;
+   if(parameters->IsParameter("array-partition"))
+   {
+      for(const auto& request : SplitString(parameters->GetParameter<std::string>("array-partition"), ","))
+      {
+         const auto fields = SplitString(request, ":");
+         if(fields.size() < 2 or fields.size() > 3)
+         {
+            THROW_ERROR("Malformed array-partition request: " + request);
+         }
+         PartitionType partition_type;
+         if(fields[1] == "cyclic")
+         {
+            partition_type = PartitionType::CYCLIC;
+         }
+         else if(fields[1] == "block")
+         {
+            partition_type = PartitionType::BLOCK;
+         }
+         else if(fields[1] == "complete")
+         {
+            partition_type = PartitionType::COMPLETE;
+         }
+         else
+         {
+            THROW_ERROR("Unknown kind of array partitioning: " + fields[1]);
+         }
+         if(partition_type != PartitionType::COMPLETE and fields.size() != 3)
+         {
+            THROW_ERROR("Number of banks missing in array-partition request: " + request);
+         }
+         unsigned long long int n_banks = 0;
+         if(fields.size() == 3)
+         {
+            if(fields[2].empty() or fields[2].size() > 9 or fields[2].find_first_not_of("0123456789") != std::string::npos or std::stoull(fields[2]) == 0)
+            {
+               THROW_ERROR("Wrong number of banks \"" + fields[2] + "\" in --panda-parameter=array-partition request " + request);
+            }
+            n_banks = std::stoull(fields[2]);
+         }
+         requests[fields[0]] = std::make_pair(partition_type, n_banks);
+      }
+   }
+   const auto memory_policy = parameters->getOption<MemoryAllocation_Policy>(OPT_memory_allocation_policy);
+   const bool automatic = parameters->IsParameter("array-partition-auto") and parameters->GetParameter<unsigned int>("array-partition-auto") == 1 and memory_policy != MemoryAllocation_Policy::NO_BRAM and
+                          memory_policy != MemoryAllocation_Policy::EXT_PIPELINED_BRAM;
+   if(requests.empty() and not automatic)
+   {
+      return DesignFlowStep_Status::UNCHANGED;
+   }
+
+   /// collect the candidate arrays: local one-dimensional arrays of scalars
+   const auto fd = GetPointer<const function_decl>(TM->get_tree_node_const(function_id));
+   const auto sl = GetPointer<const statement_list>(GET_NODE(fd->body));
+   std::map<unsigned int, tree_nodeRef> candidates;
+   for(const auto& block : sl->list_of_bloc)
+   {
+      for(const auto& stmt : block.second->CGetStmtList())
+      {
+         const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+         if(not ga)
+         {
+            continue;
+         }
+         for(const auto& op : {ga->op0, ga->op1})
+         {
+            if(GET_NODE(op)->get_kind() != array_ref_K)
+            {
+               continue;
+            }
+            const auto base = GetPointer<const array_ref>(GET_NODE(op))->op0;
+            const auto vd = GetPointer<const var_decl>(GET_NODE(base));
+            if(not vd or not vd->scpe or GET_INDEX_NODE(vd->scpe) != function_id or vd->extern_flag or vd->addr_taken or tree_helper::is_volatile(TM, base->index))
+            {
+               continue;
+            }
+            const auto type_index = tree_helper::get_type_index(TM, base->index);
+            if(not tree_helper::is_an_array(TM, type_index))
+            {
+               continue;
+            }
+            const auto element_type = TM->CGetTreeNode(tree_helper::GetElements(TM, type_index));
+            if(element_type->get_kind() == array_type_K or element_type->get_kind() == record_type_K or element_type->get_kind() == union_type_K or element_type->get_kind() == vector_type_K)
+            {
+               continue;
+            }
+            candidates[base->index] = base;
+         }
+      }
+   }
+
+   bool modified = false;
+   for(const auto& candidate : candidates)
+   {
+      const auto& var = candidate.second;
+      const auto vd = GetPointer<const var_decl>(GET_NODE(var));
+      const std::string var_name = vd->name ? GetPointer<const identifier_node>(GET_NODE(vd->name))->strg : "";
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing " + STR(var) + " (" + var_name + ")");
+      const bool requested = requests.find(var_name) != requests.end();
+      if(not requested and not automatic)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Not requested");
+         continue;
+      }
+      std::vector<ArrayAccess> accesses;
+      if(not CollectAccesses(var, accesses))
+      {
+         if(requested)
+         {
+            THROW_ERROR("Array " + var_name + " cannot be partitioned as requested by --panda-parameter=array-partition since it is not accessed only through its elements");
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Unsupported accesses");
+         continue;
+      }
+      const unsigned long long int n_elements = tree_helper::get_array_num_elements(TM, tree_helper::get_type_index(TM, var->index));
+      const auto partition_type = requested ? requests.find(var_name)->second.first : PartitionType::CYCLIC;
+      const auto n_banks = requested ? requests.find(var_name)->second.second : ComputeAutomaticFactor(accesses, n_elements);
+      if((partition_type != PartitionType::COMPLETE and n_banks < 2) or not Partition(var, accesses, partition_type, n_banks))
+      {
+         if(requested and (partition_type == PartitionType::COMPLETE or n_banks > 1))
+         {
+            THROW_ERROR("Array " + var_name + " cannot be partitioned as requested by --panda-parameter=array-partition");
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Not partitioned");
+         continue;
+      }
+      modified = true;
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Partitioned");
+   }
+   if(modified)
+   {
+      function_behavior->UpdateBBVersion();
+   }
+   return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
+}
@@ -0,0 +1,183 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file array_partitioning.hpp
+ * @brief Step that splits local arrays into several independent banks
+ *
+ */
+#ifndef ARRAY_PARTITIONING_HPP
+#define ARRAY_PARTITIONING_HPP
+
+/// Superclass include
+#include "function_frontend_flow_step.hpp"
+
+/// tree include
+#include "tree_common.hpp"
+
+/// utility includes
+#include "custom_map.hpp"
+#include "refcount.hpp"
+
+/// STD include
+#include <string>
+#include <vector>
+
+REF_FORWARD_DECL(tree_manager);
+CONSTREF_FORWARD_DECL(tree_manipulation);
+REF_FORWARD_DECL(tree_node);
+REF_FORWARD_DECL(bloc);
+
+/**
+ * Split the local arrays of a function into banks, so that each bank is mapped on its own memory.
+ * The array elements are distributed among the banks in a cyclic (element i goes into bank i % factor),
+ * block (consecutive chunks of size/factor elements) or complete (one bank per element) way.
+ * The partitioning is requested with --panda-parameter=array-partition=<var>:<cyclic|block|complete>[:<factor>][,...]:
+ * a request which cannot be satisfied is an error.
+ * With --panda-parameter=array-partition-auto=1 the other arrays are partitioned too: the cyclic factor is the smallest one
+ * which removes the contention, computed from the residues of the index expressions, when more accesses to the same array
+ * are in the same basic block than the memory ports.
+ */
+class ArrayPartitioning : public FunctionFrontendFlowStep
+{
+ public:
+   /// The way the elements are distributed among the banks
+   enum class PartitionType
+   {
+      CYCLIC,
+      BLOCK,
+      COMPLETE
+   };
+
+ private:
+   /// An access to a candidate array
+   struct ArrayAccess
+   {
+      /// the statement performing the access
+      tree_nodeRef stmt;
+
+      /// the array_ref node
+      tree_nodeRef array_ref;
+
+      /// true if the access is a store
+      bool is_store;
+
+      /// the basic block of the statement
+      unsigned int bb_index;
+   };
+
+   /// The tree manager
+   tree_managerRef TM;
+
+   /// The tree manipulation helper
+   tree_manipulationConstRef tree_man;
+
+   /**
+    * Compute the residue of an index expression modulo a factor
+    * @param index is the index expression
+    * @param factor is the modulus
+    * @param residue is where the residue in [0, factor) is stored
+    * @param assumed stores the residues assumed for the phis under analysis
+    * @param depth is the current depth of the recursion
+    * @return true if the residue is known at compile time
+    */
+   bool ComputeResidue(const tree_nodeRef& index, long long int factor, long long int& residue, CustomUnorderedMap<unsigned int, long long int>& assumed, unsigned int depth) const;
+
+   /**
+    * Collect the accesses to a local array; return false if the array is used in any other way
+    * @param var is the var_decl of the array
+    * @param accesses is where the accesses are stored
+    */
+   bool CollectAccesses(const tree_nodeRef& var, std::vector<ArrayAccess>& accesses) const;
+
+   /**
+    * Choose the cyclic factor of an array from its access pattern
+    * @param accesses are the accesses to the array
+    * @param n_elements is the number of elements of the array
+    * @return the smallest number of banks removing the contention (1 if the array has not to be partitioned)
+    */
+   unsigned long long int ComputeAutomaticFactor(const std::vector<ArrayAccess>& accesses, unsigned long long int n_elements) const;
+
+   /**
+    * Create an ssa_name holding index op_kind constant before a statement
+    * @param index is the index expression
+    * @param constant is the second operand
+    * @param op_kind is the operation
+    * @param block is the basic block of the statement
+    * @param stmt is the statement before which the computation is inserted
+    * @param srcp is the source position
+    */
+   tree_nodeRef CreateIndexOperation(const tree_nodeRef& index, long long int constant, enum kind op_kind, const blocRef& block, const tree_nodeRef& stmt, const std::string& srcp) const;
+
+   /**
+    * Partition an array
+    * @param var is the var_decl of the array
+    * @param accesses are the accesses to the array
+    * @param partition_type is the kind of partitioning
+    * @param n_banks is the number of banks
+    * @return true if the array has been partitioned
+    */
+   bool Partition(const tree_nodeRef& var, const std::vector<ArrayAccess>& accesses, PartitionType partition_type, unsigned long long int n_banks);
+
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor.
+    * @param AppM is the application manager
+    * @param fun_id is the function index
+    * @param design_flow_manager is the design flow manager
+    * @param parameters is the set of the parameters
+    */
+   ArrayPartitioning(const application_managerRef AppM, unsigned int fun_id, const DesignFlowManagerConstRef design_flow_manager, const ParameterConstRef parameters);
+
+   /**
+    * Destructor
+    */
+   ~ArrayPartitioning() override;
+
+   /**
+    * Initialize the step (i.e., like a constructor, but executed just before exec
+    */
+   void Initialize() override;
+
+   /**
+    * Partition the local arrays of the function
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+};
+#endif
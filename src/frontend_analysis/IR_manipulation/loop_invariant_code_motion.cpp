@@ -0,0 +1,318 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file loop_invariant_code_motion.cpp
+ * @brief Step that hoists the loop invariant computations and loads into the loop preheaders
+ *
+ */
+
+/// Header include
+#include "loop_invariant_code_motion.hpp"
+
+///. include
+#include "Parameter.hpp"
+
+/// algorithms/loops_detection includes
+#include "loop.hpp"
+#include "loops.hpp"
+
+/// behavior includes
+#include "application_manager.hpp"
+#include "basic_block.hpp"
+#include "function_behavior.hpp"
+
+/// tree includes
+#include "dbgPrintHelper.hpp"      // for DEBUG_LEVEL_
+#include "string_manipulation.hpp" // for GET_CLASS
+#include "tree_basic_block.hpp"
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
+#include "tree_node.hpp"
+#include "tree_reindex.hpp"
+
+/// STD includes
+#include <algorithm>
+#include <map>
+#include <vector>
+
+/**
+ * Collect the loops of a nest so that each loop follows the loops nested in it
+ * @param loop is the outermost loop of the nest
+ * @param loops is where the loops are stored
+ */
+static void CollectInnermostFirst(const LoopConstRef& loop, std::vector<LoopConstRef>& loops)
+{
+   for(const auto& child : loop->GetChildren())
+   {
+      CollectInnermostFirst(child, loops);
+   }
+   loops.push_back(loop);
+}
+
+LoopInvariantCodeMotion::LoopInvariantCodeMotion(const application_managerRef _AppM, unsigned int _function_id, const DesignFlowManagerConstRef _design_flow_manager, const ParameterConstRef _parameters)
+    : FunctionFrontendFlowStep(_AppM, _function_id, LOOP_INVARIANT_CODE_MOTION, _design_flow_manager, _parameters), sl(nullptr)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+LoopInvariantCodeMotion::~LoopInvariantCodeMotion() = default;
+
+const CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>> LoopInvariantCodeMotion::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> relationships;
+   switch(relationship_type)
+   {
+      case(DEPENDENCE_RELATIONSHIP):
+      {
+         relationships.insert(std::make_pair(BUILD_VIRTUAL_PHI, SAME_FUNCTION));
+         relationships.insert(std::make_pair(DETERMINE_MEMORY_ACCESSES, SAME_FUNCTION));
+         relationships.insert(std::make_pair(DOM_POST_DOM_COMPUTATION, SAME_FUNCTION));
+         relationships.insert(std::make_pair(LOOPS_COMPUTATION, SAME_FUNCTION));
+         relationships.insert(std::make_pair(USE_COUNTING, SAME_FUNCTION));
+         break;
+      }
+      case(INVALIDATION_RELATIONSHIP):
+      {
+         break;
+      }
+      case(PRECEDENCE_RELATIONSHIP):
+      {
+         relationships.insert(std::make_pair(CSE_STEP, SAME_FUNCTION));
+         relationships.insert(std::make_pair(SIMPLE_CODE_MOTION, SAME_FUNCTION));
+         break;
+      }
+      default:
+      {
+         THROW_UNREACHABLE("");
+      }
+   }
+   return relationships;
+}
+
+void LoopInvariantCodeMotion::Initialize()
+{
+   FunctionFrontendFlowStep::Initialize();
+   TM = AppM->get_tree_manager();
+   const auto fd = GetPointer<const function_decl>(TM->get_tree_node_const(function_id));
+   sl = GetPointer<statement_list>(GET_NODE(fd->body));
+}
+
+bool LoopInvariantCodeMotion::Dominates(vertex dominator, vertex dominated) const
+{
+   auto current = dominated;
+   while(current != dominator)
+   {
+      if(boost::in_degree(current, *dom_tree) == 0)
+      {
+         return false;
+      }
+      InEdgeIterator ie, ie_end;
+      boost::tie(ie, ie_end) = boost::in_edges(current, *dom_tree);
+      current = boost::source(*ie, *dom_tree);
+   }
+   return true;
+}
+
+bool LoopInvariantCodeMotion::IsInvariant(const tree_nodeRef& stmt, const CustomUnorderedSet<unsigned int>& loop_bbs, bool speculation_free) const
+{
+   const auto ga = GetPointer<const gimple_assign>(GET_NODE(stmt));
+   if(not ga or ga->clobber or ga->vdef or ga->memdef or not ga->vovers.empty() or GET_NODE(ga->op0)->get_kind() != ssa_name_K)
+   {
+      return false;
+   }
+   if(ga->predicate and (GET_NODE(ga->predicate)->get_kind() != integer_cst_K or tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(GET_NODE(ga->predicate))) == 0))
+   {
+      return false;
+   }
+   const auto right_part = GET_NODE(ga->op1);
+   switch(right_part->get_kind())
+   {
+      case call_expr_K:
+      case aggr_init_expr_K:
+      {
+         return false;
+      }
+      case trunc_div_expr_K:
+      case ceil_div_expr_K:
+      case floor_div_expr_K:
+      case round_div_expr_K:
+      case exact_div_expr_K:
+      case trunc_mod_expr_K:
+      case ceil_mod_expr_K:
+      case floor_mod_expr_K:
+      case round_mod_expr_K:
+      {
+         /// a division by zero must not be introduced on the paths which do not execute it
+         const auto divisor = GET_NODE(GetPointer<const binary_expr>(right_part)->op1);
+         if(not speculation_free and (divisor->get_kind() != integer_cst_K or tree_helper::get_integer_cst_value(GetPointer<const integer_cst>(divisor)) == 0))
+         {
+            return false;
+         }
+         break;
+      }
+      default:
+      {
+         break;
+      }
+   }
+   const auto& fun_mem_data = function_behavior->get_function_mem();
+   if(tree_helper::IsLoad(TM, stmt, fun_mem_data) or not ga->vuses.empty() or ga->memuse)
+   {
+      if(not speculation_free or tree_helper::is_volatile(TM, right_part->index))
+      {
+         return false;
+      }
+      const auto base_index = tree_helper::get_base_index(TM, right_part->index);
+      if(base_index and tree_helper::is_volatile(TM, base_index))
+      {
+         return false;
+      }
+   }
+   /// the used ssa variables, the virtual ones included, have to be defined outside the loop
+   for(const auto& use : tree_helper::ComputeSsaUses(stmt))
+   {
+      const auto sn = GetPointer<const ssa_name>(GET_NODE(use.first));
+      for(const auto& def_stmt : sn->CGetDefStmts())
+      {
+         const auto def = GetPointer<const gimple_node>(GET_NODE(def_stmt));
+         if(def and loop_bbs.find(def->bb_index) != loop_bbs.end())
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+bool LoopInvariantCodeMotion::HoistInvariants(const LoopConstRef& loop)
+{
+   const auto bb_graph = function_behavior->CGetBBGraph(FunctionBehavior::BB);
+   CustomUnorderedSet<vertex> loop_vertices;
+   loop->get_recursively_bb(loop_vertices);
+   /// the basic blocks of the loop sorted by index, so that the hoisted statements are always appended in the same order
+   std::map<unsigned int, vertex> sorted_bbs;
+   CustomUnorderedSet<unsigned int> loop_bbs;
+   for(const auto loop_vertex : loop_vertices)
+   {
+      const auto bb_index = bb_graph->CGetBBNodeInfo(loop_vertex)->block->number;
+      sorted_bbs[bb_index] = loop_vertex;
+      loop_bbs.insert(bb_index);
+   }
+
+   const auto header = bb_graph->CGetBBNodeInfo(loop->GetHeader())->block;
+   std::vector<unsigned int> outside_preds;
+   std::copy_if(header->list_of_pred.begin(), header->list_of_pred.end(), std::back_inserter(outside_preds), [&](unsigned int pred) { return loop_bbs.find(pred) == loop_bbs.end(); });
+   if(outside_preds.size() != 1 or outside_preds.front() == bloc::ENTRY_BLOCK_ID)
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Loop " + STR(loop->GetId()) + " has not a preheader");
+      return false;
+   }
+   const auto preheader = sl->list_of_bloc.at(outside_preds.front());
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing loop " + STR(loop->GetId()) + " with header BB" + STR(header->number) + " and preheader BB" + STR(preheader->number));
+
+   /// the basic blocks executed at each iteration are the ones dominating all the exits
+   CustomUnorderedSet<unsigned int> speculation_free_bbs;
+   if(preheader->list_of_succ.size() == 1 and loop->num_exits() != 0)
+   {
+      for(const auto& sorted_bb : sorted_bbs)
+      {
+         if(std::all_of(loop->exit_block_iter_begin(), loop->exit_block_iter_end(), [&](vertex exit) { return Dominates(sorted_bb.second, exit); }))
+         {
+            speculation_free_bbs.insert(sorted_bb.first);
+         }
+      }
+   }
+
+   bool modified = false;
+   bool restart = true;
+   while(restart)
+   {
+      restart = false;
+      for(const auto& sorted_bb : sorted_bbs)
+      {
+         const auto block = sl->list_of_bloc.at(sorted_bb.first);
+         const bool speculation_free = speculation_free_bbs.find(sorted_bb.first) != speculation_free_bbs.end();
+         const auto stmt_list = block->CGetStmtList();
+         for(const auto& stmt : stmt_list)
+         {
+            if(not IsInvariant(stmt, loop_bbs, speculation_free))
+            {
+               continue;
+            }
+#ifndef NDEBUG
+            if(not AppM->ApplyNewTransformation())
+            {
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Reached limit of transformations");
+               return modified;
+            }
+#endif
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Hoisting " + GET_NODE(stmt)->ToString() + " from BB" + STR(block->number));
+            block->RemoveStmt(stmt);
+            preheader->PushBack(stmt);
+#ifndef NDEBUG
+            AppM->RegisterTransformation(GetName(), stmt);
+#endif
+            modified = true;
+            restart = true;
+         }
+      }
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Analyzed loop " + STR(loop->GetId()));
+   return modified;
+}
+
+DesignFlowStep_Status LoopInvariantCodeMotion::InternalExec()
+{
+   if(parameters->IsParameter("licm") and parameters->GetParameter<int>("licm") == 0)
+   {
+      return DesignFlowStep_Status::UNCHANGED;
+   }
+   dom_tree = function_behavior->CGetBBGraph(FunctionBehavior::DOM_TREE);
+   /// the innermost loops are processed first, so that the statements hoisted from them can be further hoisted from the outer ones
+   std::vector<LoopConstRef> loops;
+   CollectInnermostFirst(function_behavior->CGetLoops()->CGetLoop(0), loops);
+   bool modified = false;
+   for(const auto& loop : loops)
+   {
+      if(loop->GetId() == 0 or not loop->IsReducible())
+      {
+         continue;
+      }
+      modified |= HoistInvariants(loop);
+   }
+   if(modified)
+   {
+      function_behavior->UpdateBBVersion();
+   }
+   return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
+}
@@ -0,0 +1,135 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file loop_invariant_code_motion.hpp
+ * @brief Step that hoists the loop invariant computations and loads into the loop preheaders
+ *
+ */
+#ifndef LOOP_INVARIANT_CODE_MOTION_HPP
+#define LOOP_INVARIANT_CODE_MOTION_HPP
+
+/// Superclass include
+#include "function_frontend_flow_step.hpp"
+
+/// graph include
+#include "graph.hpp"
+
+/// utility includes
+#include "custom_set.hpp"
+#include "refcount.hpp"
+
+CONSTREF_FORWARD_DECL(BBGraph);
+CONSTREF_FORWARD_DECL(Loop);
+REF_FORWARD_DECL(tree_manager);
+REF_FORWARD_DECL(tree_node);
+class statement_list;
+
+/**
+ * Loop invariant code motion on the tree IR.
+ * The loops are processed from the innermost; a statement of a loop is moved at the end of the preheader
+ * (i.e., the unique basic block outside the loop which precedes the header) when all the ssa variables it uses,
+ * the virtual ones included, are defined outside the loop.
+ * Since the virtual ssa variables built by BuildVirtualPhi link each load to the stores which may alias it,
+ * a load whose virtual uses are all defined outside the loop does not depend on any store of the loop and can be hoisted too;
+ * loads and integer divisions by non constant values are moved only when they are executed at each iteration
+ * and the preheader has the header as unique successor, so that they are never speculated.
+ * The step can be disabled with --panda-parameter=licm=0.
+ */
+class LoopInvariantCodeMotion : public FunctionFrontendFlowStep
+{
+ private:
+   /// The tree manager
+   tree_managerRef TM;
+
+   /// The statement list of the function
+   statement_list* sl;
+
+   /// The dominator tree of the basic blocks
+   BBGraphConstRef dom_tree;
+
+   /**
+    * Check if a basic block dominates another one
+    * @param dominator is the candidate dominator
+    * @param dominated is the candidate dominated basic block
+    */
+   bool Dominates(vertex dominator, vertex dominated) const;
+
+   /**
+    * Check if a statement can be executed in the preheader of a loop
+    * @param stmt is the statement
+    * @param loop_bbs are the indices of the basic blocks of the loop (nested loops included)
+    * @param speculation_free is true if the statement is executed at each iteration of the loop and whenever the preheader is executed,
+    * so that also loads and divisions can be moved
+    */
+   bool IsInvariant(const tree_nodeRef& stmt, const CustomUnorderedSet<unsigned int>& loop_bbs, bool speculation_free) const;
+
+   /**
+    * Hoist the invariant statements of a loop into its preheader
+    * @param loop is the loop
+    * @return true if at least a statement has been moved
+    */
+   bool HoistInvariants(const LoopConstRef& loop);
+
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>> ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+ public:
+   /**
+    * Constructor.
+    * @param AppM is the application manager
+    * @param fun_id is the function index
+    * @param design_flow_manager is the design flow manager
+    * @param parameters is the set of the parameters
+    */
+   LoopInvariantCodeMotion(const application_managerRef AppM, unsigned int fun_id, const DesignFlowManagerConstRef design_flow_manager, const ParameterConstRef parameters);
+
+   /**
+    * Destructor
+    */
+   ~LoopInvariantCodeMotion() override;
+
+   /**
+    * Initialize the step (i.e., like a constructor, but executed just before exec
+    */
+   void Initialize() override;
+
+   /**
+    * Hoist the loop invariant statements of the function
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status InternalExec() override;
+};
+#endif
@@ -83,6 +83,9 @@ const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFl
       case ADD_OP_PHI_FLOW_EDGES:
 #endif
       case AGGREGATE_DATA_FLOW_ANALYSIS:
+#if HAVE_BAMBU_BUILT
+      case ARRAY_PARTITIONING:
+#endif
 #if HAVE_ZEBU_BUILT
       case(ARRAY_REF_FIX):
 #endif
@@ -166,6 +169,9 @@ const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFl
       case IR_LOWERING:
 #endif
       case LOOP_COMPUTATION:
+#if HAVE_BAMBU_BUILT
+      case LOOP_INVARIANT_CODE_MOTION:
+#endif
 #if HAVE_ZEBU_BUILT
       case LOOP_REGIONS_COMPUTATION:
       case LOOP_REGIONS_FLOW_COMPUTATION:
@@ -215,6 +221,9 @@ const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFl
       case PREDICTABILITY_ANALYSIS:
       case PROBABILITY_PATH:
 #endif
+#if HAVE_BAMBU_BUILT
+      case RANGE_ANALYSIS:
+#endif
 #if HAVE_BAMBU_BUILT
       case REBUILD_INITIALIZATION:
       case REBUILD_INITIALIZATION2:
@@ -263,7 +272,7 @@ const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFl
 #if HAVE_BAMBU_BUILT
       case UN_COMPARISON_LOWERING:
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
       case UNROLL_LOOPS:
 #endif
 #if HAVE_RTL_BUILT && HAVE_ZEBU_BUILT
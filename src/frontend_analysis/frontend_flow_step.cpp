@@ -157,6 +157,10 @@ const std::string FrontendFlowStep::EnumToKindText(const FrontendFlowStepType fr
 #endif
       case(AGGREGATE_DATA_FLOW_ANALYSIS):
          return "AggregateDataFlowAnalysis";
+#if HAVE_BAMBU_BUILT
+      case(ARRAY_PARTITIONING):
+         return "ArrayPartitioning";
+#endif
 #if HAVE_ZEBU_BUILT
       case(ARRAY_REF_FIX):
          return "ArrayRefFix";
@@ -325,6 +329,10 @@ const std::string FrontendFlowStep::EnumToKindText(const FrontendFlowStepType fr
 #endif
       case(LOOP_COMPUTATION):
          return "LoopComputation";
+#if HAVE_BAMBU_BUILT
+      case(LOOP_INVARIANT_CODE_MOTION):
+         return "LoopInvariantCodeMotion";
+#endif
 #if HAVE_ZEBU_BUILT
       case(LOOP_REGIONS_COMPUTATION):
          return "LoopRegionsComputation";
@@ -409,6 +417,10 @@ const std::string FrontendFlowStep::EnumToKindText(const FrontendFlowStepType fr
       case(PROBABILITY_PATH):
          return "ProbabilityPath";
 #endif
+#if HAVE_BAMBU_BUILT
+      case(RANGE_ANALYSIS):
+         return "RangeAnalysis";
+#endif
 #if HAVE_BAMBU_BUILT
       case(REBUILD_INITIALIZATION):
          return "RebuildInitialization";
@@ -488,7 +500,7 @@ const std::string FrontendFlowStep::EnumToKindText(const FrontendFlowStepType fr
       case UN_COMPARISON_LOWERING:
          return "UnComparisonLowering";
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
       case(UNROLL_LOOPS):
          return "UnrollLoops";
 #endif
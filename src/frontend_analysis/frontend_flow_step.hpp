@@ -116,6 +116,9 @@ typedef enum
    ADD_OP_PHI_FLOW_EDGES,
 #endif
    AGGREGATE_DATA_FLOW_ANALYSIS,
+#if HAVE_BAMBU_BUILT
+   ARRAY_PARTITIONING,
+#endif
 #if HAVE_ZEBU_BUILT
    ARRAY_REF_FIX,
 #endif
@@ -214,6 +217,9 @@ typedef enum
    IR_LOWERING,
 #endif
    LOOP_COMPUTATION,
+#if HAVE_BAMBU_BUILT
+   LOOP_INVARIANT_CODE_MOTION,
+#endif
 #if HAVE_ZEBU_BUILT
    LOOP_REGIONS_COMPUTATION,
    LOOP_REGIONS_FLOW_COMPUTATION,
@@ -268,6 +274,9 @@ typedef enum
 #if HAVE_ZEBU_BUILT
    PROBABILITY_PATH,
 #endif
+#if HAVE_BAMBU_BUILT
+   RANGE_ANALYSIS,
+#endif
 #if HAVE_BAMBU_BUILT
    REBUILD_INITIALIZATION,
    REBUILD_INITIALIZATION2,
@@ -317,7 +326,7 @@ typedef enum
 #if HAVE_BAMBU_BUILT
    UN_COMPARISON_LOWERING,
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
    UNROLL_LOOPS,
 #endif
 #if HAVE_BAMBU_BUILT
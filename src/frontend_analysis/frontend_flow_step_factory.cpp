@@ -73,6 +73,9 @@
 #include "add_op_phi_flow_edges.hpp"
 #endif
 #include "aggregate_data_flow_analysis.hpp"
+#if HAVE_BAMBU_BUILT
+#include "array_partitioning.hpp"
+#endif
 #if HAVE_ZEBU_BUILT
 #include "array_ref_fix.hpp"
 #endif
@@ -188,6 +191,9 @@
 #include "loops_analysis_zebu.hpp"
 #endif
 #include "loops_computation.hpp"
+#if HAVE_BAMBU_BUILT
+#include "loop_invariant_code_motion.hpp"
+#endif
 #if HAVE_ZEBU_BUILT
 #include "loops_rebuilding.hpp"
 #endif
@@ -235,6 +241,9 @@
 #include "host_profiling.hpp"
 #endif
 #if HAVE_BAMBU_BUILT
+#include "range_analysis.hpp"
+#endif
+#if HAVE_BAMBU_BUILT
 #include "rebuild_initializations.hpp"
 #endif
 #if HAVE_BAMBU_BUILT && HAVE_EXPERIMENTAL
@@ -284,7 +293,7 @@
 #if HAVE_BAMBU_BUILT
 #include "un_comparison_lowering.hpp"
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
 #include "unroll_loops.hpp"
 #endif
 #if HAVE_ZEBU_BUILT && HAVE_RTL_BUILT
@@ -353,6 +362,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::GenerateFrontendStep(FrontendFl
       case ADD_OP_PHI_FLOW_EDGES:
 #endif
       case AGGREGATE_DATA_FLOW_ANALYSIS:
+#if HAVE_BAMBU_BUILT
+      case ARRAY_PARTITIONING:
+#endif
 #if HAVE_ZEBU_BUILT
       case(ARRAY_REF_FIX):
 #endif
@@ -436,6 +448,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::GenerateFrontendStep(FrontendFl
       case IR_LOWERING:
 #endif
       case LOOP_COMPUTATION:
+#if HAVE_BAMBU_BUILT
+      case LOOP_INVARIANT_CODE_MOTION:
+#endif
 #if HAVE_ZEBU_BUILT
       case LOOP_REGIONS_COMPUTATION:
       case LOOP_REGIONS_FLOW_COMPUTATION:
@@ -485,6 +500,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::GenerateFrontendStep(FrontendFl
       case PREDICTABILITY_ANALYSIS:
       case PROBABILITY_PATH:
 #endif
+#if HAVE_BAMBU_BUILT
+      case RANGE_ANALYSIS:
+#endif
 #if HAVE_BAMBU_BUILT
       case REBUILD_INITIALIZATION:
       case REBUILD_INITIALIZATION2:
@@ -545,7 +563,7 @@ const DesignFlowStepRef FrontendFlowStepFactory::GenerateFrontendStep(FrontendFl
 #if HAVE_BAMBU_BUILT
       case UNROLLING_DEGREE:
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
       case UNROLL_LOOPS:
 #endif
       case USE_COUNTING:
@@ -747,6 +765,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateApplicationFrontendFlowSt
       case ADD_OP_PHI_FLOW_EDGES:
 #endif
       case AGGREGATE_DATA_FLOW_ANALYSIS:
+#if HAVE_BAMBU_BUILT
+      case ARRAY_PARTITIONING:
+#endif
 #if HAVE_ZEBU_BUILT
       case(ARRAY_REF_FIX):
 #endif
@@ -830,6 +851,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateApplicationFrontendFlowSt
       case IR_LOWERING:
 #endif
       case LOOP_COMPUTATION:
+#if HAVE_BAMBU_BUILT
+      case LOOP_INVARIANT_CODE_MOTION:
+#endif
 #if HAVE_ZEBU_BUILT
       case LOOP_REGIONS_COMPUTATION:
       case LOOP_REGIONS_FLOW_COMPUTATION:
@@ -879,6 +903,9 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateApplicationFrontendFlowSt
       case PREDICTABILITY_ANALYSIS:
       case PROBABILITY_PATH:
 #endif
+#if HAVE_BAMBU_BUILT
+      case RANGE_ANALYSIS:
+#endif
 #if HAVE_BAMBU_BUILT
       case REBUILD_INITIALIZATION:
       case REBUILD_INITIALIZATION2:
@@ -925,7 +952,7 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateApplicationFrontendFlowSt
 #if HAVE_BAMBU_BUILT
       case UN_COMPARISON_LOWERING:
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
       case UNROLL_LOOPS:
 #endif
 #if HAVE_BAMBU_BUILT
@@ -1006,6 +1033,12 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateFunctionFrontendFlowStep(
       {
          return DesignFlowStepRef(new AggregateDataFlowAnalysis(AppM, function_id, design_flow_manager.lock(), parameters));
       }
+#if HAVE_BAMBU_BUILT
+      case ARRAY_PARTITIONING:
+      {
+         return DesignFlowStepRef(new ArrayPartitioning(AppM, function_id, design_flow_manager.lock(), parameters));
+      }
+#endif
 #if HAVE_ZEBU_BUILT
       case(ARRAY_REF_FIX):
       {
@@ -1222,6 +1255,12 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateFunctionFrontendFlowStep(
       {
          return DesignFlowStepRef(new loops_computation(parameters, AppM, function_id, design_flow_manager.lock()));
       }
+#if HAVE_BAMBU_BUILT
+      case LOOP_INVARIANT_CODE_MOTION:
+      {
+         return DesignFlowStepRef(new LoopInvariantCodeMotion(AppM, function_id, design_flow_manager.lock(), parameters));
+      }
+#endif
 #if HAVE_ZEBU_BUILT
       case LOOP_REGIONS_COMPUTATION:
       {
@@ -1348,6 +1387,12 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateFunctionFrontendFlowStep(
          return DesignFlowStepRef(new probability_path(parameters, AppM, function_id, design_flow_manager.lock()));
       }
 #endif
+#if HAVE_BAMBU_BUILT
+      case RANGE_ANALYSIS:
+      {
+         return DesignFlowStepRef(new RangeAnalysis(parameters, AppM, function_id, design_flow_manager.lock()));
+      }
+#endif
 #if HAVE_BAMBU_BUILT
       case REBUILD_INITIALIZATION:
       {
@@ -1455,7 +1500,7 @@ const DesignFlowStepRef FrontendFlowStepFactory::CreateFunctionFrontendFlowStep(
          return DesignFlowStepRef(new UnComparisonLowering(AppM, function_id, design_flow_manager.lock(), parameters));
       }
 #endif
-#if HAVE_EXPERIMENTAL && HAVE_FROM_PRAGMA_BUILT && HAVE_BAMBU_BUILT
+#if HAVE_BAMBU_BUILT
       case UNROLL_LOOPS:
       {
          return DesignFlowStepRef(new UnrollLoops(AppM, function_id, design_flow_manager.lock(), parameters));
@@ -52,6 +52,7 @@
 
 /// Tree include
 #include "token_interface.hpp"
+#include "tree_binary_reader.hpp"
 
 /// Utility include
 #include "exceptions.hpp"
@@ -86,6 +87,9 @@ struct TreeFlexLexer : public yyFlexLexer
 
    treeVocabularyTokenTypes* tokens;
 
+   /// the reader of the binary dump (null when the textual dump is lexed)
+   TreeBinaryReaderRef binary_reader;
+
    TreeVocabularyTokenTypes_TokenEnum bison2token(int) const;
 };
 
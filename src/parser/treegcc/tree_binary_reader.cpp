@@ -0,0 +1,240 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file tree_binary_reader.cpp
+ * @brief Implementation of the reader of the binary interchange format of the GIMPLE dumps
+ *
+ */
+
+/// Header include
+#include "tree_binary_reader.hpp"
+
+/// parser/treegcc include
+#include "token_interface.hpp"
+
+/// STD include
+#include <cstring>
+#include <fstream>
+
+/// Utility include
+#include "exceptions.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TreeBinaryReader::TreeBinaryReader(const std::string& _file_name, const treeVocabularyTokenTypes* _tokens)
+    : tokens(_tokens), begin(nullptr), end(nullptr), current(nullptr), record_end(nullptr), mapped_size(0), file_name(_file_name)
+{
+#ifndef _WIN32
+   const int fd = open(file_name.c_str(), O_RDONLY);
+   if(fd < 0)
+   {
+      THROW_ERROR("FILE does not exist: " + file_name);
+   }
+   struct stat file_stat;
+   if(fstat(fd, &file_stat) == 0 and file_stat.st_size > 0)
+   {
+      void* mapped = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if(mapped != MAP_FAILED)
+      {
+         mapped_size = static_cast<size_t>(file_stat.st_size);
+         begin = static_cast<const unsigned char*>(mapped);
+         madvise(mapped, mapped_size, MADV_SEQUENTIAL);
+      }
+   }
+   close(fd);
+#endif
+   if(not begin)
+   {
+      std::ifstream input(file_name, std::ios::binary);
+      if(input.fail())
+      {
+         THROW_ERROR("FILE does not exist: " + file_name);
+      }
+      buffer.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+      begin = buffer.data();
+      end = begin + buffer.size();
+   }
+   else
+   {
+      end = begin + mapped_size;
+   }
+   if(static_cast<size_t>(end - begin) < TREE_BINARY_MAGIC_LENGTH + 4 or memcmp(begin, TREE_BINARY_MAGIC, TREE_BINARY_MAGIC_LENGTH) != 0)
+   {
+      Error("not a binary dump");
+   }
+   current = begin + TREE_BINARY_MAGIC_LENGTH;
+   const auto version = static_cast<unsigned int>(current[0]) | (static_cast<unsigned int>(current[1]) << 8) | (static_cast<unsigned int>(current[2]) << 16) | (static_cast<unsigned int>(current[3]) << 24);
+   if(version != TREE_BINARY_VERSION)
+   {
+      Error("unsupported version " + std::to_string(version) + " (expected " + std::to_string(TREE_BINARY_VERSION) + ")");
+   }
+   current += 4;
+}
+
+TreeBinaryReader::~TreeBinaryReader()
+{
+#ifndef _WIN32
+   if(mapped_size)
+   {
+      munmap(const_cast<unsigned char*>(begin), mapped_size);
+   }
+#endif
+}
+
+bool TreeBinaryReader::IsBinaryDump(const std::string& file_name)
+{
+   std::ifstream input(file_name, std::ios::binary);
+   char magic[TREE_BINARY_MAGIC_LENGTH];
+   return input.read(magic, TREE_BINARY_MAGIC_LENGTH) and memcmp(magic, TREE_BINARY_MAGIC, TREE_BINARY_MAGIC_LENGTH) == 0;
+}
+
+void TreeBinaryReader::Error(const std::string& msg) const
+{
+   THROW_ERROR("Malformed binary dump " + file_name + " at offset " + std::to_string(current - begin) + ": " + msg);
+}
+
+unsigned long long int TreeBinaryReader::ReadVarint()
+{
+   const unsigned char* limit = record_end ? record_end : end;
+   unsigned long long int value = 0;
+   unsigned int shift = 0;
+   while(current < limit and shift < 64)
+   {
+      const unsigned char byte = *current++;
+      value |= static_cast<unsigned long long int>(byte & 0x7F) << shift;
+      if(not(byte & 0x80))
+      {
+         return value;
+      }
+      shift += 7;
+   }
+   Error("truncated integer");
+   return 0;
+}
+
+size_t TreeBinaryReader::ReadStringIndex()
+{
+   const auto index = ReadVarint();
+   if(index >= strings.size())
+   {
+      Error("reference to undefined string " + std::to_string(index));
+   }
+   return static_cast<size_t>(index);
+}
+
+void TreeBinaryReader::NextToken(TreeBinaryToken& token)
+{
+   while(not record_end or current == record_end)
+   {
+      record_end = nullptr;
+      if(current == end)
+      {
+         token.kind = TreeBinaryToken::END_OF_FILE;
+         return;
+      }
+      const unsigned char tag = *current++;
+      const auto length = ReadVarint();
+      if(length > static_cast<unsigned long long int>(end - current))
+      {
+         Error("truncated record");
+      }
+      if(tag == TREE_BINARY_STRING)
+      {
+         strings.push_back("\"" + std::string(reinterpret_cast<const char*>(current), static_cast<size_t>(length)) + "\"");
+         keywords.push_back(-2);
+         current += length;
+      }
+      else if(tag == TREE_BINARY_HEADER or tag == TREE_BINARY_NODE)
+      {
+         record_end = current + length;
+         if(tag == TREE_BINARY_NODE and (length == 0 or *current != TREE_BINARY_NODE_ID))
+         {
+            Error("node record not starting with the node index");
+         }
+      }
+      else
+      {
+         Error("unknown record " + std::to_string(static_cast<unsigned int>(tag)));
+      }
+   }
+   const unsigned char tag = *current++;
+   switch(tag)
+   {
+      case TREE_BINARY_KEYWORD:
+      {
+         const auto index = ReadStringIndex();
+         if(keywords[index] == -2)
+         {
+            const auto& quoted = strings[index];
+            keywords[index] = tokens->check_tokens(quoted.substr(1, quoted.size() - 2).c_str());
+         }
+         if(keywords[index] < 0)
+         {
+            Error("unrecognized keyword " + strings[index]);
+         }
+         token.kind = TreeBinaryToken::KEYWORD;
+         token.keyword = keywords[index];
+         break;
+      }
+      case TREE_BINARY_NUMBER:
+      {
+         const auto value = ReadVarint();
+         token.kind = TreeBinaryToken::NUMBER;
+         token.number = static_cast<long long int>(value >> 1) ^ -static_cast<long long int>(value & 1);
+         break;
+      }
+      case TREE_BINARY_NODE_ID:
+      {
+         token.kind = TreeBinaryToken::NODE_ID;
+         token.number = static_cast<long long int>(ReadVarint());
+         break;
+      }
+      case TREE_BINARY_STRING_VALUE:
+      {
+         token.kind = TreeBinaryToken::STRING;
+         token.text = strings[ReadStringIndex()].c_str();
+         break;
+      }
+      default:
+         Error("unknown token " + std::to_string(static_cast<unsigned int>(tag)));
+   }
+   if(current > record_end)
+   {
+      Error("token crossing the record boundary");
+   }
+}
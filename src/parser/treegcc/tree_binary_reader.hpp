@@ -0,0 +1,190 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file tree_binary_reader.hpp
+ * @brief Reader of the binary interchange format of the GIMPLE dumps produced by the compiler plugins
+ *
+ * The binary dump (written by the plugins when -panda-binary-dump is passed) contains the same information of the textual raw file,
+ * already split into tokens, so that it can be fed to the tree parser without running the lexer.
+ * Layout of the file (all the integers are unsigned LEB128 varints unless otherwise stated):
+ *  - the magic number TREE_BINARY_MAGIC followed by the format version as a little endian 32-bit integer;
+ *  - a sequence of records, each one starting with a single byte tag:
+ *     - TREE_BINARY_STRING: length and bytes of a string; the strings are numbered in order of definition (interned string table)
+ *     - TREE_BINARY_HEADER: length of the payload and the tokens of the file header (versions of the compiler and of the plugin)
+ *     - TREE_BINARY_NODE: length of the payload and the tokens of a node; the first token is always the node index
+ *  - each token starts with a single byte tag:
+ *     - TREE_BINARY_KEYWORD: index of the string representing the keyword (node kind, field name or flag)
+ *     - TREE_BINARY_NUMBER: zigzag-encoded signed integer
+ *     - TREE_BINARY_NODE_ID: index of the referenced node
+ *     - TREE_BINARY_STRING_VALUE: index of the string representing the value (escaped as in the textual format)
+ * The constants must be kept aligned with the writer in etc/clang_plugin/dumpGimple.cpp.
+ *
+ */
+#ifndef TREE_BINARY_READER_HPP
+#define TREE_BINARY_READER_HPP
+
+/// STD include
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+/// Utility include
+#include "refcount.hpp"
+
+class treeVocabularyTokenTypes;
+
+/// Magic number identifying a binary dump
+#define TREE_BINARY_MAGIC "\x89PANDAGB"
+/// Length of the magic number
+#define TREE_BINARY_MAGIC_LENGTH 8
+/// Version of the binary format
+#define TREE_BINARY_VERSION 1
+
+/// Record tags
+#define TREE_BINARY_STRING 1
+#define TREE_BINARY_HEADER 2
+#define TREE_BINARY_NODE 3
+
+/// Token tags
+#define TREE_BINARY_KEYWORD 1
+#define TREE_BINARY_NUMBER 2
+#define TREE_BINARY_NODE_ID 3
+#define TREE_BINARY_STRING_VALUE 4
+
+/**
+ * Token extracted from a binary dump
+ */
+struct TreeBinaryToken
+{
+   enum kind_t
+   {
+      END_OF_FILE,
+      KEYWORD,
+      NUMBER,
+      NODE_ID,
+      STRING
+   };
+
+   /// kind of the token
+   kind_t kind;
+
+   /// bison token of the keyword
+   int keyword;
+
+   /// value of the number or of the node index
+   long long int number;
+
+   /// the string including the enclosing double quotes, as produced by the lexer
+   const char* text;
+};
+
+/**
+ * Memory mapped reader of a binary dump
+ */
+class TreeBinaryReader
+{
+ private:
+   /// the vocabulary used to translate the keywords into bison tokens
+   const treeVocabularyTokenTypes* tokens;
+
+   /// the content of the file
+   const unsigned char* begin;
+
+   /// the end of the content of the file
+   const unsigned char* end;
+
+   /// the current position
+   const unsigned char* current;
+
+   /// the end of the payload of the current record (nullptr if outside any record)
+   const unsigned char* record_end;
+
+   /// the size of the mapping
+   size_t mapped_size;
+
+   /// the buffer storing the file when it cannot be mapped
+   std::vector<unsigned char> buffer;
+
+   /// the interned strings enclosed in double quotes (a deque, so that the texts returned by NextToken stay valid)
+   std::deque<std::string> strings;
+
+   /// the bison tokens of the interned strings used as keywords (-2 if not yet computed)
+   std::vector<int> keywords;
+
+   /// the name of the file
+   const std::string file_name;
+
+   /**
+    * Decode an unsigned varint
+    */
+   unsigned long long int ReadVarint();
+
+   /**
+    * Decode the index of an interned string
+    */
+   size_t ReadStringIndex();
+
+   /**
+    * Report a malformed file
+    */
+   void Error(const std::string& msg) const;
+
+ public:
+   /**
+    * Constructor
+    * @param file_name is the name of the binary dump
+    * @param tokens is the vocabulary used to translate the keywords
+    */
+   TreeBinaryReader(const std::string& file_name, const treeVocabularyTokenTypes* tokens);
+
+   /**
+    * Destructor
+    */
+   ~TreeBinaryReader();
+
+   /**
+    * Return true if the file is a binary dump
+    * @param file_name is the name of the file
+    */
+   static bool IsBinaryDump(const std::string& file_name);
+
+   /**
+    * Extract the next token
+    * @param token is where the token is stored
+    */
+   void NextToken(TreeBinaryToken& token);
+};
+typedef refcount<TreeBinaryReader> TreeBinaryReaderRef;
+
+#endif
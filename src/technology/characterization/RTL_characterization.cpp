@@ -58,11 +58,16 @@
 /// HLS/module_allocation include
 #include "allocation_information.hpp"
 
-/// STD include
+/// Boost include
+#include <boost/functional/hash/hash.hpp>
+
+/// STD includes
+#include <sstream>
 #include <string>
 
 /// STL includes
 #include <algorithm>
+#include <limits>
 #include <list>
 
 /// technology include
@@ -86,6 +91,7 @@
 #include "time_model.hpp"
 
 #include "BackendFlow.hpp"
+#include "SynthesisJobRunner.hpp"
 
 #include "HDL_manager.hpp"
 #include "language_writer.hpp"
@@ -106,7 +112,8 @@ RTLCharacterization::RTLCharacterization(const target_managerRef _target, const
     : DesignFlowStep(_design_flow_manager, _parameters),
       FunctionalUnitStep(_target, _design_flow_manager, _parameters),
       component(ComputeComponent(_cells)),
-      cells(ComputeCells(_cells))
+      cells(ComputeCells(_cells)),
+      prev_cell(std::numeric_limits<size_t>::max())
 #ifndef NDEBUG
       ,
       dummy_synthesis(_parameters->IsParameter("dummy_synthesis") and _parameters->GetParameter<std::string>("dummy_synthesis") == "yes")
@@ -121,8 +128,9 @@ void RTLCharacterization::Initialize()
 {
    FunctionalUnitStep::Initialize();
    LM = TM->get_library_manager(TM->get_library(component));
-   prev_area_characterization = area_modelRef();
-   prev_timing_characterization = time_modelRef();
+   runner = SynthesisJobRunnerRef(new SynthesisJobRunner(parameters));
+   pending_cells.clear();
+   prev_cell = std::numeric_limits<size_t>::max();
 }
 
 DesignFlowStep_Status RTLCharacterization::Exec()
@@ -130,7 +138,14 @@ DesignFlowStep_Status RTLCharacterization::Exec()
    const target_deviceRef device = target->get_target_device();
 
    const auto functional_unit = LM->get_fu(component);
+   /// the cells are specialized and their synthesis scripts generated in sequence, then the syntheses are executed concurrently
    AnalyzeFu(functional_unit);
+   runner->Run();
+   for(const auto& cell : pending_cells)
+   {
+      CompleteCell(cell);
+   }
+   pending_cells.clear();
    // fix_execution_time_std();
    fix_proxies_execution_time_std();
    // if(is_xilinx) fix_muxes();
@@ -997,113 +1012,133 @@ void RTLCharacterization::AnalyzeCell(functional_unit* fu, const unsigned int pr
 #endif
       /// generate the synthesis scripts
       BackendFlowRef flow = BackendFlow::CreateFlow(parameters, "Characterization", target);
-      flow->GenerateSynthesisScripts(fu->get_name(), SM, hdl_files, aux_files);
-      PRINT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "Performing characterization of functional unit " + fu_name);
-#ifndef NDEBUG
-      if(not dummy_synthesis)
-#endif
+      /// the generated files contain time stamps and random memory initializations, so the cell is identified by its specialization
+      /// and by the hash of its HDL descriptions, so that a modified cell is synthesized again
+      std::string hdl_descriptions;
+      for(const auto description_type : {NP_functionality::VERILOG_PROVIDED, NP_functionality::VHDL_PROVIDED, NP_functionality::SYSTEM_VERILOG_PROVIDED, NP_functionality::VERILOG_GENERATOR, NP_functionality::VHDL_GENERATOR,
+                                         NP_functionality::FLOPOCO_PROVIDED, NP_functionality::VERILOG_FILE_PROVIDED, NP_functionality::VHDL_FILE_PROVIDED, NP_functionality::LIBRARY})
       {
-         if(constPort < n_ports && is_commutative && constPort > has_first_synthesis_id && prev_area_characterization && prev_timing_characterization)
-            fu->area_m = prev_area_characterization;
-         else
-         {
-            flow->ExecuteSynthesis();
-            has_first_synthesis_id = constPort;
-            /// the synthesis has been successfully completed
-            /// setting the used resources
-            fu->area_m = flow->get_used_resources();
-         }
+         const auto description = NPF ? NPF->get_NP_functionality(description_type) : std::string();
+         hdl_descriptions += STR(description.size()) + ":" + description + "\n";
       }
-#ifndef NDEBUG
-      else
+      std::stringstream hdl_hash;
+      hdl_hash << std::hex << boost::hash<std::string>()(hdl_descriptions);
+      flow->SetCacheIdentifier(fu_name + ":" + fu->characterizing_constant_value + ":" + hdl_hash.str());
+      flow->GenerateSynthesisScripts(fu->get_name(), SM, hdl_files, aux_files);
+      PendingCell cell;
+      cell.fu = fu;
+      cell.reference = pending_cells.size();
+      cell.pipe_parameter = n_pipe_parameters > 0 ? pipe_parameters[stage_index] : "";
+      cell.pipeline_depth = PipelineDepth;
+      if(constPort < n_ports && is_commutative && constPort > has_first_synthesis_id && prev_cell < pending_cells.size())
       {
-         fu->area_m = area_model::create_model(device->get_type(), parameters);
+         /// the results of the first specialization of a commutative unit are reused
+         cell.reference = prev_cell;
       }
-#endif
-      /// setting the timing values for each operation
-      const functional_unit::operation_vec& ops = fu->get_operations();
-      for(const auto& op : ops)
+      else
       {
-         auto* new_op = GetPointer<operation>(op);
-         time_modelRef synthesis_results;
+         cell.flow = flow;
+         has_first_synthesis_id = constPort;
 #ifndef NDEBUG
          if(not dummy_synthesis)
 #endif
          {
-            if(constPort < n_ports && is_commutative && constPort > has_first_synthesis_id && prev_area_characterization && prev_timing_characterization)
-               synthesis_results = prev_timing_characterization;
-            else
-               synthesis_results = flow->get_timing_results();
+            PRINT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "Scheduling characterization of functional unit " + fu_name);
+            runner->AddJob(flow);
          }
+      }
+      if(constPort < n_ports && is_commutative && constPort == has_first_synthesis_id)
+         prev_cell = pending_cells.size();
+      pending_cells.push_back(cell);
+   }
+   else
+   {
+      prev_cell = std::numeric_limits<size_t>::max();
+   }
+}
+
+void RTLCharacterization::CompleteCell(const PendingCell& cell)
+{
+   functional_unit* fu = cell.fu;
+   const target_deviceRef device = target->get_target_device();
+   const BackendFlowRef flow = pending_cells.at(cell.reference).flow;
+   THROW_ASSERT(flow, "Synthesis of " + fu->get_name() + " not performed");
 #ifndef NDEBUG
-         else
-         {
-            synthesis_results = time_model::create_model(device->get_type(), parameters);
-            synthesis_results->set_execution_time(7.75, time_model::cycles_time_DEFAULT);
-         }
+   if(not dummy_synthesis)
+#endif
+   {
+      /// the synthesis has been successfully completed
+      /// setting the used resources
+      fu->area_m = flow->get_used_resources();
+   }
+#ifndef NDEBUG
+   else
+   {
+      fu->area_m = area_model::create_model(device->get_type(), parameters);
+   }
 #endif
-         double exec_time = 0.0;
-         if(synthesis_results)
-            exec_time = synthesis_results->get_execution_time();
+   /// setting the timing values for each operation
+   const functional_unit::operation_vec& ops = fu->get_operations();
+   for(const auto& op : ops)
+   {
+      auto* new_op = GetPointer<operation>(op);
+      time_modelRef synthesis_results;
+#ifndef NDEBUG
+      if(not dummy_synthesis)
+#endif
+      {
+         synthesis_results = flow->get_timing_results();
+      }
+#ifndef NDEBUG
+      else
+      {
+         synthesis_results = time_model::create_model(device->get_type(), parameters);
+         synthesis_results->set_execution_time(7.75, time_model::cycles_time_DEFAULT);
+      }
+#endif
+      double exec_time = 0.0;
+      if(synthesis_results)
+         exec_time = synthesis_results->get_execution_time();
 
-         if(!new_op->time_m)
-            new_op->time_m = time_model::create_model(device->get_type(), parameters);
+      if(!new_op->time_m)
+         new_op->time_m = time_model::create_model(device->get_type(), parameters);
 
-         if(n_pipe_parameters > 0)
-         {
-            new_op->time_m->set_stage_period(time_model::stage_period_DEFAULT);
-            new_op->time_m->set_execution_time(time_model::execution_time_DEFAULT, time_model::cycles_time_DEFAULT);
-            const ControlStep ii_default(time_model::initiation_time_DEFAULT);
-            new_op->time_m->set_initiation_time(ii_default);
+      if(cell.pipe_parameter != "")
+      {
+         new_op->time_m->set_stage_period(time_model::stage_period_DEFAULT);
+         new_op->time_m->set_execution_time(time_model::execution_time_DEFAULT, time_model::cycles_time_DEFAULT);
+         const ControlStep ii_default(time_model::initiation_time_DEFAULT);
+         new_op->time_m->set_initiation_time(ii_default);
 
-            unsigned int n_cycles;
-            n_cycles = boost::lexical_cast<unsigned int>(pipe_parameters[stage_index]);
-            new_op->pipe_parameters = pipe_parameters[stage_index];
+         unsigned int n_cycles;
+         n_cycles = boost::lexical_cast<unsigned int>(cell.pipe_parameter);
+         new_op->pipe_parameters = cell.pipe_parameter;
 
-            if(n_cycles > 0 && PipelineDepth != 0)
-            {
-               new_op->time_m->set_stage_period(exec_time);
-               const ControlStep ii(1u);
-               new_op->time_m->set_initiation_time(ii);
-               if(PipelineDepth == -1)
-                  new_op->time_m->set_execution_time(exec_time, n_cycles + 1);
-               else
-                  new_op->time_m->set_execution_time(exec_time, static_cast<unsigned int>(PipelineDepth) + 1);
-            }
-            else if(PipelineDepth == 0)
-               new_op->time_m->set_execution_time(exec_time, time_model::cycles_time_DEFAULT);
+         if(n_cycles > 0 && cell.pipeline_depth != 0)
+         {
+            new_op->time_m->set_stage_period(exec_time);
+            const ControlStep ii(1u);
+            new_op->time_m->set_initiation_time(ii);
+            if(cell.pipeline_depth == -1)
+               new_op->time_m->set_execution_time(exec_time, n_cycles + 1);
             else
-               new_op->time_m->set_execution_time(exec_time, n_cycles);
+               new_op->time_m->set_execution_time(exec_time, static_cast<unsigned int>(cell.pipeline_depth) + 1);
          }
-         else if(new_op->time_m->get_cycles() == 0)
-         {
+         else if(cell.pipeline_depth == 0)
             new_op->time_m->set_execution_time(exec_time, time_model::cycles_time_DEFAULT);
-         }
          else
-         {
-            new_op->time_m->set_stage_period(exec_time);
-         }
+            new_op->time_m->set_execution_time(exec_time, n_cycles);
       }
-
-#ifndef NDEBUG
-      if(not dummy_synthesis)
-#endif
+      else if(new_op->time_m->get_cycles() == 0)
       {
-         if(constPort < n_ports && is_commutative && constPort == has_first_synthesis_id && flow->get_used_resources() && flow->get_timing_results())
-         {
-            prev_area_characterization = flow->get_used_resources();
-            prev_timing_characterization = flow->get_timing_results();
-            THROW_ASSERT(prev_area_characterization, "expected a previous synthesis result");
-            THROW_ASSERT(prev_timing_characterization, "expected a previous synthesis result");
-         }
+         new_op->time_m->set_execution_time(exec_time, time_model::cycles_time_DEFAULT);
+      }
+      else
+      {
+         new_op->time_m->set_stage_period(exec_time);
       }
-      completed.insert(fu->functional_unit_name);
-   }
-   else
-   {
-      prev_area_characterization = area_modelRef();
-      prev_timing_characterization = time_modelRef();
    }
+   completed.insert(fu->functional_unit_name);
 }
 
 const std::string RTLCharacterization::ComputeComponent(const std::string& input) const
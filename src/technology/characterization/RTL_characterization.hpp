@@ -47,6 +47,7 @@
 
 #include "custom_set.hpp"
 #include "refcount.hpp"
+#include <string>
 #include <vector>
 
 /**
@@ -55,6 +56,7 @@
 //@{
 // parameters
 REF_FORWARD_DECL(area_model);
+REF_FORWARD_DECL(BackendFlow);
 CONSTREF_FORWARD_DECL(Parameter);
 REF_FORWARD_DECL(target_device);
 REF_FORWARD_DECL(target_manager);
@@ -65,14 +67,41 @@ REF_FORWARD_DECL(library_manager);
 REF_FORWARD_DECL(language_writer);
 REF_FORWARD_DECL(structural_object);
 REF_FORWARD_DECL(structural_manager);
+REF_FORWARD_DECL(SynthesisJobRunner);
 REF_FORWARD_DECL(time_model);
 class xml_element;
 class module;
 //@}
 
+/**
+ * Characterize the cells of a component with respect to the target device.
+ * The cells are specialized and wrapped in sequence, while their syntheses are executed concurrently by a SynthesisJobRunner
+ * (--panda-parameter=synthesis-jobs=<n>). When the synthesis result cache is enabled (--panda-parameter=synthesis-cache=<dir>),
+ * the results of each cell are stored as soon as its synthesis completes, so that an interrupted characterization is resumed
+ * by synthesizing only the missing cells.
+ */
 class RTLCharacterization : public FunctionalUnitStep
 {
  private:
+   /// A cell whose synthesis has been scheduled
+   struct PendingCell
+   {
+      /// the specialized functional unit
+      functional_unit* fu;
+
+      /// the flow synthesizing the cell (null if the results of another cell are reused)
+      BackendFlowRef flow;
+
+      /// the index of the cell providing the synthesis results
+      size_t reference;
+
+      /// the pipeline parameter of the cell (empty if the cell is not pipelined)
+      std::string pipe_parameter;
+
+      /// the pipeline depth reported by FloPoCo (-1 if unknown)
+      int pipeline_depth;
+   };
+
    /// Library manager
    library_managerRef LM;
 
@@ -82,11 +111,14 @@ class RTLCharacterization : public FunctionalUnitStep
    /// The cells to be characterized
    const CustomSet<std::string> cells;
 
-   /// The area model of the last characterization
-   area_modelRef prev_area_characterization;
+   /// The runner executing the syntheses of the cells
+   SynthesisJobRunnerRef runner;
+
+   /// The cells whose synthesis has been scheduled
+   std::vector<PendingCell> pending_cells;
 
-   /// The time model of the last characterization
-   time_modelRef prev_timing_characterization;
+   /// The index of the last synthesized cell whose results can be reused by the following specializations of a commutative unit
+   size_t prev_cell;
 
 #ifndef NDEBUG
    /// True if we are performing dummy synthesis
@@ -98,6 +130,12 @@ class RTLCharacterization : public FunctionalUnitStep
     */
    void characterize_fu(const technology_nodeRef functional_unit);
 
+   /**
+    * Set the area and timing models of a cell from the results of its synthesis
+    * @param cell is the cell
+    */
+   void CompleteCell(const PendingCell& cell);
+
    /**
     * @brief resize the port w.r.t a given precision
     * @param port
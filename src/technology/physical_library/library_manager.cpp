@@ -229,12 +229,12 @@ void library_manager::set_default_attributes()
 #endif
 }
 
-library_manager::library_manager(ParameterConstRef _Param, bool std) : Param(std::move(_Param)), is_std(std)
+library_manager::library_manager(ParameterConstRef _Param, bool std) : Param(std::move(_Param)), is_std(std), modifications(0)
 {
    set_default_attributes();
 }
 
-library_manager::library_manager(std::string library_name, ParameterConstRef _Param, bool std) : Param(std::move(_Param)), name(std::move(library_name)), is_std(std)
+library_manager::library_manager(std::string library_name, ParameterConstRef _Param, bool std) : Param(std::move(_Param)), name(std::move(library_name)), is_std(std), modifications(0)
 {
    set_default_attributes();
 }
@@ -397,6 +397,7 @@ void library_manager::add(const technology_nodeRef& node)
    erase_info();
    std::string _name = node->get_name();
    fu_map[_name] = node;
+   ++modifications;
 }
 
 void library_manager::update(const technology_nodeRef& fu_node)
@@ -587,6 +588,7 @@ void library_manager::remove_fu(const std::string& _name)
    }
    fu_map.erase(_name);
    erase_info();
+   ++modifications;
 }
 
 void library_manager::set_dont_use(const std::string& _name)
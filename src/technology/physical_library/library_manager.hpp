@@ -173,6 +173,9 @@ class library_manager
    /// flag to check if the library is standard (i.e., provided in input) or virtual
    bool is_std;
 
+   /// Number of cells added to or removed from this library
+   size_t modifications;
+
    /**
     * Set the default attributes for the library
     */
@@ -243,6 +246,14 @@ class library_manager
 
    size_t get_gate_count() const;
 
+   /**
+    * Return the number of cells added to or removed from this library; used by technology_manager to validate its cell index
+    */
+   size_t get_modifications() const
+   {
+      return modifications;
+   }
+
    /**
     * Return the list of the resources contained into the given library
     * @return a datastructure that maps the name of the cells contained into the library with the related technology_node's
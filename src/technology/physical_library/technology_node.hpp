@@ -155,6 +155,7 @@ enum class TargetDevice_Type;
 #define PROXY_CTRLN "PROXY_CTRLN"
 #define DPROXY_CTRL "DPROXY_CTRL"
 #define DPROXY_CTRLN "DPROXY_CTRLN"
+#define MEMORY_CACHE_STD "MEMORY_CACHE"
 
 #define MEMORY_TYPE_ASYNCHRONOUS "ASYNCHRONOUS"
 #define MEMORY_TYPE_SYNCHRONOUS_UNALIGNED "SYNCHRONOUS_UNALIGNED"
@@ -172,6 +173,7 @@ enum class TargetDevice_Type;
 #define MEMORY_CTRL_TYPE_DPROXY "DPROXY"
 #define MEMORY_CTRL_TYPE_PROXYN "PROXYN"
 #define MEMORY_CTRL_TYPE_DPROXYN "DPROXYN"
+#define MEMORY_CTRL_TYPE_CACHE "CACHE"
 
 #define UUDATA_CONVERTER_STD "UUdata_converter_FU"
 #define IUDATA_CONVERTER_STD "IUdata_converter_FU"
@@ -719,7 +721,7 @@ struct functional_unit : public technology_node
 
  private:
    /// This varibale maps the name of the op with its reference.
-   std::map<std::string, technology_nodeRef> op_name_to_op;
+   CustomUnorderedMap<std::string, technology_nodeRef> op_name_to_op;
 
    /// At each functional unit can be associate several operations with different performances.
    operation_vec list_of_operation;
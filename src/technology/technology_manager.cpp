@@ -81,6 +81,7 @@
 
 /// STL include
 #include "custom_map.hpp"
+#include <algorithm>
 
 const unsigned int technology_manager::XML = 1 << 0;
 #if HAVE_FROM_LIBERTY
@@ -89,7 +90,7 @@ const unsigned int technology_manager::LIB = 1 << 1;
 #endif
 const unsigned int technology_manager::LEF = 1 << 2;
 
-technology_manager::technology_manager(const ParameterConstRef _Param) : Param(_Param)
+technology_manager::technology_manager(const ParameterConstRef _Param) : Param(_Param), cell_index_valid(false)
 {
    debug_level = Param->get_class_debug_level(GET_CLASS(*this));
 }
@@ -120,6 +121,11 @@ bool technology_manager::can_implement(const std::string& fu_name, const std::st
 technology_nodeRef technology_manager::get_fu(const std::string& fu_name, const std::string& Library) const
 {
    THROW_ASSERT(Library.size(), "Library not specified for component " + fu_name);
+   UpdateCellIndex();
+   const auto cell = cell_index.find(fu_name);
+   if(cell != cell_index.end() and cell->second.first == Library)
+      return cell->second.second;
+   /// the cell is also contained in a library with lower priority
    if(library_map.find(Library) != library_map.end() and library_map.find(Library)->second->is_fu(fu_name))
       return library_map.find(Library)->second->get_fu(fu_name);
    return technology_nodeRef();
@@ -215,8 +221,19 @@ void technology_manager::add(const technology_nodeRef curr, const std::string& L
       library_managerRef lib(new library_manager(Library, Param, std));
       library_map[Library] = lib;
       libraries.push_back(Library);
+      cell_index_valid = false;
    }
    library_map[Library]->add(curr);
+   UpdateCellIndex(curr->get_name(), Library);
+}
+
+void technology_manager::remove_fu(const std::string& fu_name, const std::string& Library)
+{
+   THROW_ASSERT(library_map.find(Library) != library_map.end(), "Library \"" + Library + "\" not found");
+   if(!library_map.find(Library)->second->is_fu(fu_name))
+      return;
+   library_map.find(Library)->second->remove_fu(fu_name);
+   UpdateCellIndex(fu_name, Library);
 }
 
 void technology_manager::xload(const xml_element* node, const target_deviceRef device)
@@ -255,6 +272,7 @@ void technology_manager::xload(const xml_element* node, const target_deviceRef d
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Loading library " + library_name);
             library_map[library_name] = LM;
             libraries.push_back(library_name);
+            cell_index_valid = false;
             temp_libraries.insert(LM);
             LM->set_info(library_manager::XML, "");
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Loaded library " + library_name);
@@ -452,16 +470,66 @@ void technology_manager::lef_write(const std::string& filename, TargetDevice_Typ
 }
 #endif
 
-std::string technology_manager::get_library(const std::string& Name) const
+void technology_manager::UpdateCellIndex() const
 {
-   std::string Library;
-   for(const auto& librarie : libraries)
+   const auto is_indexed = [&](const std::string& library) -> bool {
+      return cell_index_modifications.find(library) != cell_index_modifications.end() && cell_index_modifications.find(library)->second == library_map.find(library)->second->get_modifications();
+   };
+   if(cell_index_valid && std::all_of(libraries.begin(), libraries.end(), is_indexed))
+      return;
+   cell_index.clear();
+   cell_index_modifications.clear();
+   for(const auto& library : libraries)
+   {
+      THROW_ASSERT(library_map.find(library) != library_map.end(), "Library " + library + " not found");
+      for(const auto& cell : library_map.find(library)->second->get_library_fu())
+      {
+         /// libraries are ordered by priority: the first occurrence wins
+         cell_index.insert(std::make_pair(cell.first, std::make_pair(library, cell.second)));
+      }
+      cell_index_modifications[library] = library_map.find(library)->second->get_modifications();
+   }
+   cell_index_valid = true;
+}
+
+void technology_manager::UpdateCellIndex(const std::string& fu_name, const std::string& Library)
+{
+   const auto LM = library_map.find(Library)->second;
+   /// the index is rebuilt from scratch if the library has been changed also by someone else
+   if(!cell_index_valid || cell_index_modifications[Library] + 1 != LM->get_modifications())
    {
-      Library = librarie;
-      THROW_ASSERT(library_map.find(Library) != library_map.end(), "Library " + Library + " not found");
-      if(library_map.find(Library)->second->is_fu(Name))
-         return Library;
+      cell_index_valid = false;
+      return;
    }
+   cell_index_modifications[Library] = LM->get_modifications();
+   const auto cell = cell_index.find(fu_name);
+   if(LM->is_fu(fu_name))
+   {
+      /// libraries are ordered by priority: the cell wins if the current one is in a library with lower priority
+      if(cell == cell_index.end() || std::find(libraries.begin(), libraries.end(), Library) <= std::find(libraries.begin(), libraries.end(), cell->second.first))
+         cell_index[fu_name] = std::make_pair(Library, LM->get_fu(fu_name));
+   }
+   else if(cell != cell_index.end() && cell->second.first == Library)
+   {
+      /// the cell of a library with lower priority becomes visible
+      cell_index.erase(cell);
+      for(const auto& library : libraries)
+      {
+         if(library_map.find(library)->second->is_fu(fu_name))
+         {
+            cell_index[fu_name] = std::make_pair(library, library_map.find(library)->second->get_fu(fu_name));
+            break;
+         }
+      }
+   }
+}
+
+std::string technology_manager::get_library(const std::string& Name) const
+{
+   UpdateCellIndex();
+   const auto cell = cell_index.find(Name);
+   if(cell != cell_index.end())
+      return cell->second.first;
    /// empty string. it means that the cell is not contained into any library
    return "";
 }
@@ -489,6 +557,7 @@ bool technology_manager::is_library_manager(const std::string& Name) const
 
 void technology_manager::erase_library(const std::string& Name)
 {
+   cell_index_valid = false;
    library_map.erase(Name);
    if(std::find(libraries.begin(), libraries.end(), Name) != libraries.end())
       libraries.erase(std::find(libraries.begin(), libraries.end(), Name));
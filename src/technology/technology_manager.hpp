@@ -53,6 +53,7 @@
 /// STD include
 #include <ostream>
 #include <string>
+#include <utility>
 
 /// STL include
 #include "custom_map.hpp"
@@ -149,6 +150,27 @@ class technology_manager
    /// The builtin components
    CustomSet<std::string> builtins;
 
+   /// For each cell, the first library (in priority order) containing it and the corresponding node
+   mutable CustomUnorderedMap<std::string, std::pair<std::string, technology_nodeRef>> cell_index;
+
+   /// For each library, the number of its modifications already reflected by cell_index
+   mutable CustomUnorderedMap<std::string, size_t> cell_index_modifications;
+
+   /// True if cell_index reflects the current list of libraries
+   mutable bool cell_index_valid;
+
+   /**
+    * Rebuild the cell index if it is not valid or if a library has been changed without passing through this class
+    */
+   void UpdateCellIndex() const;
+
+   /**
+    * Update the cell index after a cell has been added to or removed from a library
+    * @param fu_name is the name of the cell
+    * @param Library is the library which has been changed
+    */
+   void UpdateCellIndex(const std::string& fu_name, const std::string& Library);
+
    /**
     * Return the functional unit used to compute the setup hold time
     * @return the functional unit used to compute the setup hold time
@@ -185,6 +207,13 @@ class technology_manager
     */
    void add(const technology_nodeRef curr, const std::string& Library);
 
+   /**
+    * Remove a functional_unit from the specified library.
+    * @param fu_name is the name of the removed element
+    * @param Library is the name of the library
+    */
+   void remove_fu(const std::string& fu_name, const std::string& Library);
+
 #if HAVE_CIRCUIT_BUILT
    /**
     * Build a resource based on the given characteristics and structural representation.
@@ -2536,3 +2536,40 @@ tree_nodeRef tree_manipulation::CreateVectorBooleanType(const unsigned int numbe
    }
    return TreeM->GetTreeReindex(vector_type_id);
 }
+
+tree_nodeRef tree_manipulation::CreateArrayType(const tree_nodeConstRef& element_type, const unsigned long long int number_of_elements) const
+{
+   THROW_ASSERT(number_of_elements > 0, "empty array type");
+   const auto size_type = create_size_type();
+   const auto st = GetPointer<const integer_type>(GET_CONST_NODE(size_type));
+
+   /// the domain is [0, number_of_elements - 1]
+   std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> domain_schema;
+   domain_schema[TOK(TOK_SIZE)] = STR(st->size->index);
+   domain_schema[TOK(TOK_ALGN)] = STR(st->algn);
+   domain_schema[TOK(TOK_PREC)] = STR(st->prec);
+   domain_schema[TOK(TOK_UNSIGNED)] = STR(st->unsigned_flag);
+   domain_schema[TOK(TOK_MIN)] = STR(TreeM->CreateUniqueIntegerCst(0, size_type->index)->index);
+   domain_schema[TOK(TOK_MAX)] = STR(TreeM->CreateUniqueIntegerCst(static_cast<long long int>(number_of_elements - 1), size_type->index)->index);
+   auto domain_id = TreeM->find(integer_type_K, domain_schema);
+   if(domain_id == 0)
+   {
+      domain_id = TreeM->new_tree_node_id();
+      TreeM->create_tree_node(domain_id, integer_type_K, domain_schema);
+   }
+
+   const auto element_bitsize = tree_helper::size(TreeM, element_type->index);
+   std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
+   IR_schema[TOK(TOK_ELTS)] = STR(element_type->index);
+   IR_schema[TOK(TOK_DOMN)] = STR(domain_id);
+   IR_schema[TOK(TOK_SIZE)] = STR(TreeM->CreateUniqueIntegerCst(static_cast<long long int>(number_of_elements * element_bitsize), create_bit_size_type()->index)->index);
+   IR_schema[TOK(TOK_ALGN)] = STR(GetPointer<const type_node>(GET_CONST_NODE(element_type))->algn);
+   auto array_type_id = TreeM->find(array_type_K, IR_schema);
+   if(array_type_id == 0)
+   {
+      array_type_id = TreeM->new_tree_node_id();
+      IR_schema[TOK(TOK_SRCP)] = "<built-in>:0:0";
+      TreeM->create_tree_node(array_type_id, array_type_K, IR_schema);
+   }
+   return TreeM->GetTreeReindex(array_type_id);
+}
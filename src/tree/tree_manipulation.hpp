@@ -661,6 +661,14 @@ class tree_manipulation
     * @return the tree reindex of the created node
     */
    tree_nodeRef CreateVectorBooleanType(const unsigned int number_of_elements) const;
+
+   /**
+    * Create a one-dimensional array type indexed from zero
+    * @param element_type is the type of the elements
+    * @param number_of_elements is the number of elements of the array
+    * @return the tree reindex of the created node
+    */
+   tree_nodeRef CreateArrayType(const tree_nodeConstRef& element_type, const unsigned long long int number_of_elements) const;
 };
 
 typedef refcount<tree_manipulation> tree_manipulationRef;
@@ -50,10 +50,16 @@
 
 #include "Parameter.hpp"
 #include "fileIO.hpp"
+#include "math_function.hpp" // for ceil_log2
 #include "string_manipulation.hpp" // for Trimspaces
 #include <cmath>
 
 /// STL include
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
 #include <vector>
 
 SimulationTool::SimulationTool(const ParameterConstRef& _Param) : Param(_Param), debug_level(Param->getOption<int>(OPT_debug_level)), output_level(Param->getOption<unsigned int>(OPT_output_level))
@@ -124,9 +130,62 @@ unsigned long long int SimulationTool::Simulate(unsigned long long int& accum_cy
       CopyStdout(log_file);
    }
 
+   DetermineStreamOccupancy();
+
    return DetermineCycles(accum_cycles, n_testcases);
 }
 
+void SimulationTool::DetermineStreamOccupancy() const
+{
+   const auto simulation_output = Param->getOption<std::string>(OPT_output_temporary_directory) + "/simulation_output";
+   if(!boost::filesystem::exists(simulation_output))
+   {
+      return;
+   }
+   /// parameter name -> (maximum occupancy, stall cycles, current depth)
+   std::map<std::string, std::tuple<unsigned int, unsigned long long int, unsigned int>> occupancy;
+   const auto sim_file = fileIO_istream_open(simulation_output);
+   std::string line;
+   while(getline(*sim_file, line))
+   {
+      const auto pos = line.find("AXIS_FIFO_OCCUPANCY ");
+      if(pos == std::string::npos)
+      {
+         continue;
+      }
+      std::istringstream report(line.substr(pos + std::string("AXIS_FIFO_OCCUPANCY ").size()));
+      std::string param;
+      unsigned int max_occupancy = 0;
+      unsigned long long int stall_cycles = 0;
+      unsigned int depth = 0;
+      if(!(report >> param >> max_occupancy >> stall_cycles >> depth))
+      {
+         continue;
+      }
+      auto& stat = occupancy[param];
+      std::get<0>(stat) = std::max(std::get<0>(stat), max_occupancy);
+      std::get<1>(stat) += stall_cycles;
+      std::get<2>(stat) = depth;
+   }
+   if(occupancy.empty())
+   {
+      return;
+   }
+   const auto depth_file_name = Param->getOption<std::string>(OPT_output_directory) + "/axis_fifo_depth.txt";
+   std::ofstream depth_file(depth_file_name);
+   depth_file << "# recommended axis output FIFO depths: <parameter> <depth>" << std::endl;
+   for(const auto& stat : occupancy)
+   {
+      /// a stalled FIFO is doubled, otherwise it is shrunk to the observed occupancy
+      unsigned int recommended = std::get<1>(stat.second) ? 2 * std::get<2>(stat.second) : std::max(2u, std::get<0>(stat.second));
+      recommended = std::min(1u << ceil_log2(recommended), 1024u);
+      depth_file << stat.first << " " << recommended << std::endl;
+      PRINT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                    "axis FIFO of " << stat.first << ": depth " << std::get<2>(stat.second) << ", maximum occupancy " << std::get<0>(stat.second) << ", " << std::get<1>(stat.second) << " stall cycles; recommended depth " << recommended);
+   }
+   PRINT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "Recommended axis FIFO depths written to " + depth_file_name + " (use --panda-parameter=axis-fifo-depth-file=" + depth_file_name + ")");
+}
+
 unsigned long long int SimulationTool::DetermineCycles(unsigned long long int& accum_cycles, unsigned int& n_testcases)
 {
    unsigned long long int num_cycles = 0;
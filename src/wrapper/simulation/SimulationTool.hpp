@@ -125,6 +125,12 @@ class SimulationTool
     */
    unsigned long long int DetermineCycles(unsigned long long int& accum_cycles, unsigned int& n_testcases);
 
+   /**
+    * Collects the AXI4-Stream FIFO occupancies reported by the simulation and writes the recommended depths
+    * into axis_fifo_depth.txt of the output directory, to be fed back through --panda-parameter=axis-fifo-depth-file=<file>
+    */
+   void DetermineStreamOccupancy() const;
+
    /**
     * Remove files created during simulation
     * FIXME: this should become pure virtual
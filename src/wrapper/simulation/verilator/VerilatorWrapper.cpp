@@ -109,6 +109,10 @@ void VerilatorWrapper::GenerateScript(std::ostringstream& script, const std::str
 
    const std::string output_directory = Param->getOption<std::string>(OPT_output_directory);
    log_file = SIM_SUBDIR + suffix + "/" + top_filename + "_verilator.log";
+   /// without the HDL testbench the C++ harness drives directly the top component
+   const std::string hdl_testbench = output_directory + "/simulation/testbench_" + top_filename + "_tb.v";
+   const bool native_testbench = !boost::filesystem::exists(hdl_testbench);
+   const std::string top_module = native_testbench ? top_filename : top_filename + "_tb";
 #if HAVE_EXPERIMENTAL
 #ifdef _WIN32
    /// this removes the dependency from perl on MinGW32
@@ -138,8 +142,11 @@ void VerilatorWrapper::GenerateScript(std::ostringstream& script, const std::str
    {
       script << " " << file;
    }
-   script << " " << output_directory + "/simulation/testbench_" + top_filename << "_tb.v";
-   script << " --top-module " << top_filename << "_tb";
+   if(!native_testbench)
+   {
+      script << " " << hdl_testbench;
+   }
+   script << " --top-module " << top_module;
    script << std::endl;
    script << "if [ $? -ne 0 ]; then" << std::endl;
    script << "   exit 1;" << std::endl;
@@ -147,14 +154,14 @@ void VerilatorWrapper::GenerateScript(std::ostringstream& script, const std::str
    script << std::endl << std::endl;
    script << "ln -s ../../../" + output_directory + " " + SIM_SUBDIR + suffix + "/verilator_obj\n";
 
-   script << "make -C " + SIM_SUBDIR + suffix + "/verilator_obj -j4 OPT_FAST=\"-O1 -fstrict-aliasing\" -f V" + top_filename + "_tb.mk V" + top_filename << "_tb";
+   script << "make -C " + SIM_SUBDIR + suffix + "/verilator_obj -j4 OPT_FAST=\"-O1 -fstrict-aliasing\" -f V" + top_module + ".mk V" + top_module;
 #ifdef _WIN32
    /// VM_PARALLEL_BUILDS=1 removes the dependency from perl
    script << " VM_PARALLEL_BUILDS=1 CFG_CXXFLAGS_NO_UNUSED=\"\"";
 #endif
    script << std::endl << std::endl;
 
-   script << SIM_SUBDIR + suffix + "/verilator_obj/V" + top_filename + "_tb";
+   script << SIM_SUBDIR + suffix + "/verilator_obj/V" + top_module;
    script << " 2>&1 | tee " << log_file << std::endl << std::endl;
 }
 
@@ -98,7 +98,9 @@
 #include "PrimeTimeWrapper.hpp"
 #endif
 
+#include "LUT_model.hpp"
 #include "area_model.hpp"
+#include "clb_model.hpp"
 #include "target_device.hpp"
 #include "technology_node.hpp"
 #include "time_model.hpp"
@@ -110,8 +112,16 @@
 #include "exceptions.hpp"
 
 #include "boost/filesystem.hpp"
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/functional/hash/hash.hpp>
 
+#include <fstream>
 #include <iosfwd>
+#include <sstream>
+#include <unistd.h>
 #include <utility>
 
 #if HAVE_IPXACT_BUILT
@@ -371,6 +381,9 @@ std::string BackendFlow::GenerateSynthesisScripts(const std::string& fu_name, co
       actual_parameters->parameter_values[PARAM_has_VHDL_library] = STR(false);
 
    InitDesignParameters();
+   cache_key.clear();
+   cache_entry.clear();
+   critical_paths.clear();
 
    const auto ret = CreateScripts(actual_parameters);
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Generated synthesis scripts");
@@ -380,10 +393,12 @@ std::string BackendFlow::GenerateSynthesisScripts(const std::string& fu_name, co
 void BackendFlow::ExecuteSynthesis()
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Executing synthesis");
-   for(auto& step : steps)
+   if(LoadCachedSynthesisResults())
    {
-      step->tool->CheckExecution();
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Synthesis results loaded from the cache");
+      return;
    }
+   CheckSynthesisTools();
 
    ToolManagerRef tool(new ToolManager(Param));
    tool->configure("./" + generated_synthesis_script, "");
@@ -391,10 +406,235 @@ void BackendFlow::ExecuteSynthesis()
    const std::string synthesis_file_output = Param->getOption<std::string>(OPT_output_temporary_directory) + "/synthesis_output";
    tool->execute(parameters, input_files, output_files, synthesis_file_output, false);
 
-   CheckSynthesisResults();
+   CollectSynthesisResults();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Executed synthesis");
 }
 
+void BackendFlow::CheckSynthesisTools() const
+{
+   for(const auto& step : steps)
+   {
+      step->tool->CheckExecution();
+   }
+}
+
+void BackendFlow::CollectSynthesisResults()
+{
+   CheckSynthesisResults();
+   StoreSynthesisResults();
+}
+
+const std::string& BackendFlow::GetSynthesisScript() const
+{
+   return generated_synthesis_script;
+}
+
+const std::string& BackendFlow::GetCacheKey() const
+{
+   return cache_entry;
+}
+
+void BackendFlow::SetCacheIdentifier(const std::string& identifier)
+{
+   cache_identifier = identifier;
+}
+
+std::vector<std::string> BackendFlow::GetStepNames() const
+{
+   std::vector<std::string> step_names;
+   for(const auto& step : steps)
+   {
+      step_names.push_back(step->name);
+   }
+   return step_names;
+}
+
+std::string BackendFlow::ComputeCacheKey() const
+{
+   /// only the FPGA models are stored
+   if(!Param->IsParameter("synthesis-cache") || !actual_parameters || target->get_target_device()->get_type() != TargetDevice_Type::FPGA)
+   {
+      return "";
+   }
+   /// each field is prefixed by its length, so that the serialization is not ambiguous
+   std::ostringstream key;
+   const auto add_field = [&key](const std::string& field) { key << field.size() << ":" << field << "\n"; };
+   add_field(flow_name);
+   add_field(actual_parameters->component_name);
+   if(!cache_identifier.empty())
+   {
+      add_field(cache_identifier);
+   }
+   for(const auto& step : steps)
+   {
+      add_field(step->name);
+      add_field(step->config_name);
+      add_field(step->script_name);
+   }
+   for(const auto& parameter : actual_parameters->parameter_values)
+   {
+      add_field(parameter.first);
+      std::vector<std::string> tokens;
+      boost::algorithm::split(tokens, parameter.second, boost::algorithm::is_any_of(";"));
+      for(auto token : tokens)
+      {
+         boost::algorithm::trim(token);
+         /// the output directories of the tools are numbered at each execution, so the paths inside them are considered relative to the step
+         bool tool_path = false;
+         for(const auto& step : steps)
+         {
+            const auto tool_dir = step->tool->get_output_directory();
+            if(!tool_dir.empty() && boost::algorithm::starts_with(token, tool_dir))
+            {
+               token = step->name + token.substr(tool_dir.size());
+               tool_path = true;
+               break;
+            }
+         }
+         if(!tool_path && cache_identifier.empty() && !token.empty() && boost::filesystem::is_regular_file(token))
+         {
+            std::ifstream file(token, std::ios::binary);
+            std::ostringstream content;
+            content << file.rdbuf();
+            add_field(content.str());
+         }
+         else
+         {
+            add_field(token);
+         }
+      }
+   }
+   return key.str();
+}
+
+bool BackendFlow::LoadCachedSynthesisResults()
+{
+   /// the key is computed before the execution, since the reports written by the tools change the parameters referring to files
+   cache_key = ComputeCacheKey();
+   cache_entry.clear();
+   if(cache_key.empty())
+   {
+      return false;
+   }
+   std::ostringstream entry;
+   entry << std::hex << boost::hash<std::string>()(cache_key);
+   cache_entry = entry.str();
+   const auto cache_file = Param->GetParameter<std::string>("synthesis-cache") + "/" + cache_entry + ".txt";
+   if(!boost::filesystem::exists(cache_file))
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Synthesis result cache miss: " + cache_file);
+      return false;
+   }
+   std::ifstream cache(cache_file, std::ios::binary);
+   std::string component;
+   std::getline(cache, component);
+   /// the entry name is only a hash: the whole key has to match
+   std::string key_tag;
+   size_t key_size = 0;
+   cache >> key_tag >> key_size;
+   cache.get();
+   std::string stored_key(key_size, '\0');
+   cache.read(&stored_key[0], static_cast<std::streamsize>(key_size));
+   if(!cache || key_tag != "key" || component != actual_parameters->component_name || stored_key != cache_key)
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Synthesis result cache collision: " + cache_file);
+      return false;
+   }
+   area_m = area_model::create_model(TargetDevice_Type::FPGA, Param);
+   time_m = time_model::create_model(TargetDevice_Type::FPGA, Param);
+   auto* clb_m = GetPointer<clb_model>(area_m);
+   auto* lut_m = GetPointer<LUT_model>(time_m);
+   std::string kind;
+   while(cache >> kind)
+   {
+      if(kind == "area")
+      {
+         double value;
+         cache >> value;
+         area_m->set_area_value(value);
+      }
+      else if(kind == "resource")
+      {
+         unsigned int resource;
+         double value;
+         cache >> resource >> value;
+         clb_m->set_resource_value(static_cast<clb_model::value_t>(resource), value);
+      }
+      else if(kind == "timing")
+      {
+         unsigned int timing;
+         double value;
+         cache >> timing >> value;
+         lut_m->set_timing_value(static_cast<LUT_model::value_t>(timing), value);
+      }
+      else if(kind == "path")
+      {
+         TimingPath path;
+         size_t cells;
+         cache >> path.slack >> cells;
+         path.cells.resize(cells);
+         for(auto& cell : path.cells)
+         {
+            cache >> cell;
+         }
+         critical_paths.push_back(path);
+      }
+      else
+      {
+         THROW_ERROR("Malformed synthesis result cache file " + cache_file);
+      }
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Synthesis result cache hit: " + cache_file);
+   return true;
+}
+
+void BackendFlow::StoreSynthesisResults() const
+{
+   if(cache_entry.empty() || !area_m || !time_m || !GetPointer<clb_model>(area_m) || !GetPointer<LUT_model>(time_m))
+   {
+      return;
+   }
+   const auto cache_dir = Param->GetParameter<std::string>("synthesis-cache");
+   boost::filesystem::create_directories(cache_dir);
+   /// the results are written in a temporary file and then renamed, so that concurrent runs sharing the cache never read partial files
+   const auto cache_file = cache_dir + "/" + cache_entry + ".txt";
+   const auto temp_file = cache_file + "." + STR(getpid());
+   const auto* clb_m = GetPointer<const clb_model>(area_m);
+   const auto* lut_m = GetPointer<const LUT_model>(time_m);
+   std::ofstream cache(temp_file, std::ios::binary);
+   cache.precision(17);
+   cache << actual_parameters->component_name << std::endl;
+   cache << "key " << cache_key.size() << std::endl;
+   cache << cache_key << std::endl;
+   cache << "area " << area_m->get_area_value() << std::endl;
+   for(unsigned int resource = clb_model::REGISTERS; resource <= clb_model::BRAM; ++resource)
+   {
+      if(clb_m->is_used_resource(static_cast<clb_model::value_t>(resource)))
+      {
+         cache << "resource " << resource << " " << clb_m->get_resource_value(static_cast<clb_model::value_t>(resource)) << std::endl;
+      }
+   }
+   for(unsigned int timing = LUT_model::COMBINATIONAL_DELAY; timing <= LUT_model::MINIMUM_PERIOD_POST_PAR; ++timing)
+   {
+      if(lut_m->is_timing_value(static_cast<LUT_model::value_t>(timing)))
+      {
+         cache << "timing " << timing << " " << lut_m->get_timing_value(static_cast<LUT_model::value_t>(timing)) << std::endl;
+      }
+   }
+   /// the critical paths are needed by the timing closure iterations
+   for(const auto& path : critical_paths)
+   {
+      cache << "path " << path.slack << " " << path.cells.size();
+      for(const auto& cell : path.cells)
+      {
+         cache << " " << cell;
+      }
+      cache << std::endl;
+   }
+   cache.close();
+   boost::filesystem::rename(temp_file, cache_file);
+}
+
 area_modelRef BackendFlow::get_used_resources() const
 {
    return area_m;
@@ -405,6 +645,11 @@ time_modelRef BackendFlow::get_timing_results() const
    return time_m;
 }
 
+const std::vector<TimingPath>& BackendFlow::GetCriticalPaths() const
+{
+   return critical_paths;
+}
+
 void BackendFlow::parse_flow(const XMLDomParserRef parser)
 {
    parser->Exec();
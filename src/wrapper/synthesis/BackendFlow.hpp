@@ -93,6 +93,15 @@ struct BackendStep
 };
 typedef refcount<BackendStep> BackendStepRef;
 
+struct TimingPath
+{
+   /// slack of the path (negative if the path violates the constraint)
+   double slack;
+
+   /// cells traversed by the path, including the startpoint and the endpoint
+   std::vector<std::string> cells;
+};
+
 class BackendFlow
 {
  public:
@@ -156,6 +165,18 @@ class BackendFlow
    /// name of the synthesis script
    std::string generated_synthesis_script;
 
+   /// key of the synthesis result cache for the current design, computed before the execution of the synthesis
+   std::string cache_key;
+
+   /// name of the entry of the synthesis result cache for the current design (hash of cache_key)
+   std::string cache_entry;
+
+   /// stable identifier of the current design provided by the caller (empty if the design is identified by the content of its files)
+   std::string cache_identifier;
+
+   /// worst timing paths extracted from the reports of the last synthesis (if supported by the flow)
+   std::vector<TimingPath> critical_paths;
+
    /**
     * Parses the description of the backend flow given its identifier
     * @param flow_name is the string that represents the identifier of the flow
@@ -177,6 +198,16 @@ class BackendFlow
     */
    virtual void CheckSynthesisResults() = 0;
 
+   /**
+    * Computes the key of the synthesis result cache for the current design.
+    * The key is the serialization of the flow, of the component, of the tools configurations and of the actual parameters;
+    * the parameters referring to existing files (e.g., the HDL files) contribute with the content of the files instead of their path,
+    * unless a stable identifier of the design has been provided with SetCacheIdentifier.
+    * The whole key is stored in the cache entry and compared on load, so that different designs never share an entry.
+    * @return the key or the empty string if the synthesis result cache is disabled
+    */
+   std::string ComputeCacheKey() const;
+
  public:
    /**
     * Constructor
@@ -211,6 +242,50 @@ class BackendFlow
     */
    virtual void ExecuteSynthesis();
 
+   /**
+    * Checks that the tools of all the steps can be executed
+    */
+   void CheckSynthesisTools() const;
+
+   /**
+    * Parses the reports produced by the execution of the generated synthesis script and stores the results in the synthesis result cache
+    */
+   void CollectSynthesisResults();
+
+   /**
+    * Loads the results of the synthesis from the synthesis result cache (i.e., --panda-parameter=synthesis-cache=<dir>)
+    * @return true if the results of the current design have been found
+    */
+   bool LoadCachedSynthesisResults();
+
+   /**
+    * Stores the results of the synthesis in the synthesis result cache; only the FPGA resource and timing models and the critical paths are stored.
+    * The key is the one computed by the last LoadCachedSynthesisResults
+    */
+   void StoreSynthesisResults() const;
+
+   /**
+    * Returns the name of the generated synthesis script
+    */
+   const std::string& GetSynthesisScript() const;
+
+   /**
+    * Returns the name of the synthesis result cache entry computed for the last synthesized design (empty if the cache is disabled)
+    */
+   const std::string& GetCacheKey() const;
+
+   /**
+    * Identifies the next synthesized design with a stable identifier instead of the content of its files;
+    * used when the generated files are not reproducible (e.g., they contain time stamps or random memory initializations)
+    * @param identifier is the identifier of the design
+    */
+   void SetCacheIdentifier(const std::string& identifier);
+
+   /**
+    * Returns the identifiers of the synthesis steps of the flow
+    */
+   std::vector<std::string> GetStepNames() const;
+
    /**
     * Executes the synthesis with the implemented flow
     */
@@ -274,6 +349,11 @@ class BackendFlow
     * Returns the timing information
     */
    time_modelRef get_timing_results() const;
+
+   /**
+    * Returns the worst timing paths reported by the last synthesis; empty if the flow does not report them
+    */
+   const std::vector<TimingPath>& GetCriticalPaths() const;
 };
 /// refcount definition of the class
 typedef refcount<BackendFlow> BackendFlowRef;
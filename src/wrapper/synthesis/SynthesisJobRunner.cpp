@@ -0,0 +1,245 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file SynthesisJobRunner.cpp
+ * @brief Implementation of the class executing several synthesis flows concurrently
+ *
+ */
+
+/// Header include
+#include "SynthesisJobRunner.hpp"
+
+/// Autoheader include
+#include "config_HAVE_ASSERTS.hpp"
+
+/// parameter include
+#include "Parameter.hpp"
+
+/// wrapper/synthesis include
+#include "BackendFlow.hpp"
+
+/// utility includes
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
+#include "fileIO.hpp"
+#include "string_manipulation.hpp"
+
+/// Boost includes
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/lexical_cast.hpp>
+
+/// STD includes
+#include <fstream>
+#include <list>
+
+/// System includes
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// Period (in microseconds) of the polling of the running synthesis jobs
+#define JOB_POLLING_PERIOD 50000
+
+SynthesisJobRunner::SynthesisJobRunner(const ParameterConstRef _Param)
+    : Param(_Param),
+      debug_level(_Param->get_class_debug_level(GET_CLASS(*this))),
+      max_jobs(_Param->IsParameter("synthesis-jobs") ? _Param->GetParameter<size_t>("synthesis-jobs") : 1),
+      jobs_dir(_Param->getOption<std::string>(OPT_output_temporary_directory) + "/synthesis_jobs")
+{
+   if(max_jobs == 0)
+   {
+      THROW_ERROR("synthesis-jobs must be at least 1");
+   }
+   if(Param->IsParameter("synthesis-license-slots"))
+   {
+      std::vector<std::string> slots;
+      const auto slots_string = Param->GetParameter<std::string>("synthesis-license-slots");
+      boost::algorithm::split(slots, slots_string, boost::algorithm::is_any_of(","));
+      for(const auto& slot : slots)
+      {
+         const auto colon = slot.find(':');
+         if(colon == std::string::npos)
+         {
+            THROW_ERROR("Malformed synthesis license slots: " + slot);
+         }
+         const auto step = slot.substr(0, colon);
+         const auto number = boost::lexical_cast<size_t>(slot.substr(colon + 1));
+         if(number == 0)
+         {
+            THROW_ERROR("No license slot for synthesis step " + step);
+         }
+         license_slots[step] = number;
+      }
+   }
+}
+
+SynthesisJobRunner::~SynthesisJobRunner() = default;
+
+void SynthesisJobRunner::AddJob(const BackendFlowRef& flow)
+{
+#if HAVE_ASSERTS
+   for(const auto& job : jobs)
+   {
+      THROW_ASSERT(job.flow != flow, "Flow " + flow->get_flow_name() + " added twice");
+   }
+#endif
+   boost::filesystem::create_directories(jobs_dir);
+   const auto job_name = jobs_dir + "/job_" + STR(jobs.size());
+   /// the generated script is copied since the next generation for the same component overwrites it
+   Job job;
+   job.flow = flow;
+   job.script = job_name + ".sh";
+   job.log_file = job_name + ".log";
+   CopyFile(flow->GetSynthesisScript(), job.script);
+   jobs.push_back(job);
+}
+
+bool SynthesisJobRunner::HasLicenseSlots(const Job& job, const std::map<std::string, size_t>& used_slots) const
+{
+   for(const auto& step : job.flow->GetStepNames())
+   {
+      if(license_slots.find(step) != license_slots.end() && used_slots.find(step) != used_slots.end() && used_slots.find(step)->second >= license_slots.find(step)->second)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+void SynthesisJobRunner::Run()
+{
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Running " + STR(jobs.size()) + " synthesis jobs with at most " + STR(max_jobs) + " concurrent ones");
+   std::list<size_t> pending;
+   for(size_t job_index = 0; job_index < jobs.size(); job_index++)
+   {
+      if(jobs[job_index].flow->LoadCachedSynthesisResults())
+      {
+         continue;
+      }
+      jobs[job_index].flow->CheckSynthesisTools();
+      pending.push_back(job_index);
+   }
+
+   std::map<pid_t, size_t> running;
+   std::map<std::string, size_t> used_slots;
+   std::string failed_log;
+   while(!pending.empty() || !running.empty())
+   {
+      /// after a failure no further job is started, but the running ones are completed
+      auto pending_it = pending.begin();
+      while(failed_log.empty() && pending_it != pending.end() && running.size() < max_jobs)
+      {
+         const auto& job = jobs[*pending_it];
+         if(!HasLicenseSlots(job, used_slots))
+         {
+            ++pending_it;
+            continue;
+         }
+         const auto pid = fork();
+         if(pid < 0)
+         {
+            THROW_ERROR("Synthesis job cannot be started");
+         }
+         if(pid == 0)
+         {
+            const auto log = open(job.log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if(log >= 0)
+            {
+               dup2(log, STDOUT_FILENO);
+               dup2(log, STDERR_FILENO);
+               close(log);
+            }
+            execl("/bin/bash", "bash", job.script.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Started " + job.script + " (" + job.flow->get_flow_name() + ")");
+         for(const auto& step : job.flow->GetStepNames())
+         {
+            used_slots[step]++;
+         }
+         running[pid] = *pending_it;
+         pending_it = pending.erase(pending_it);
+      }
+      if(running.empty())
+      {
+         THROW_ASSERT(!failed_log.empty(), "No synthesis job can be started");
+         break;
+      }
+      /// only the started jobs are waited for, since other child processes may be managed by other parts of the tool
+      int status = 0;
+      pid_t pid = 0;
+      while(pid == 0)
+      {
+         for(const auto& running_job : running)
+         {
+            pid = waitpid(running_job.first, &status, WNOHANG);
+            if(pid < 0)
+            {
+               THROW_ERROR("Error while waiting for the synthesis jobs");
+            }
+            if(pid != 0)
+            {
+               break;
+            }
+         }
+         if(pid == 0)
+         {
+            usleep(JOB_POLLING_PERIOD);
+         }
+      }
+      const auto& job = jobs[running.at(pid)];
+      running.erase(pid);
+      for(const auto& step : job.flow->GetStepNames())
+      {
+         used_slots[step]--;
+      }
+      if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Completed " + job.script);
+         job.flow->CollectSynthesisResults();
+      }
+      else if(failed_log.empty())
+      {
+         failed_log = job.log_file;
+      }
+   }
+   jobs.clear();
+   if(!failed_log.empty())
+   {
+      CopyStdout(failed_log);
+      THROW_ERROR("Synthesis job returned error code: see " + failed_log);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Executed synthesis jobs");
+}
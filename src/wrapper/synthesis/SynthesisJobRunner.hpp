@@ -0,0 +1,124 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2020 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file SynthesisJobRunner.hpp
+ * @brief Class executing several synthesis flows concurrently
+ *
+ */
+#ifndef SYNTHESIS_JOB_RUNNER_HPP
+#define SYNTHESIS_JOB_RUNNER_HPP
+
+/// utility includes
+#include "refcount.hpp"
+
+/// STD includes
+#include <map>
+#include <string>
+#include <vector>
+
+CONSTREF_FORWARD_DECL(Parameter);
+REF_FORWARD_DECL(BackendFlow);
+
+/**
+ * Runs the synthesis scripts generated by a set of backend flows as concurrent processes.
+ * The number of concurrent jobs is set by --panda-parameter=synthesis-jobs=<n> (default 1, i.e., sequential execution);
+ * the number of jobs concurrently using the same synthesis step (e.g., because of a limited number of tool licenses)
+ * is bounded by --panda-parameter=synthesis-license-slots=<step>:<n>[,<step>:<n>...], where <step> is the identifier of the step in the flow configuration.
+ * The designs whose results are already in the synthesis result cache are not synthesized again.
+ */
+class SynthesisJobRunner
+{
+ private:
+   /// A synthesis job
+   struct Job
+   {
+      /// the flow whose synthesis script has to be executed
+      BackendFlowRef flow;
+
+      /// the private copy of the synthesis script
+      std::string script;
+
+      /// the log of the execution
+      std::string log_file;
+   };
+
+   /// The set of input parameters
+   const ParameterConstRef Param;
+
+   /// The debug level
+   int debug_level;
+
+   /// The maximum number of concurrent jobs
+   size_t max_jobs;
+
+   /// The maximum number of concurrent jobs per synthesis step
+   std::map<std::string, size_t> license_slots;
+
+   /// The directory where the scripts and the logs of the jobs are written
+   std::string jobs_dir;
+
+   /// The jobs to be executed
+   std::vector<Job> jobs;
+
+   /**
+    * Check if a job can be started with the currently available license slots
+    * @param job is the job
+    * @param used_slots is the number of license slots currently used by each step
+    */
+   bool HasLicenseSlots(const Job& job, const std::map<std::string, size_t>& used_slots) const;
+
+ public:
+   /**
+    * Constructor
+    * @param Param is the set of input parameters
+    */
+   explicit SynthesisJobRunner(const ParameterConstRef Param);
+
+   /**
+    * Destructor
+    */
+   ~SynthesisJobRunner();
+
+   /**
+    * Add a job; the synthesis scripts of the flow must have already been generated.
+    * Each flow has its own tool output directories, so different flows can be executed concurrently.
+    * @param flow is the flow to be executed
+    */
+   void AddJob(const BackendFlowRef& flow);
+
+   /**
+    * Execute all the added jobs and collect their results; the results of each job are then available through its flow
+    */
+   void Run();
+};
+#endif
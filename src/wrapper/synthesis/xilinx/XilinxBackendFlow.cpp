@@ -62,6 +62,8 @@
 
 #include "XilinxWrapper.hpp"
 
+#include <boost/algorithm/string/predicate.hpp>
+
 #include "Parameter.hpp"
 #include "fileIO.hpp"
 #include "xml_dom_parser.hpp"
@@ -645,6 +647,10 @@ void XilinxBackendFlow::CheckSynthesisResults()
       }
       else
          lut_m->set_timing_value(LUT_model::COMBINATIONAL_DELAY, 0);
+      if(actual_parameters->parameter_values.find(PARAM_vivado_timing_report) != actual_parameters->parameter_values.end() and ExistFile(actual_parameters->parameter_values.find(PARAM_vivado_timing_report)->second))
+      {
+         vivado_parse_timing_paths(actual_parameters->parameter_values.find(PARAM_vivado_timing_report)->second);
+      }
    }
    if((output_level >= OUTPUT_LEVEL_VERY_PEDANTIC or (Param->IsParameter("DumpingTimingReport") and Param->GetParameter<int>("DumpingTimingReport"))) and
       ((actual_parameters->parameter_values.find(PARAM_vivado_timing_report) != actual_parameters->parameter_values.end() and ExistFile(actual_parameters->parameter_values.find(PARAM_vivado_timing_report)->second))))
@@ -653,6 +659,64 @@ void XilinxBackendFlow::CheckSynthesisResults()
    }
 }
 
+void XilinxBackendFlow::vivado_parse_timing_paths(const std::string& fn)
+{
+   critical_paths.clear();
+   std::ifstream report(fn.c_str());
+   /// only the setup paths are considered
+   bool max_delay_paths = false;
+   /// true when the cells of the current path have to be collected
+   bool valid_path = false;
+   std::string line;
+   while(getline(report, line))
+   {
+      boost::trim(line);
+      if(boost::starts_with(line, "Max Delay Paths"))
+      {
+         max_delay_paths = true;
+      }
+      else if(boost::starts_with(line, "Min Delay Paths") or boost::starts_with(line, "Pulse Width Checks"))
+      {
+         max_delay_paths = false;
+      }
+      else if(!max_delay_paths)
+      {
+         continue;
+      }
+      else if(boost::starts_with(line, "Slack") and line.find(':') != std::string::npos)
+      {
+         std::string slack = line.substr(line.find(':') + 1);
+         boost::trim(slack);
+         slack = slack.substr(0, slack.find("ns"));
+         TimingPath path;
+         /// unconstrained paths (e.g., inf slack) and unexpected formats are not back-annotated
+         try
+         {
+            path.slack = boost::lexical_cast<double>(slack);
+         }
+         catch(const boost::bad_lexical_cast&)
+         {
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Skipping path with slack " + slack);
+            valid_path = false;
+            continue;
+         }
+         valid_path = true;
+         critical_paths.push_back(path);
+      }
+      else if(valid_path and (boost::starts_with(line, "Source:") or boost::starts_with(line, "Destination:") or line.find("(Prop_") != std::string::npos))
+      {
+         /// the last token is the pin of the cell
+         std::string pin = line.substr(line.find_last_of(" \t") + 1);
+         const auto cell = pin.substr(0, pin.find_last_of('/'));
+         auto& cells = critical_paths.back().cells;
+         if(cells.empty() or cells.back() != cell)
+         {
+            cells.push_back(cell);
+         }
+      }
+   }
+}
+
 void XilinxBackendFlow::vivado_xparse_utilization(const std::string& fn)
 {
    try
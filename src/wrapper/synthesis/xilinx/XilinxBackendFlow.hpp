@@ -100,6 +100,12 @@ class XilinxBackendFlow : public BackendFlow
     */
    void vivado_xparse_utilization(const std::string& fn);
 
+   /**
+    * Parse the worst setup paths from the vivado timing summary
+    * @param fn is the timing summary report
+    */
+   void vivado_parse_timing_paths(const std::string& fn);
+
    /**
     * Fixed the parsing of timing results from trce
     */
@@ -428,6 +428,14 @@ void GccWrapper::CompileFile(const std::string& original_file_name, std::string&
          {
             command += " -mllvm -panda-topfname=" + fname;
          }
+         if(Param->IsParameter("binary-gimple") && Param->GetParameter<int>("binary-gimple") == 1)
+         {
+            command += " -mllvm -panda-binary-dump";
+         }
+         if(Param->IsParameter("aa-cache"))
+         {
+            command += " -mllvm -panda-aa-cache=" + Param->GetParameter<std::string>("aa-cache");
+         }
       }
       else
          command += " -c -fplugin=" + compiler.ssa_plugin_obj + " -fplugin-arg-" + compiler.ssa_plugin_name + "-outputdir=" + Param->getOption<std::string>(OPT_output_temporary_directory);
@@ -775,6 +783,14 @@ void GccWrapper::FillTreeManager(const tree_managerRef TM, std::map<std::string,
          {
             command += " -panda-topfname=" + fname;
          }
+         if(Param->IsParameter("binary-gimple") && Param->GetParameter<int>("binary-gimple") == 1)
+         {
+            command += " -panda-binary-dump";
+         }
+         if(Param->IsParameter("aa-cache"))
+         {
+            command += " -panda-aa-cache=" + Param->GetParameter<std::string>("aa-cache");
+         }
          command += " -domfrontier -domtree -memdep -memoryssa -lazy-value-info -aa -assumption-cache-tracker -targetlibinfo -loops -simplifycfg -mem2reg -globalopt -break-crit-edges -dse -adce -loop-load-elim";
          command += " " + temporary_file_o_bc;
          temporary_file_o_bc = boost::filesystem::path(Param->getOption<std::string>(OPT_output_temporary_directory) + "/" + boost::filesystem::unique_path(std::string(STR_CST_llvm_obj_file)).string()).string();